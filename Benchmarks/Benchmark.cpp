@@ -0,0 +1,284 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "Benchmark.h"
+
+#include <cmath>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include <unordered_map>
+
+#include <yaml-cpp/yaml.h>
+
+namespace nebula::bench {
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////
+    ////    BenchmarkState    ///////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BenchmarkState::pauseTiming()
+    {
+        if (m_paused)
+            return;
+
+        m_elapsed += Clock::now() - m_start;
+        m_paused = true;
+    }
+
+    void BenchmarkState::resumeTiming()
+    {
+        if (!m_paused)
+            return;
+
+        m_start = Clock::now();
+        m_paused = false;
+    }
+
+    double BenchmarkState::finish()
+    {
+        pauseTiming();
+        return std::chrono::duration<double>(m_elapsed).count();
+    }
+
+    static std::string formatCounters(const std::map<std::string, double>& counters)
+    {
+        std::string text;
+        for (const auto& [name, value] : counters)
+            text += std::format("  {}={:.2f}", name, value);
+
+        return text;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////
+    ////    BenchmarkRunner    //////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<BenchmarkRunner::Benchmark>& BenchmarkRunner::getBenchmarks()
+    {
+        //  Function local, benchmarks register from static initializers of other translation units
+        static std::vector<Benchmark> benchmarks;
+        return benchmarks;
+    }
+
+    void BenchmarkRunner::add(std::string name, BenchmarkFunction function)
+    {
+        getBenchmarks().push_back({std::move(name), std::move(function)});
+    }
+
+    std::vector<std::string> BenchmarkRunner::getNames()
+    {
+        std::vector<std::string> names;
+        for (const auto& benchmark : getBenchmarks())
+            names.push_back(benchmark.name);
+
+        std::ranges::sort(names);
+        return names;
+    }
+
+    std::vector<BenchmarkResult> BenchmarkRunner::run(const BenchmarkSettings& settings)
+    {
+        auto benchmarks = getBenchmarks();
+        std::ranges::sort(benchmarks, {}, &Benchmark::name);
+
+        std::vector<BenchmarkResult> results;
+        for (const auto& benchmark : benchmarks)
+        {
+            if (!settings.filter.empty() && benchmark.name.find(settings.filter) == std::string::npos)
+                continue;
+
+            results.push_back(runBenchmark(benchmark, settings));
+            std::cerr << std::format("{:<48} {:>12.2f} ns{}\n", benchmark.name, results.back().median, formatCounters(results.back().counters));
+        }
+
+        return results;
+    }
+
+    BenchmarkResult BenchmarkRunner::runBenchmark(const Benchmark& benchmark, const BenchmarkSettings& settings)
+    {
+        //  Calibration, grows iteration count until single sample is long enough to measure
+        uint64_t iterations = 1;
+        while (true)
+        {
+            BenchmarkState state{iterations};
+            benchmark.function(state);
+            const double elapsed = state.finish();
+
+            if (elapsed >= settings.min_sample_time || iterations >= (1ull << 40))
+                break;
+
+            const double scale = elapsed > 0.0 ? settings.min_sample_time * 1.2 / elapsed : 10.0;
+            iterations = static_cast<uint64_t>(static_cast<double>(iterations) * std::clamp(scale, 2.0, 10.0));
+        }
+
+        std::vector<double> samples;
+        samples.reserve(settings.samples);
+
+        std::map<std::string, double> counters;
+        for (uint32_t i = 0; i < settings.samples; ++i)
+        {
+            BenchmarkState state{iterations};
+            benchmark.function(state);
+            samples.push_back(state.finish() * 1e9 / static_cast<double>(iterations));
+            counters = std::move(state.m_counters);
+        }
+
+        std::ranges::sort(samples);
+
+        BenchmarkResult result;
+        result.name = benchmark.name;
+        result.iterations = iterations;
+        result.samples = settings.samples;
+        result.counters = std::move(counters);
+        result.min = samples.front();
+        result.max = samples.back();
+
+        const size_t middle = samples.size() / 2;
+        result.median = samples.size() % 2 == 0 ? (samples[middle - 1] + samples[middle]) * 0.5 : samples[middle];
+
+        double sum = 0.0;
+        for (const double sample : samples)
+            sum += sample;
+        result.mean = sum / static_cast<double>(samples.size());
+
+        double variance = 0.0;
+        for (const double sample : samples)
+            variance += (sample - result.mean) * (sample - result.mean);
+        result.stddev = std::sqrt(variance / static_cast<double>(samples.size()));
+
+        return result;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////
+    ////    Reports    //////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static std::string escapeJson(const std::string& text)
+    {
+        std::string escaped;
+        for (const char c : text)
+        {
+            if (c == '"' || c == '\\')
+                escaped += '\\';
+            escaped += c;
+        }
+
+        return escaped;
+    }
+
+    void writeReport(const std::string& path, const std::vector<BenchmarkResult>& results)
+    {
+        std::ofstream file{path};
+        if (!file.is_open())
+        {
+            std::cerr << std::format("Failed to open benchmark report {}!\n", path);
+            return;
+        }
+
+        file << "{\n  \"version\": 1,\n  \"benchmarks\": [\n";
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const auto& result = results[i];
+
+            std::string counters;
+            for (const auto& [name, value] : result.counters)
+                counters += std::format("{}\"{}\": {:.4f}", counters.empty() ? "" : ", ", escapeJson(name), value);
+
+            file << std::format(
+                "    {{\"name\": \"{}\", \"unit\": \"{}\", \"median\": {:.4f}, \"mean\": {:.4f}, \"min\": {:.4f}, \"max\": {:.4f}, "
+                "\"stddev\": {:.4f}, \"iterations\": {}, \"samples\": {}, \"counters\": {{{}}}}}{}\n",
+                escapeJson(result.name), result.unit, result.median, result.mean, result.min, result.max,
+                result.stddev, result.iterations, result.samples, counters, i + 1 < results.size() ? "," : ""
+            );
+        }
+        file << "  ]\n}\n";
+    }
+
+    std::vector<BenchmarkResult> readReport(const std::string& path)
+    {
+        //  JSON is valid YAML flow syntax
+        const YAML::Node report = YAML::LoadFile(path);
+
+        std::vector<BenchmarkResult> results;
+        for (const auto& node : report["benchmarks"])
+        {
+            BenchmarkResult result;
+            result.name = node["name"].as<std::string>();
+            result.unit = node["unit"].as<std::string>("ns");
+            result.median = node["median"].as<double>();
+            result.mean = node["mean"].as<double>(result.median);
+            result.min = node["min"].as<double>(result.median);
+            result.max = node["max"].as<double>(result.median);
+            result.stddev = node["stddev"].as<double>(0.0);
+            result.iterations = node["iterations"].as<uint64_t>(0);
+            result.samples = node["samples"].as<uint32_t>(0);
+            for (const auto& counter : node["counters"])
+                result.counters[counter.first.as<std::string>()] = counter.second.as<double>();
+            results.push_back(std::move(result));
+        }
+
+        return results;
+    }
+
+    uint32_t compareReports(const std::vector<BenchmarkResult>& baseline, const std::vector<BenchmarkResult>& current, const double threshold)
+    {
+        std::unordered_map<std::string, const BenchmarkResult*> baseline_results;
+        for (const auto& result : baseline)
+            baseline_results[result.name] = &result;
+
+        uint32_t regressions = 0;
+
+        std::cout << std::format("{:<48} {:>14} {:>14} {:>9}\n", "Benchmark", "Baseline", "Current", "Delta");
+        for (const auto& result : current)
+        {
+            const auto it = baseline_results.find(result.name);
+            if (it == baseline_results.end())
+            {
+                std::cout << std::format("{:<48} {:>14} {:>11.2f} {:<2} {:>9}\n", result.name, "-", result.median, result.unit, "new");
+                continue;
+            }
+
+            const auto& base = *it->second;
+            const double delta = base.median > 0.0 ? (result.median - base.median) / base.median * 100.0 : 0.0;
+
+            //  Differences within noise of either run are never reported as regressions
+            const double noise = std::max(base.stddev, result.stddev);
+            const bool regression = delta > threshold && result.median - base.median > noise;
+            const bool improvement = delta < -threshold && base.median - result.median > noise;
+            regressions += regression;
+
+            std::cout << std::format(
+                "{:<48} {:>11.2f} {:<2} {:>11.2f} {:<2} {:>+8.1f}% {}\n",
+                result.name, base.median, base.unit, result.median, result.unit, delta,
+                regression ? "REGRESSION" : improvement ? "improved" : ""
+            );
+
+            baseline_results.erase(it);
+        }
+
+        for (const auto& [name, result] : baseline_results)
+            std::cout << std::format("{:<48} {:>11.2f} {:<2} {:>14} {:>9}\n", name, result->median, result->unit, "-", "removed");
+
+        std::cout << std::format("{} regression(s) above {:.1f}% threshold\n", regressions, threshold);
+        return regressions;
+    }
+
+    void printResults(const std::vector<BenchmarkResult>& results)
+    {
+        std::cout << std::format("{:<48} {:>14} {:>14} {:>14} {:>12}\n", "Benchmark", "Median", "Min", "Stddev", "Iterations");
+        for (const auto& result : results)
+        {
+            std::cout << std::format(
+                "{:<48} {:>11.2f} {:<2} {:>11.2f} {:<2} {:>11.2f} {:<2} {:>12}\n",
+                result.name, result.median, result.unit, result.min, result.unit, result.stddev, result.unit, result.iterations
+            );
+
+            if (!result.counters.empty())
+                std::cout << std::format("{:<48}{}\n", "", formatCounters(result.counters));
+        }
+    }
+
+}
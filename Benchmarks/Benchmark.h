@@ -0,0 +1,127 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+namespace nebula::bench {
+
+    //  Keeps compiler from optimizing away benchmarked value
+    template <typename T>
+    inline void doNotOptimize(const T& value)
+    {
+        #if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+        #else
+        static volatile const void* sink;
+        sink = &value;
+        #endif
+    }
+
+    class BenchmarkState
+    {
+    public:
+        explicit BenchmarkState(uint64_t iterations) : m_iterations(iterations) {}
+
+        [[nodiscard]] uint64_t getIterations() const { return m_iterations; }
+
+        //  Excludes per sample setup from measured time
+        void pauseTiming();
+        void resumeTiming();
+
+        //  Reported next to timings, values of last sample are kept
+        void setCounter(const std::string& name, double value) { m_counters[name] = value; }
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        uint64_t m_iterations;
+        bool m_paused = false;
+        Clock::time_point m_start = Clock::now();
+        Clock::duration m_elapsed{};
+        std::map<std::string, double> m_counters{};
+
+        [[nodiscard]] double finish();
+
+        friend class BenchmarkRunner;
+    };
+
+    struct BenchmarkResult
+    {
+        std::string name;
+        std::string unit = "ns";    //  Lower is always better
+
+        double median = 0.0;
+        double mean = 0.0;
+        double min = 0.0;
+        double max = 0.0;
+        double stddev = 0.0;
+
+        uint64_t iterations = 0;    //  Per sample
+        uint32_t samples = 0;
+
+        std::map<std::string, double> counters{};
+    };
+
+    struct BenchmarkSettings
+    {
+        std::string filter;
+        double min_sample_time = 0.05;  //  Seconds
+        uint32_t samples = 10;
+    };
+
+    class BenchmarkRunner
+    {
+    public:
+        using BenchmarkFunction = std::function<void(BenchmarkState&)>;
+
+        static void add(std::string name, BenchmarkFunction function);
+        static std::vector<std::string> getNames();
+
+        //  Calibrates iteration count per benchmark so every sample takes at least min_sample_time
+        static std::vector<BenchmarkResult> run(const BenchmarkSettings& settings);
+
+    private:
+        struct Benchmark
+        {
+            std::string name;
+            BenchmarkFunction function;
+        };
+
+        static std::vector<Benchmark>& getBenchmarks();
+        static BenchmarkResult runBenchmark(const Benchmark& benchmark, const BenchmarkSettings& settings);
+    };
+
+    //  JSON report, compare mode reads it back through yaml-cpp
+    void writeReport(const std::string& path, const std::vector<BenchmarkResult>& results);
+    std::vector<BenchmarkResult> readReport(const std::string& path);
+
+    //  Prints delta table, returns number of results slower than threshold percent
+    uint32_t compareReports(const std::vector<BenchmarkResult>& baseline, const std::vector<BenchmarkResult>& current, double threshold);
+
+    void printResults(const std::vector<BenchmarkResult>& results);
+
+    struct BenchmarkRegistration
+    {
+        BenchmarkRegistration(std::string name, BenchmarkRunner::BenchmarkFunction function)
+        {
+            BenchmarkRunner::add(std::move(name), std::move(function));
+        }
+    };
+
+}
+
+#define NB_BENCH_CONCAT_IMPL(a, b) a##b
+#define NB_BENCH_CONCAT(a, b) NB_BENCH_CONCAT_IMPL(a, b)
+#define NB_BENCHMARK(name, function) static nebula::bench::BenchmarkRegistration NB_BENCH_CONCAT(s_benchmark_, __LINE__){name, function}
+
+#endif //BENCHMARK_H
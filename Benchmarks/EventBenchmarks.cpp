@@ -0,0 +1,73 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "Benchmark.h"
+#include "core/LayerStack.h"
+#include "events/EventManager.h"
+#include "events/KeyboardEvents.h"
+
+namespace nebula::bench {
+
+    static constexpr uint32_t cEventBatch = 64;
+    static constexpr uint32_t cListenerLayers = 8;
+    static constexpr std::size_t cEventMemorySize = 64 * 1024;
+
+    class ListenerLayer final : public Layer
+    {
+    public:
+        ListenerLayer() : Layer("Benchmark listener") {}
+
+        void onEvent(Event& event) override
+        {
+            EventDelegate delegate(event);
+            delegate.delegate<KeyReleasedEvent>([this](const KeyReleasedEvent&) { ++m_handled; return false; });
+        }
+
+    private:
+        uint64_t m_handled = 0;
+    };
+
+    static void eventManagerQueue(BenchmarkState& state)
+    {
+        LayerStack layer_stack;
+        EventManager event_manager{layer_stack, [](Event&) {}, cEventMemorySize};
+
+        for (uint64_t i = 0; i < state.getIterations(); ++i)
+        {
+            event_manager.queueEvent<KeyPressedEvent>(Keycode::Space);
+            if (i % cEventBatch == cEventBatch - 1)
+            {
+                state.pauseTiming();
+                event_manager.dispatchEvents();
+                state.resumeTiming();
+            }
+        }
+
+        event_manager.dispatchEvents();
+    }
+
+    //  Queue and broadcast through layer stack, times are per event
+    static void eventManagerDispatch(BenchmarkState& state)
+    {
+        LayerStack layer_stack;
+        for (uint32_t i = 0; i < cListenerLayers; ++i)
+            layer_stack.pushLayer(new ListenerLayer());
+
+        EventManager event_manager{layer_stack, [](Event&) {}, cEventMemorySize};
+
+        for (uint64_t i = 0; i < state.getIterations(); ++i)
+        {
+            event_manager.queueEvent<KeyReleasedEvent>(Keycode::Space);
+            if (i % cEventBatch == cEventBatch - 1)
+                event_manager.dispatchEvents();
+        }
+
+        event_manager.dispatchEvents();
+    }
+
+    NB_BENCHMARK("events/EventManager/queue", eventManagerQueue);
+    NB_BENCHMARK("events/EventManager/dispatch", eventManagerDispatch);
+
+}
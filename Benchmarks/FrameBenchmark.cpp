@@ -0,0 +1,102 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "FrameBenchmark.h"
+
+#include <array>
+#include <format>
+#include <optional>
+
+#include "core/Layer.h"
+#include "debug/FrameStats.h"
+
+namespace nebula::bench {
+
+    static constexpr std::array cMeasuredMetrics = {
+        FrameMetric::cFrameTime,
+        FrameMetric::cUpdateCpu,
+        FrameMetric::cRenderCpu,
+        FrameMetric::cFenceWait,
+        FrameMetric::cPresent
+    };
+
+    class FrameBenchmarkLayer final : public Layer
+    {
+    public:
+        FrameBenchmarkLayer(FrameBenchmarkApplication& application, const FrameBenchmarkSettings& settings) :
+                Layer("Frame benchmark"), m_application(application), m_settings(settings) {}
+
+        void onUpdate(Timestep delta_time) override
+        {
+            if (m_finished)
+                return;
+
+            auto& frame_stats = FrameStats::get();
+            const uint64_t frame = frame_stats.getFrameCount();
+
+            //  Warm-up frames fill caches and create pipelines, they are dropped from statistics
+            if (!m_start_frame)
+            {
+                if (frame >= m_settings.warmup_frames)
+                {
+                    frame_stats.reset();
+                    m_start_frame = frame;
+                }
+                return;
+            }
+
+            if (frame - *m_start_frame >= m_settings.frames)
+            {
+                m_finished = true;
+                m_application.collectResults(frame - *m_start_frame);
+                m_application.close();
+            }
+        }
+
+    private:
+        FrameBenchmarkApplication& m_application;
+        FrameBenchmarkSettings m_settings;
+
+        std::optional<uint64_t> m_start_frame{};
+        bool m_finished = false;
+    };
+
+    FrameBenchmarkApplication::FrameBenchmarkApplication(const FrameBenchmarkSettings& settings) :
+            Application(
+                ApplicationSpecification("nebula_bench", "BENCH", "", 0, 0.02, settings.api),
+                WindowProperties("nebula_bench", 1280, 720)
+            )
+    {
+        m_benchmark_layer_id = pushLayer<FrameBenchmarkLayer>(*this, settings);
+    }
+
+    FrameBenchmarkApplication::~FrameBenchmarkApplication()
+    {
+        popLayer(m_benchmark_layer_id).reset();
+    }
+
+    void FrameBenchmarkApplication::collectResults(const uint64_t frames)
+    {
+        const char* api_name = getRenderingAPI() == rendering::API::cVulkan ? "vulkan" : "opengl";
+
+        for (const auto metric : cMeasuredMetrics)
+        {
+            const auto summary = FrameStats::get().getSummary(metric);
+            const std::pair<const char*, double> percentiles[] = {{"p50", summary.p50}, {"p95", summary.p95}, {"p99", summary.p99}};
+
+            for (const auto& [percentile, value] : percentiles)
+            {
+                BenchmarkResult result;
+                result.name = std::format("frame/{}/{}/{}", api_name, FrameStats::getMetricName(metric), percentile);
+                result.unit = "ms";
+                result.median = result.mean = result.min = result.max = value;
+                result.iterations = frames;
+                result.samples = 1;
+                m_results.push_back(std::move(result));
+            }
+        }
+    }
+
+}
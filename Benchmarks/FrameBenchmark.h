@@ -0,0 +1,43 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef FRAMEBENCHMARK_H
+#define FRAMEBENCHMARK_H
+
+#include <vector>
+
+#include "Benchmark.h"
+#include "core/Application.h"
+
+namespace nebula::bench {
+
+    struct FrameBenchmarkSettings
+    {
+        uint32_t warmup_frames = 120;
+        uint32_t frames = 1000;
+        rendering::API api = rendering::API::cVulkan;
+    };
+
+    //  Runs whole engine frame loop uncapped, results are FrameStats percentiles of measured frames
+    class FrameBenchmarkApplication final : public Application
+    {
+    public:
+        explicit FrameBenchmarkApplication(const FrameBenchmarkSettings& settings);
+        ~FrameBenchmarkApplication() override;
+
+        [[nodiscard]] const std::vector<BenchmarkResult>& viewResults() const { return m_results; }
+
+    private:
+        std::vector<BenchmarkResult> m_results{};
+        LayerStack::LayerID m_benchmark_layer_id{};
+
+        void collectResults(uint64_t frames);
+
+        friend class FrameBenchmarkLayer;
+    };
+
+}
+
+#endif //FRAMEBENCHMARK_H
@@ -0,0 +1,115 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include <array>
+#include <cstdlib>
+
+#include "Benchmark.h"
+#include "memory/Allocators.h"
+#include "memory/OffsetAllocator.h"
+
+namespace nebula::bench {
+
+    //  Every benchmark allocates batches of cBatchSize objects then releases whole batch, times are per allocation
+    static constexpr uint32_t cBatchSize = 256;
+    static constexpr std::size_t cAllocationSize = 64;
+    static constexpr std::size_t cAllocationAlignment = 16;
+
+    //  Stack allocator stores header in front of every allocation
+    alignas(64) static std::array<std::byte, cBatchSize * (cAllocationSize + 2 * cAllocationAlignment)> s_memory{};
+
+    static void linearAllocator(BenchmarkState& state)
+    {
+        memory::LinearAllocator allocator{s_memory.data(), s_memory.size()};
+
+        for (uint64_t i = 0; i < state.getIterations(); ++i)
+        {
+            doNotOptimize(allocator.allocate(cAllocationSize, cAllocationAlignment));
+            if (i % cBatchSize == cBatchSize - 1)
+                allocator.clear();
+        }
+
+        allocator.clear();
+    }
+
+    static void stackAllocator(BenchmarkState& state)
+    {
+        memory::StackAllocator allocator{s_memory.data(), s_memory.size()};
+        std::array<void*, cBatchSize> allocations{};
+
+        uint64_t i = 0;
+        while (i < state.getIterations())
+        {
+            const uint32_t batch = static_cast<uint32_t>(std::min<uint64_t>(cBatchSize, state.getIterations() - i));
+
+            for (uint32_t j = 0; j < batch; ++j)
+                allocations[j] = allocator.allocate(cAllocationSize, cAllocationAlignment);
+
+            doNotOptimize(allocations);
+
+            for (uint32_t j = batch; j > 0; --j)
+                allocator.deallocate(allocations[j - 1]);
+
+            i += batch;
+        }
+    }
+
+    static void mallocFree(BenchmarkState& state)
+    {
+        std::array<void*, cBatchSize> allocations{};
+
+        uint64_t i = 0;
+        while (i < state.getIterations())
+        {
+            const uint32_t batch = static_cast<uint32_t>(std::min<uint64_t>(cBatchSize, state.getIterations() - i));
+
+            for (uint32_t j = 0; j < batch; ++j)
+                allocations[j] = std::malloc(cAllocationSize);
+
+            doNotOptimize(allocations);
+
+            for (uint32_t j = batch; j > 0; --j)
+                std::free(allocations[j - 1]);
+
+            i += batch;
+        }
+    }
+
+    //  Mesh sized ranges aligned to vertex strides, odd allocations are freed first so merging has neighbours to coalesce
+    static void offsetAllocator(BenchmarkState& state)
+    {
+        static constexpr uint64_t cStrides[] = {12, 16, 20, 32};
+
+        memory::OffsetAllocator allocator{64ull << 20};
+        std::array<memory::OffsetAllocation, cBatchSize> allocations{};
+
+        uint64_t i = 0;
+        while (i < state.getIterations())
+        {
+            const uint32_t batch = static_cast<uint32_t>(std::min<uint64_t>(cBatchSize, state.getIterations() - i));
+
+            for (uint32_t j = 0; j < batch; ++j)
+            {
+                const uint64_t stride = cStrides[j % 4];
+                allocations[j] = allocator.allocate(stride * (64 + (j * 37) % 1024), stride);
+            }
+
+            doNotOptimize(allocations);
+
+            for (uint32_t j = 1; j < batch; j += 2)
+                allocator.free(allocations[j]);
+            for (uint32_t j = 0; j < batch; j += 2)
+                allocator.free(allocations[j]);
+
+            i += batch;
+        }
+    }
+
+    NB_BENCHMARK("memory/LinearAllocator", linearAllocator);
+    NB_BENCHMARK("memory/StackAllocator", stackAllocator);
+    NB_BENCHMARK("memory/malloc", mallocFree);
+    NB_BENCHMARK("memory/OffsetAllocator", offsetAllocator);
+
+}
@@ -0,0 +1,348 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include <cmath>
+#include <random>
+#include <numeric>
+#include <vector>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "Benchmark.h"
+#include "rendering/Shader.h"
+#include "rendering/PipelineState.h"
+#include "rendering/culling/FrustumCuller.h"
+#include "rendering/culling/OcclusionCuller.h"
+#include "rendering/culling/BoundingVolumeHierarchy.h"
+#include "rendering/commands/DrawRenderCommands.h"
+#include "rendering/commands/RenderCommandBuffer.h"
+#include "utility/ObjectCacheManager.h"
+
+namespace nebula::bench {
+
+    using namespace rendering;
+
+    static constexpr uint32_t cCommandBatch = 256;
+    static constexpr uint32_t cPipelineStates = 64;
+    static constexpr uint32_t cCullingGridSize = 48;       //  110592 objects
+    static constexpr uint32_t cBvhRays = 1024;
+    static constexpr uint32_t cOccluderWalls = 256;         //  512 triangles
+
+    //  Pipeline state only needs shader name for hashing and comparison
+    class BenchmarkShader final : public Shader
+    {
+    public:
+        explicit BenchmarkShader(std::string name) : Shader(std::move(name), VertexShader{}) {}
+
+        void bind() override {}
+        void unbind() override {}
+        void* getStageHandle(ShaderStage stage) override { return nullptr; }
+    };
+
+    static std::vector<GraphicsPipelineState> createPipelineStates(BenchmarkShader& shader)
+    {
+        std::vector<GraphicsPipelineState> states;
+        states.reserve(cPipelineStates);
+
+        for (uint32_t i = 0; i < cPipelineStates; ++i)
+        {
+            GraphicsPipelineState state{&shader};
+            state.rasterization.cull_mode = static_cast<CullMode>(i % 4);
+            state.rasterization.line_width = 1.0f + static_cast<float>(i / 4);
+
+            DescriptorSetLayout descriptor_set;
+            descriptor_set.bindings.push_back(DescriptorBinding{0, 1, DescriptorType::cUniformBuffer});
+            descriptor_set.bindings.push_back(DescriptorBinding{1, 1, DescriptorType::cCombinedImageSampler});
+            state.pipeline_layout.descriptor_sets.push_back(std::move(descriptor_set));
+
+            states.push_back(std::move(state));
+        }
+
+        return states;
+    }
+
+    //  Submit and reset every cCommandBatch commands, same as Renderer recycling its command buffer
+    static void renderCommandBufferSubmit(BenchmarkState& state)
+    {
+        state.pauseTiming();
+        const auto command_buffer = RenderCommandBuffer::create();
+        state.resumeTiming();
+
+        for (uint64_t i = 0; i < state.getIterations(); ++i)
+        {
+            command_buffer->submit<DrawDummyIndicesCommand>(3);
+            if (i % cCommandBatch == cCommandBatch - 1)
+                command_buffer->reset();
+        }
+
+        command_buffer->reset();
+        state.pauseTiming();
+    }
+
+    static void graphicsPipelineHash(BenchmarkState& state)
+    {
+        state.pauseTiming();
+        BenchmarkShader shader{"benchmark_shader"};
+        const auto states = createPipelineStates(shader);
+        constexpr GraphicsPipelineHash hash;
+        state.resumeTiming();
+
+        for (uint64_t i = 0; i < state.getIterations(); ++i)
+            doNotOptimize(hash(states[i % cPipelineStates]));
+    }
+
+    static void objectCacheManagerLookup(BenchmarkState& state)
+    {
+        state.pauseTiming();
+        BenchmarkShader shader{"benchmark_shader"};
+        const auto states = createPipelineStates(shader);
+
+        ObjectCacheManager<GraphicsPipelineState, GraphicsPipelineHash> cache;
+        for (const auto& pipeline_state : states)
+            doNotOptimize(cache.getHandle(pipeline_state));
+        state.resumeTiming();
+
+        //  Every lookup hits existing entry, as it does for pipelines in steady state
+        for (uint64_t i = 0; i < state.getIterations(); ++i)
+            doNotOptimize(cache.getHandle(states[i % cPipelineStates]));
+    }
+
+    //  Axis aligned frustum covering roughly half of object grid, times are per culling pass
+    static void frustumCulling(BenchmarkState& state)
+    {
+        state.pauseTiming();
+        CullingBounds bounds;
+        for (uint32_t x = 0; x < cCullingGridSize; ++x)
+            for (uint32_t y = 0; y < cCullingGridSize; ++y)
+                for (uint32_t z = 0; z < cCullingGridSize; ++z)
+                    bounds.add(BoundingSphere{glm::vec3(x, y, z) * 2.0f, 0.5f});
+
+        const float half_extent = static_cast<float>(cCullingGridSize);
+        Frustum frustum;
+        frustum.planes = {
+            glm::vec4{1.0f, 0.0f, 0.0f, 0.0f},
+            glm::vec4{-1.0f, 0.0f, 0.0f, half_extent},
+            glm::vec4{0.0f, 1.0f, 0.0f, 0.0f},
+            glm::vec4{0.0f, -1.0f, 0.0f, 2.0f * half_extent},
+            glm::vec4{0.0f, 0.0f, 1.0f, 0.0f},
+            glm::vec4{0.0f, 0.0f, -1.0f, 2.0f * half_extent}
+        };
+
+        std::vector<uint32_t> visible_indices;
+        state.resumeTiming();
+
+        for (uint64_t i = 0; i < state.getIterations(); ++i)
+            doNotOptimize(cullFrustum(bounds, frustum, visible_indices));
+    }
+
+    //  Random boxes with constant density, scene grows with object count
+    static std::vector<BoundingBox> createBvhBounds(const uint32_t object_count)
+    {
+        const float scene_extent = 4.0f * std::cbrt(static_cast<float>(object_count));
+
+        std::mt19937 generator{42};
+        std::uniform_real_distribution position{0.0f, scene_extent};
+        std::uniform_real_distribution half_size{0.1f, 1.0f};
+
+        std::vector<BoundingBox> bounds(object_count);
+        for (auto& box : bounds)
+        {
+            const glm::vec3 center{position(generator), position(generator), position(generator)};
+            const glm::vec3 extent{half_size(generator), half_size(generator), half_size(generator)};
+            box = {center - extent, center + extent};
+        }
+
+        return bounds;
+    }
+
+    template<uint32_t ObjectCount>
+    static void bvhBuild(BenchmarkState& state)
+    {
+        state.pauseTiming();
+        const auto bounds = createBvhBounds(ObjectCount);
+        BoundingVolumeHierarchy bvh;
+        state.resumeTiming();
+
+        for (uint64_t i = 0; i < state.getIterations(); ++i)
+            bvh.buildStatic(bounds);
+
+        doNotOptimize(bvh.getStatistics().static_nodes);
+    }
+
+    //  Every dynamic object keeps moving in its own direction, so objects regularly leave fat bounds.
+    //  Back and forth movement would stay inside them and hide tree degradation.
+    template<uint32_t ObjectCount>
+    static void bvhRefit(BenchmarkState& state)
+    {
+        state.pauseTiming();
+        auto bounds = createBvhBounds(ObjectCount);
+
+        std::mt19937 generator{7};
+        std::uniform_real_distribution<float> velocity{-0.05f, 0.05f};
+
+        BoundingVolumeHierarchy bvh;
+        std::vector<glm::vec3> velocities(ObjectCount);
+        std::vector<BoundingVolumeHierarchy::Proxy> proxies(ObjectCount);
+        for (uint32_t object = 0; object < ObjectCount; ++object)
+        {
+            velocities[object] = {velocity(generator), velocity(generator), velocity(generator)};
+            proxies[object] = bvh.addDynamic(object, bounds[object]);
+        }
+        state.resumeTiming();
+
+        uint64_t reinsertions = 0;
+        for (uint64_t i = 0; i < state.getIterations(); ++i)
+        {
+            for (uint32_t object = 0; object < ObjectCount; ++object)
+            {
+                bounds[object] = {bounds[object].min + velocities[object], bounds[object].max + velocities[object]};
+                bvh.updateDynamic(proxies[object], bounds[object]);
+            }
+
+            bvh.refit();
+            reinsertions += bvh.getStatistics().reinsertions;
+        }
+
+        state.setCounter("reinsertions", static_cast<double>(reinsertions) / static_cast<double>(state.getIterations()));
+        doNotOptimize(bvh.getStatistics().dynamic_nodes);
+    }
+
+    //  Frustum covers quarter of scene, times are per culling pass
+    template<uint32_t ObjectCount>
+    static void bvhCull(BenchmarkState& state)
+    {
+        state.pauseTiming();
+        const auto bounds = createBvhBounds(ObjectCount);
+        BoundingVolumeHierarchy bvh;
+        bvh.buildStatic(bounds);
+
+        const float half_extent = 2.0f * std::cbrt(static_cast<float>(ObjectCount));
+        Frustum frustum;
+        frustum.planes = {
+            glm::vec4{1.0f, 0.0f, 0.0f, 0.0f},
+            glm::vec4{-1.0f, 0.0f, 0.0f, half_extent},
+            glm::vec4{0.0f, 1.0f, 0.0f, 0.0f},
+            glm::vec4{0.0f, -1.0f, 0.0f, half_extent},
+            glm::vec4{0.0f, 0.0f, 1.0f, 0.0f},
+            glm::vec4{0.0f, 0.0f, -1.0f, 4.0f * half_extent}
+        };
+
+        std::vector<uint32_t> visible_objects;
+        state.resumeTiming();
+
+        for (uint64_t i = 0; i < state.getIterations(); ++i)
+        {
+            visible_objects.clear();
+            bvh.cullFrustum(frustum, visible_objects);
+        }
+
+        doNotOptimize(visible_objects.data());
+    }
+
+    //  Rays from scene corner towards random points, times are per closest hit query
+    template<uint32_t ObjectCount>
+    static void bvhRayCast(BenchmarkState& state)
+    {
+        state.pauseTiming();
+        const auto bounds = createBvhBounds(ObjectCount);
+        BoundingVolumeHierarchy bvh;
+        bvh.buildStatic(bounds);
+
+        std::mt19937 generator{7};
+        std::uniform_real_distribution position{0.0f, 4.0f * std::cbrt(static_cast<float>(ObjectCount))};
+
+        std::vector<Ray> rays(cBvhRays);
+        for (auto& ray : rays)
+        {
+            ray.origin = glm::vec3{-1.0f};
+            ray.direction = glm::vec3{position(generator), position(generator), position(generator)} - ray.origin;
+        }
+        state.resumeTiming();
+
+        for (uint64_t i = 0; i < state.getIterations(); ++i)
+            doNotOptimize(bvh.rayCast(rays[i % cBvhRays]));
+    }
+
+    //  Walls scattered in front of camera, object grid behind them is mostly hidden
+    static void prepareOcclusionFrame(OcclusionCuller& occlusion_culler)
+    {
+        const uint32_t wall = occlusion_culler.addOccluderMesh(
+            {{-4.0f, -4.0f, 0.0f}, {4.0f, -4.0f, 0.0f}, {4.0f, 4.0f, 0.0f}, {-4.0f, 4.0f, 0.0f}},
+            {0, 1, 2, 0, 2, 3}
+        );
+
+        occlusion_culler.beginFrame(glm::perspective(glm::radians(90.0f), 2.0f, 0.1f, 500.0f));
+
+        std::mt19937 generator{3};
+        std::uniform_real_distribution horizontal{-60.0f, 60.0f};
+        std::uniform_real_distribution vertical{-20.0f, 20.0f};
+        std::uniform_real_distribution depth{-60.0f, -5.0f};
+
+        for (uint32_t i = 0; i < cOccluderWalls; ++i)
+            occlusion_culler.addOccluder(wall, glm::translate(glm::mat4{1.0f}, glm::vec3{horizontal(generator), vertical(generator), depth(generator)}));
+    }
+
+    //  Times are per frame of occluder rasterization and Hi-Z build
+    static void occlusionRenderOccluders(BenchmarkState& state)
+    {
+        state.pauseTiming();
+        OcclusionCuller occlusion_culler;
+        prepareOcclusionFrame(occlusion_culler);
+        state.resumeTiming();
+
+        for (uint64_t i = 0; i < state.getIterations(); ++i)
+            occlusion_culler.renderOccluders();
+
+        doNotOptimize(occlusion_culler.getDepth().data());
+    }
+
+    //  Times are per Hi-Z test of whole object grid
+    static void occlusionCullObjects(BenchmarkState& state)
+    {
+        state.pauseTiming();
+        OcclusionCuller occlusion_culler;
+        prepareOcclusionFrame(occlusion_culler);
+        occlusion_culler.renderOccluders();
+
+        CullingBounds bounds;
+        for (uint32_t x = 0; x < cCullingGridSize; ++x)
+            for (uint32_t y = 0; y < cCullingGridSize; ++y)
+                for (uint32_t z = 0; z < cCullingGridSize; ++z)
+                    bounds.add(BoundingSphere{glm::vec3(x, y, z) * 2.0f - glm::vec3(48.0f, 48.0f, 160.0f), 0.5f});
+
+        std::vector<uint32_t> indices;
+        state.resumeTiming();
+
+        for (uint64_t i = 0; i < state.getIterations(); ++i)
+        {
+            state.pauseTiming();
+            indices.resize(bounds.size());
+            std::iota(indices.begin(), indices.end(), 0);
+            state.resumeTiming();
+
+            doNotOptimize(occlusion_culler.cullOccluded(bounds, indices));
+        }
+    }
+
+    NB_BENCHMARK("rendering/RenderCommandBuffer/submit", renderCommandBufferSubmit);
+    NB_BENCHMARK("rendering/GraphicsPipelineHash", graphicsPipelineHash);
+    NB_BENCHMARK("rendering/ObjectCacheManager/lookup", objectCacheManagerLookup);
+    NB_BENCHMARK("rendering/FrustumCulling/cull", frustumCulling);
+    NB_BENCHMARK("rendering/OcclusionCulling/render_occluders", occlusionRenderOccluders);
+    NB_BENCHMARK("rendering/OcclusionCulling/cull", occlusionCullObjects);
+    NB_BENCHMARK("rendering/BVH/build_10k", bvhBuild<10'000>);
+    NB_BENCHMARK("rendering/BVH/build_100k", bvhBuild<100'000>);
+    NB_BENCHMARK("rendering/BVH/build_1m", bvhBuild<1'000'000>);
+    NB_BENCHMARK("rendering/BVH/refit_10k", bvhRefit<10'000>);
+    NB_BENCHMARK("rendering/BVH/refit_100k", bvhRefit<100'000>);
+    NB_BENCHMARK("rendering/BVH/refit_1m", bvhRefit<1'000'000>);
+    NB_BENCHMARK("rendering/BVH/cull_10k", bvhCull<10'000>);
+    NB_BENCHMARK("rendering/BVH/cull_100k", bvhCull<100'000>);
+    NB_BENCHMARK("rendering/BVH/cull_1m", bvhCull<1'000'000>);
+    NB_BENCHMARK("rendering/BVH/ray_cast_10k", bvhRayCast<10'000>);
+    NB_BENCHMARK("rendering/BVH/ray_cast_100k", bvhRayCast<100'000>);
+    NB_BENCHMARK("rendering/BVH/ray_cast_1m", bvhRayCast<1'000'000>);
+
+}
@@ -0,0 +1,160 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include "Benchmark.h"
+#include "scene/World.h"
+#include "scene/Query.h"
+#include "scene/EntityCommandBuffer.h"
+#include "scene/TransformHierarchy.h"
+
+namespace nebula::bench {
+
+    static constexpr uint32_t cSceneEntities = 64 * 1024;
+    static constexpr uint32_t cTransformChildren = 4;      //  Per node, gives 9 levels for scene entities
+
+    struct Position { float x, y, z; };
+    struct Velocity { float x, y, z; };
+    struct Health { float value; };
+
+    static void populateWorld(scene::World& world)
+    {
+        for (uint32_t i = 0; i < cSceneEntities; ++i)
+        {
+            //  Spread entities over two archetypes
+            if (i % 2 == 0)
+                world.createEntity(Position{}, Velocity{1.0f, 0.0f, 0.0f});
+            else
+                world.createEntity(Position{}, Velocity{0.0f, 1.0f, 0.0f}, Health{100.0f});
+        }
+    }
+
+    static void integratePositions(const scene::Entity, Position& position, const Velocity& velocity)
+    {
+        position.x += velocity.x * 0.016f;
+        position.y += velocity.y * 0.016f;
+        position.z += velocity.z * 0.016f;
+    }
+
+    //  Times are per pass over all entities
+    static void sceneQueryForEach(BenchmarkState& state)
+    {
+        scene::World world;
+        populateWorld(world);
+        scene::Query<Position, const Velocity> query{world};
+
+        for (uint64_t i = 0; i < state.getIterations(); ++i)
+            query.forEach(integratePositions);
+
+        doNotOptimize(world.getEntityCount());
+    }
+
+    static void sceneQueryParallelForEach(BenchmarkState& state)
+    {
+        state.pauseTiming();
+        threads::JobSystem job_system{std::max(std::thread::hardware_concurrency(), 2u) - 1};
+
+        scene::World world;
+        populateWorld(world);
+        scene::Query<Position, const Velocity> query{world};
+        state.resumeTiming();
+
+        for (uint64_t i = 0; i < state.getIterations(); ++i)
+            query.parallelForEach(integratePositions);
+
+        doNotOptimize(world.getEntityCount());
+        state.pauseTiming();
+    }
+
+    //  Times are per entity
+    static void sceneWorldCreateDestroy(BenchmarkState& state)
+    {
+        scene::World world;
+        std::vector<scene::Entity> entities(cSceneEntities);
+
+        for (uint64_t i = 0; i < state.getIterations(); ++i)
+        {
+            auto& entity = entities[i % cSceneEntities];
+            if (world.isAlive(entity))
+                world.destroyEntity(entity);
+
+            entity = world.createEntity(Position{}, Velocity{});
+        }
+    }
+
+    //  Every entity moves to archetype with Health and back, times are per pass over all entities
+    static void sceneCommandBufferAddRemove(BenchmarkState& state)
+    {
+        scene::World world;
+        populateWorld(world);
+
+        scene::Query<const Velocity> query{world};
+        scene::EntityCommandBuffer command_buffer;
+
+        for (uint64_t i = 0; i < state.getIterations(); ++i)
+        {
+            query.forEach([&command_buffer](const scene::Entity entity, const Velocity&) { command_buffer.addComponent<Health>(entity, 50.0f); });
+            command_buffer.playback(world);
+
+            query.forEach([&command_buffer](const scene::Entity entity, const Velocity&) { command_buffer.removeComponent<Health>(entity); });
+            command_buffer.playback(world);
+        }
+    }
+
+    static std::vector<scene::TransformHandle> populateHierarchy(scene::TransformHierarchy& hierarchy)
+    {
+        std::vector<scene::TransformHandle> transforms;
+        transforms.reserve(cSceneEntities);
+
+        transforms.push_back(hierarchy.createTransform());
+        for (uint32_t i = 1; i < cSceneEntities; ++i)
+            transforms.push_back(hierarchy.createTransform(transforms[(i - 1) / cTransformChildren], glm::vec3{1.0f, 0.0f, 0.0f}));
+
+        hierarchy.update();
+        return transforms;
+    }
+
+    //  Root moves every frame, times are per update of whole hierarchy
+    static void transformHierarchyUpdateAll(BenchmarkState& state)
+    {
+        scene::TransformHierarchy hierarchy;
+        const auto transforms = populateHierarchy(hierarchy);
+
+        for (uint64_t i = 0; i < state.getIterations(); ++i)
+        {
+            hierarchy.setTranslation(transforms.front(), glm::vec3{static_cast<float>(i), 0.0f, 0.0f});
+            hierarchy.update();
+        }
+
+        doNotOptimize(hierarchy.getWorldMatrices().data());
+    }
+
+    //  Every 64th node of deepest levels moves, only their slots are recomputed
+    static void transformHierarchyUpdateSparse(BenchmarkState& state)
+    {
+        scene::TransformHierarchy hierarchy;
+        const auto transforms = populateHierarchy(hierarchy);
+
+        for (uint64_t i = 0; i < state.getIterations(); ++i)
+        {
+            for (uint32_t leaf = cSceneEntities - 1; leaf > cSceneEntities / 2; leaf -= 64)
+                hierarchy.setTranslation(transforms[leaf], glm::vec3{static_cast<float>(i), 0.0f, 0.0f});
+            hierarchy.update();
+        }
+
+        doNotOptimize(hierarchy.getWorldMatrices().data());
+    }
+
+    NB_BENCHMARK("scene/Query/for_each", sceneQueryForEach);
+    NB_BENCHMARK("scene/Query/parallel_for_each", sceneQueryParallelForEach);
+    NB_BENCHMARK("scene/World/create_destroy", sceneWorldCreateDestroy);
+    NB_BENCHMARK("scene/EntityCommandBuffer/add_remove", sceneCommandBufferAddRemove);
+    NB_BENCHMARK("scene/TransformHierarchy/update_all", transformHierarchyUpdateAll);
+    NB_BENCHMARK("scene/TransformHierarchy/update_sparse", transformHierarchyUpdateSparse);
+
+}
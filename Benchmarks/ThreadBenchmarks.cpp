@@ -0,0 +1,94 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include <ctime>
+#include <format>
+#include <thread>
+#include <algorithm>
+
+#include "Benchmark.h"
+#include "core/Timer.h"
+#include "threads/BlockingQueue.h"
+
+namespace nebula::bench {
+
+    //  Capacity of frames in flight queue, producer blocks often
+    static constexpr std::size_t cQueueCapacity = 3;
+
+    static constexpr double cFramePacerInterval = 0.002;
+
+    static void blockingQueueUncontended(BenchmarkState& state)
+    {
+        threads::BlockingQueue<uint64_t, cQueueCapacity> queue;
+
+        for (uint64_t i = 0; i < state.getIterations(); ++i)
+        {
+            queue.push(std::move(i));
+            doNotOptimize(queue.pop());
+        }
+    }
+
+    static void blockingQueueProducerConsumer(BenchmarkState& state)
+    {
+        threads::BlockingQueue<uint64_t, cQueueCapacity> queue;
+
+        state.pauseTiming();
+        std::thread producer{[&queue, iterations = state.getIterations()]
+        {
+            for (uint64_t i = 0; i < iterations; ++i)
+                queue.push(std::move(i));
+        }};
+        state.resumeTiming();
+
+        for (uint64_t i = 0; i < state.getIterations(); ++i)
+            doNotOptimize(queue.pop());
+
+        state.pauseTiming();
+        producer.join();
+    }
+
+    //  Precise sleeps of frame pacer, counters compare CPU cost and deadline misses of fixed and learned spin margin
+    template<bool Adaptive>
+    static void framePacerSleep(BenchmarkState& state)
+    {
+        Timer::setAdaptiveBusyOffset(Adaptive);
+        Timer::resetSleepStats();
+        const std::clock_t cpu_start = std::clock();
+        Timer wall_timer;
+
+        for (uint64_t i = 0; i < state.getIterations(); ++i)
+        {
+            if constexpr (Adaptive)
+                Timer::sleepPrecise(cFramePacerInterval);
+            else
+                Timer::sleepPrecise(cFramePacerInterval, Timer::cDefaultBusyOffset);
+        }
+
+        const double wall_seconds = wall_timer.elapsedSeconds();
+        const double cpu_seconds = static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+        const SleepStats stats = Timer::getSleepStats();
+        const auto sleeps = static_cast<double>(std::max<uint64_t>(stats.sleeps, 1));
+
+        state.setCounter("cpu_utilization", cpu_seconds / wall_seconds);
+        state.setCounter("spin_utilization", stats.spinUtilization());
+        state.setCounter("deadline_miss_rate", static_cast<double>(stats.deadline_misses) / sleeps);
+        for (std::size_t bucket = 0; bucket < SleepStats::cMissBuckets; ++bucket)
+        {
+            const bool bounded = bucket < SleepStats::cMissBucketBounds.size();
+            const double bound_us = (bounded ? SleepStats::cMissBucketBounds[bucket] : SleepStats::cMissBucketBounds.back()) * 1e6;
+            state.setCounter(std::format("misses_{}_{:04.0f}us", bounded ? "below" : "above", bound_us), static_cast<double>(stats.miss_histogram[bucket]));
+        }
+        state.setCounter("mean_overshoot_us", stats.overshoot_seconds / sleeps * 1e6);
+        state.setCounter("busy_offset_us", stats.busy_offset * 1e6);
+
+        Timer::setAdaptiveBusyOffset(true);
+    }
+
+    NB_BENCHMARK("threads/BlockingQueue/uncontended", blockingQueueUncontended);
+    NB_BENCHMARK("threads/BlockingQueue/producer_consumer", blockingQueueProducerConsumer);
+    NB_BENCHMARK("threads/FramePacer/sleep_fixed_offset", framePacerSleep<false>);
+    NB_BENCHMARK("threads/FramePacer/sleep_adaptive_offset", framePacerSleep<true>);
+
+}
@@ -0,0 +1,144 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include <string>
+#include <format>
+#include <iostream>
+#include <string_view>
+
+#include "Benchmark.h"
+#include "FrameBenchmark.h"
+
+#include "core/Config.h"
+#include "core/Logging.h"
+#include "memory/MemoryManager.h"
+
+//  Own entry point instead of core/EntryPoint.h, benchmarks run before and without Application
+void initSubsystems()
+{
+    nebula::logging::initCore();
+    nebula::memory::MemoryManager::init();
+}
+
+void shutdownSubsystems()
+{
+    nebula::logging::shutdown();
+    nebula::memory::MemoryManager::shutdown();
+}
+
+static void printUsage()
+{
+    std::cout <<
+        "Usage: nebula_bench [options]\n"
+        "  --list                      List micro benchmarks\n"
+        "  --filter <text>             Run only benchmarks containing text\n"
+        "  --samples <n>               Samples per micro benchmark (default 10)\n"
+        "  --min-time <seconds>        Minimal duration of single sample (default 0.05)\n"
+        "  --frames <n>                Also run n full engine frames (default 0, disabled)\n"
+        "  --warmup-frames <n>         Frames dropped before measuring (default 120)\n"
+        "  --api <vulkan|opengl>       Rendering API of frame benchmark (default vulkan)\n"
+        "  --out <file.json>           Write JSON report\n"
+        "  --compare <baseline.json>   Compare results against baseline report\n"
+        "  --threshold <percent>       Regression threshold of compare mode (default 5)\n"
+        "\n"
+        "nebula_bench --compare <baseline.json> <current.json> compares two reports without running.\n"
+        "Exit code is 1 when any benchmark regressed.\n"
+        "\n"
+        "Frame benchmark needs a display, on CPU only machines run it with lavapipe:\n"
+        "  VK_ICD_FILENAMES=/usr/share/vulkan/icd.d/lvp_icd.x86_64.json xvfb-run nebula_bench --frames 1000\n";
+}
+
+int main(int argc, char** argv)
+{
+    using namespace nebula;
+
+    bench::BenchmarkSettings settings;
+    bench::FrameBenchmarkSettings frame_settings;
+    frame_settings.frames = 0;
+
+    std::string report_path;
+    std::string baseline_path;
+    std::string current_path;
+    double threshold = 5.0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view argument = argv[i];
+        const bool has_value = i + 1 < argc;
+
+        if (argument == "--help" || argument == "-h")
+        {
+            printUsage();
+            return 0;
+        }
+        if (argument == "--list")
+        {
+            for (const auto& name : bench::BenchmarkRunner::getNames())
+                std::cout << name << '\n';
+            return 0;
+        }
+
+        if (argument == "--filter" && has_value)
+            settings.filter = argv[++i];
+        else if (argument == "--samples" && has_value)
+            settings.samples = std::max(1, std::stoi(argv[++i]));
+        else if (argument == "--min-time" && has_value)
+            settings.min_sample_time = std::stod(argv[++i]);
+        else if (argument == "--frames" && has_value)
+            frame_settings.frames = std::stoul(argv[++i]);
+        else if (argument == "--warmup-frames" && has_value)
+            frame_settings.warmup_frames = std::stoul(argv[++i]);
+        else if (argument == "--api" && has_value)
+            frame_settings.api = std::string_view(argv[++i]) == "opengl" ? rendering::API::cOpenGL : rendering::API::cVulkan;
+        else if (argument == "--out" && has_value)
+            report_path = argv[++i];
+        else if (argument == "--compare" && has_value)
+        {
+            baseline_path = argv[++i];
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+                current_path = argv[++i];
+        }
+        else if (argument == "--threshold" && has_value)
+            threshold = std::stod(argv[++i]);
+        else
+        {
+            std::cerr << std::format("Unknown or incomplete argument {}\n", argument);
+            printUsage();
+            return 2;
+        }
+    }
+
+    //  Offline compare of two existing reports
+    if (!baseline_path.empty() && !current_path.empty())
+        return bench::compareReports(bench::readReport(baseline_path), bench::readReport(current_path), threshold) > 0 ? 1 : 0;
+
+    Config engine_config("engine_config.yaml");
+    Config::setEngineConfig(engine_config);
+
+    initSubsystems();
+
+    auto results = bench::BenchmarkRunner::run(settings);
+
+    if (frame_settings.frames > 0)
+    {
+        auto application = createScope<bench::FrameBenchmarkApplication>(frame_settings);
+        application->run();
+
+        const auto& frame_results = application->viewResults();
+        results.insert(results.end(), frame_results.begin(), frame_results.end());
+    }
+
+    shutdownSubsystems();
+
+    bench::printResults(results);
+
+    if (!report_path.empty())
+        bench::writeReport(report_path, results);
+
+    if (!baseline_path.empty())
+        return bench::compareReports(bench::readReport(baseline_path), results, threshold) > 0 ? 1 : 0;
+
+    return 0;
+}
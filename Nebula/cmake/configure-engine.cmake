@@ -5,4 +5,8 @@ set(NEBULA_PATCH_VERSION 0)
 set(NEBULA_INITIALIZATION_VERBOSITY 2)  # 0 - No messages, 1 - low, 2 - normal, 3 - high
 set(NEBULA_RESOURCES_DIRECTORY "resources")
 
+option(NEBULA_ENABLE_PROFILING "Compile CPU profiler zones into engine" ON)
+option(NEBULA_ALLOCATION_GUARD "Report heap allocations of update and render threads after warm-up" OFF)
+option(NEBULA_GL_STATE_VALIDATION "Compare OpenGL state cache against glGet on every skipped call" OFF)
+
 configure_file(include/platform/EngineConfiguration.h.in include/platform/EngineConfiguration.h @ONLY)
\ No newline at end of file
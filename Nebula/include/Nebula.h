@@ -25,6 +25,10 @@
 #include "rendering/renderer/Renderer.h"
 #include "rendering/renderpass/RenderPass.h"
 
+#include "scene/World.h"
+#include "scene/Query.h"
+#include "scene/EntityCommandBuffer.h"
+
 //  Entry point
 #include "core/EntryPoint.h"
 
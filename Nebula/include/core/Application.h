@@ -7,12 +7,14 @@
 #define NEBULAENGINE_APPLICATION_H
 
 #include <mutex>
+#include <atomic>
 #include <string>
 #include <vector>
 #include <optional>
 
 #include "Core.h"
 #include "Timer.h"
+#include "Config.h"
 #include "Input.h"
 #include "Window.h"
 #include "LayerStack.h"
@@ -21,6 +23,9 @@
 #include "events/EventManager.h"
 #include "events/ApplicationEvents.h"
 
+#include "debug/FrameStats.h"
+
+#include "threads/JobSystem.h"
 #include "threads/SecondaryThread.h"
 #include "utility/Filesystem.h"
 
@@ -35,13 +40,6 @@ namespace nebula {
 
     }
 
-    namespace rendering {
-
-        class VulkanRecordCommandsVisitor;
-        class OpenGlExecuteCommandsVisitor;
-
-    }
-
     struct ApplicationVersion
     {
         uint16_t major;
@@ -71,8 +69,14 @@ namespace nebula {
 
         void close();
         bool closed() const { return !m_running; }
-        bool minimized() const { return m_minimized; }
-        void minimize(const bool minimized) { std::lock_guard lock{m_mutex}; m_minimized = minimized; }
+        bool minimized() const { return m_minimized.load(); }
+        bool focused() const { return m_focused.load(); }
+
+        //  Blocks calling thread while application is minimized, returns wake-up latency in seconds
+        double waitWhileMinimized() const;
+
+        //  Frame rate limit after background throttling, 0 means unlimited
+        [[nodiscard]] uint32_t getFpsLimit(uint32_t render_fps) const;
 
         ///////////////////////////////////////////////////////////////////////////////////
         /////  Properties  ////////////////////////////////////////////////////////////////
@@ -109,14 +113,27 @@ namespace nebula {
         Scope<Layer> popOverlay(const LayerStack::LayerID layer_id) { return m_layer_stack.popOverlay(layer_id); }
 
     private:
-        void run() const;
+        void run();
+
+        void updateWindowState();
+        void notifyWindowStateChanged();
 
         void onEvent(Event& event);
         bool onWindowClose(WindowCloseEvent& e);
         bool onWindowResize(WindowResizeEvent& e);
+        void onSettingsReloaded(const EngineSettings& settings);
+
+        std::atomic_bool m_running = true;     //  Read by secondary threads waiting while minimized
+        std::atomic_bool m_close_requested = false;
+
+        //  Window state is polled by main thread, generation is bumped on every change
+        std::atomic_bool m_minimized = false;
+        std::atomic_bool m_focused = true;
+        std::atomic_uint32_t m_window_state_generation = 0;
+        std::atomic_int64_t m_window_state_change_time = 0;     //  Steady clock nanoseconds
 
-        bool m_running = true;
-        bool m_minimized = false;
+        Config::SubscriptionID m_settings_subscription = 0;
+        std::string m_frame_stats_csv{};
 
         Scope<Input> m_input;
         Scope<Window> m_window;
@@ -127,6 +144,8 @@ namespace nebula {
 
         //  Threads
         std::mutex m_mutex;
+        Scope<FrameStats> m_frame_stats;
+        Scope<threads::JobSystem> m_job_system;
         std::vector<Scope<threads::SecondaryThread>> m_threads;
 
         void createThreads();
@@ -135,8 +154,6 @@ namespace nebula {
 
         friend class nebula::threads::MainUpdateThread;
         friend class nebula::threads::MainRenderThread;
-        friend class nebula::rendering::VulkanRecordCommandsVisitor;
-        friend class nebula::rendering::OpenGlExecuteCommandsVisitor;
 
         static Application* s_instance;
         friend int ::main(int argc, char** argv);
@@ -6,9 +6,16 @@
 #ifndef CONFIG_H
 #define CONFIG_H
 
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <functional>
+
 #include <yaml-cpp/yaml.h>
 
 #include "Core.h"
+#include "EngineSettings.h"
 
 int main(int argc, char** argv);
 
@@ -28,14 +35,33 @@ namespace nebula {
         YAML::Node& getConfig() { return m_config; }
         static const YAML::Node& getEngineConfig() { return s_instance->getConfig(); }
 
+        //  Lock free, returned snapshot stays valid until engine shutdown, hot paths should use it instead of YAML lookups
+        static const EngineSettings& getEngineSettings() { return *s_engine_settings.load(std::memory_order_acquire); }
+
+        //  Callbacks run on thread that reloaded config, after new snapshot is published
+        using SubscriptionID = uint32_t;
+        using SettingsCallback = std::function<void(const EngineSettings& settings)>;
+
+        static SubscriptionID subscribe(SettingsCallback callback);
+        static void unsubscribe(SubscriptionID subscription);
+
     private:
         YAML::Node m_config;
 
         static void setEngineConfig(Config& config);
         static void reloadEngineConfig(const std::string& path);
+        static void publishEngineSettings();
         static YAML::Node defaultEngineConfig();
 
         static Config* s_instance;
+
+        //  Readers may still hold previous snapshots, so they are retired instead of deleted
+        static std::atomic<const EngineSettings*> s_engine_settings;
+        static std::vector<Scope<const EngineSettings>> s_settings_snapshots;
+
+        static std::mutex s_settings_mutex;
+        static std::map<SubscriptionID, SettingsCallback> s_subscribers;
+        static SubscriptionID s_next_subscription;
         friend class nebula::Application;
         friend int ::main(int argc, char** argv);
     };
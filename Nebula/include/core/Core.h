@@ -14,6 +14,8 @@
     #else
         #define NEBULA_API __declspec(dllimport)
     #endif
+#elif defined(NB_PLATFORM_LINUX)
+    #define NEBULA_API __attribute__((visibility("default")))
 #else
     #error "Unsupported platform!"
 #endif
@@ -0,0 +1,73 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef ENGINESETTINGS_H
+#define ENGINESETTINGS_H
+
+#include <string>
+
+#include <yaml-cpp/yaml.h>
+
+#include "Core.h"
+#include "memory/Types.h"
+
+namespace nebula {
+
+    struct NEBULA_API MemorySettings
+    {
+        std::size_t event_queue_size = 1_Mb;
+        std::size_t render_command_buffer_size = 100_Kb;
+        std::size_t staging_buffer_size = 32_Mb;
+        std::size_t stream_buffer_size = 4_Mb;     //  OpenGL streaming region of single frame in flight
+    };
+
+    struct NEBULA_API RenderingSettings
+    {
+        std::string cache_path = "cache/rendering";
+        uint32_t frames_in_flight = 2;
+        bool gpu_profiler = true;
+        bool vulkan_dynamic_rendering = false;
+        bool parallel_recording = true;
+        uint32_t recording_chunk_size = 64;
+    };
+
+    struct NEBULA_API ThreadsSettings
+    {
+        bool adaptive_sleep = true;
+        uint32_t background_fps = 0;
+        uint32_t max_fixed_updates = 5;
+        uint32_t job_workers = 0;
+    };
+
+    struct NEBULA_API DebugSettings
+    {
+        std::string frame_stats_csv{};
+        uint32_t allocation_guard_warmup_frames = 240;
+    };
+
+    struct NEBULA_API ResourcesSettings
+    {
+        std::string resources_directory{};  //  Empty means NEBULA_RESOURCES_DIRECTORY
+    };
+
+    //  Typed snapshot of engine config, parsed once per load or reload and never modified after publication
+    struct NEBULA_API EngineSettings
+    {
+        uint64_t version = 0;   //  Bumped by every published snapshot
+
+        MemorySettings memory{};
+        RenderingSettings rendering{};
+        ThreadsSettings threads{};
+        DebugSettings debug{};
+        ResourcesSettings resources{};
+
+        //  Missing sections and keys keep default values
+        static EngineSettings fromYaml(const YAML::Node& config);
+        [[nodiscard]] YAML::Node toYaml() const;
+    };
+
+}
+
+#endif //ENGINESETTINGS_H
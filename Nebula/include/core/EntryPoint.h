@@ -15,7 +15,7 @@
 void initSubsystems();
 void shutdownSubsystems();
 
-#ifdef NB_PLATFORM_WINDOWS
+#if defined(NB_PLATFORM_WINDOWS) || defined(NB_PLATFORM_LINUX)
 
 int main(int argc, char** argv)
 {
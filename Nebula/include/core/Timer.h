@@ -6,12 +6,39 @@
 #ifndef NEBULAENGINE_TIMER_H
 #define NEBULAENGINE_TIMER_H
 
+#include <array>
+
 #include "core/Core.h"
 
 namespace nebula {
 
     void system_sleep(double seconds); //  Implemented in platform/DetectPlatform.cpp
 
+    //  Statistics of precise sleeps performed by calling thread
+    struct NEBULA_API SleepStats
+    {
+        //  Upper bounds of deadline miss histogram buckets in seconds, last bucket is unbounded
+        static constexpr std::array<double, 7> cMissBucketBounds = {50e-6, 100e-6, 250e-6, 500e-6, 1e-3, 2e-3, 4e-3};
+        static constexpr std::size_t cMissBuckets = cMissBucketBounds.size() + 1;
+
+        uint64_t sleeps = 0;
+        uint64_t overruns = 0;          //  Deadline already passed before sleeping
+        uint64_t deadline_misses = 0;   //  System sleep woke up after deadline
+        std::array<uint64_t, cMissBuckets> miss_histogram{};
+
+        double slept_seconds = 0.0;
+        double spun_seconds = 0.0;
+        double overshoot_seconds = 0.0; //  Summed time between deadline and return from sleep
+        double busy_offset = 0.0;       //  Spin margin used by last sleep
+
+        //  Fraction of waiting time spent burning CPU in spin-lock
+        [[nodiscard]] double spinUtilization() const
+        {
+            const double waited_seconds = slept_seconds + spun_seconds;
+            return waited_seconds > 0.0 ? spun_seconds / waited_seconds : 0.0;
+        }
+    };
+
     class NEBULA_API Timer
     {
     public:
@@ -42,8 +69,21 @@ namespace nebula {
         static void sleep(double seconds);
         static void sleepUntil(double application_time);
 
-        static void sleepPrecise(double seconds, double busy_offset = 0.001);
-        static void sleepUntilPrecise(double application_time, double busy_offset = 0.001);
+        static constexpr double cDefaultBusyOffset = 0.001;
+        static constexpr double cMinBusyOffset = 0.000'050;
+        static constexpr double cMaxBusyOffset = 0.004;
+
+        //  Spin margin is learned from measured wake-up jitter of calling thread, unless adaptive mode is disabled
+        static void sleepPrecise(double seconds);
+        static void sleepUntilPrecise(double application_time);
+
+        static void sleepPrecise(double seconds, double busy_offset);
+        static void sleepUntilPrecise(double application_time, double busy_offset);
+
+        //  Thread local settings and statistics
+        static void setAdaptiveBusyOffset(bool adaptive);
+        [[nodiscard]] static SleepStats getSleepStats();
+        static void resetSleepStats();
 
     private:
         std::chrono::time_point<std::chrono::high_resolution_clock> m_start{};
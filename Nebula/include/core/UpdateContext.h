@@ -27,6 +27,14 @@ namespace nebula {
         [[nodiscard]] Timestep getUpdateTimestep() const { return Timestep(m_current_update_timestep.load()); }
         [[nodiscard]] std::atomic_uint32_t getCurrentUpdateFrame() const { return m_current_update_frame.load(); }
 
+        //  Fixed updates per frame above limit are dropped, simulation slows down instead of spiraling
+        void setMaxFixedUpdates(const uint32_t max_fixed_updates) { m_max_fixed_updates.store(max_fixed_updates); }
+        [[nodiscard]] uint32_t getMaxFixedUpdates() const { return m_max_fixed_updates.load(); }
+        [[nodiscard]] double getDroppedUpdateTime() const { return m_dropped_update_time.load(); }
+
+        //  Fraction of fixed timestep left in accumulator after last update, used for render interpolation
+        [[nodiscard]] double getInterpolationAlpha() const { return m_interpolation_alpha.load(); }
+
         static UpdateContext& get() { return *s_instance; }
 
     private:
@@ -34,6 +42,10 @@ namespace nebula {
 
         std::atomic_uint32_t m_current_update_frame;
         std::atomic<double> m_current_update_timestep = 0.02;
+        std::atomic_uint32_t m_max_fixed_updates = 5;
+
+        std::atomic<double> m_interpolation_alpha = 0.0;
+        std::atomic<double> m_dropped_update_time = 0.0;
 
         Timer m_application_timer;
 
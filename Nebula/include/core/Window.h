@@ -41,6 +41,10 @@ namespace nebula {
         [[nodiscard]] virtual uint32_t getHeight() const = 0;
         [[nodiscard]] virtual WindowProperties getProperties() const = 0;
 
+        [[nodiscard]] virtual bool checkMinimized() const = 0;
+        [[nodiscard]] virtual bool checkFocused() const = 0;
+        [[nodiscard]] virtual bool checkCloseRequested() const = 0;
+
         virtual void setProperties(const WindowProperties& window_properties) = 0;
 
         [[nodiscard]] virtual void* getWindowHandle() const = 0;
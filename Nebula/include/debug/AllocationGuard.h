@@ -0,0 +1,42 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef ALLOCATIONGUARD_H
+#define ALLOCATIONGUARD_H
+
+#include <cstddef>
+
+#include "core/Core.h"
+
+namespace nebula {
+
+    //  Reports heap allocations of guarded threads, hooks are compiled in only with NB_ALLOCATION_GUARD
+    class NEBULA_API AllocationGuard
+    {
+    public:
+        static constexpr uint32_t cMaxReports = 32;     //  Later allocations are only counted
+
+        //  Called by update and render threads once warm-up frames filled their caches
+        static void guardThread(const char* thread_name);
+        static void releaseThread();
+
+        static void onAllocation(std::size_t size, const char* source);
+        [[nodiscard]] static uint64_t getAllocationCount();
+
+        //  Marks allocations that are expected on guarded thread
+        class NEBULA_API Suppress
+        {
+        public:
+            Suppress();
+            ~Suppress();
+
+            Suppress(const Suppress&) = delete;
+            Suppress& operator = (const Suppress&) = delete;
+        };
+    };
+
+}
+
+#endif //ALLOCATIONGUARD_H
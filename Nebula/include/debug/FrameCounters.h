@@ -0,0 +1,73 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef FRAMECOUNTERS_H
+#define FRAMECOUNTERS_H
+
+#include <array>
+#include <atomic>
+#include <optional>
+#include <string_view>
+
+#include "core/Core.h"
+
+namespace nebula {
+
+    enum class FrameCounter : uint32_t
+    {
+        cRenderCommands,
+        cRenderCommandBytes,
+        cDrawCalls,
+        cPipelineBinds,
+        cMemoryRequests,
+        cMemoryRequestBytes,
+        cEventsDispatched,
+        cLayersUpdated,
+        cGlStateCallsSkipped,
+        cTransformsUpdated,
+        cObjectsVisible,
+        cObjectsCulled,
+        cObjectsOccluded,
+
+        cCount
+    };
+
+    //  Monotonic per thread counters, only owning thread writes so increments need no read-modify-write
+    class NEBULA_API FrameCounters
+    {
+    public:
+        static constexpr uint32_t cCounterCount = static_cast<uint32_t>(FrameCounter::cCount);
+
+        struct ThreadCounters
+        {
+            std::array<std::atomic_uint64_t, cCounterCount> values{};
+
+            ThreadCounters();
+            ~ThreadCounters();
+        };
+
+        static void increment(FrameCounter counter, const uint64_t value = 1)
+        {
+            auto& thread_value = getThreadCounters().values[static_cast<uint32_t>(counter)];
+            thread_value.store(thread_value.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        //  Called once per frame by render thread, turns running totals of all threads into frame values
+        static void aggregateFrame();
+
+        [[nodiscard]] static uint64_t getFrameValue(FrameCounter counter);
+        [[nodiscard]] static std::optional<uint64_t> getFrameValue(std::string_view name);
+
+        static const char* getCounterName(FrameCounter counter);
+
+    private:
+        static ThreadCounters& getThreadCounters();
+    };
+
+}
+
+#define NB_COUNT(counter, value) ::nebula::FrameCounters::increment(::nebula::FrameCounter::counter, value)
+
+#endif //FRAMECOUNTERS_H
@@ -0,0 +1,125 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef FRAMESTATS_H
+#define FRAMESTATS_H
+
+#include <array>
+#include <mutex>
+#include <fstream>
+
+#include "core/Core.h"
+#include "utility/Filesystem.h"
+
+namespace nebula {
+
+    //  Log-linear histogram over microseconds in fixed memory, relative error stays below 1.6%
+    class NEBULA_API FrameHistogram
+    {
+    public:
+        static constexpr uint32_t cSubBucketBits = 7;
+        static constexpr uint32_t cSubBuckets = 1 << cSubBucketBits;
+        static constexpr uint32_t cMaxValueBits = 27;   //  Values above ~134 seconds are clamped
+        static constexpr uint32_t cBuckets = cSubBuckets + (cMaxValueBits - cSubBucketBits) * (cSubBuckets / 2);
+
+        void record(double seconds);
+        void reset();
+
+        [[nodiscard]] double getPercentile(double percentile) const;
+        [[nodiscard]] double getMean() const { return m_count > 0 ? m_sum / static_cast<double>(m_count) : 0.0; }
+        [[nodiscard]] double getMax() const { return m_max; }
+        [[nodiscard]] uint64_t getCount() const { return m_count; }
+
+    private:
+        std::array<uint32_t, cBuckets> m_buckets{};
+        uint64_t m_count = 0;
+        double m_sum = 0.0;
+        double m_max = 0.0;
+
+        static uint32_t getBucket(uint64_t microseconds);
+        static double getBucketValue(uint32_t bucket);
+    };
+
+    enum class FrameMetric : uint32_t
+    {
+        cUpdateCpu,
+        cUpdateSleep,
+        cRenderCpu,
+        cFenceWait,
+        cPresent,
+        cRenderSleep,
+        cFrameTime,
+
+        cCount
+    };
+
+    //  All values in milliseconds, percentiles cover every frame since last reset
+    struct NEBULA_API FrameMetricSummary
+    {
+        double last = 0.0;
+        double window_mean = 0.0;
+        double window_max = 0.0;
+
+        double p50 = 0.0;
+        double p95 = 0.0;
+        double p99 = 0.0;
+        double max = 0.0;
+    };
+
+    class NEBULA_API FrameStats
+    {
+    public:
+        static constexpr uint32_t cMetricCount = static_cast<uint32_t>(FrameMetric::cCount);
+        static constexpr uint32_t cRollingWindow = 240;
+
+        FrameStats();
+        ~FrameStats();
+
+        FrameStats(const FrameStats&) = delete;
+        FrameStats& operator = (const FrameStats&) = delete;
+
+        //  Update and render threads feed their own metrics, render thread closes every frame and aggregates FrameCounters
+        void record(FrameMetric metric, double seconds);
+        void endFrame();
+        void reset();
+
+        [[nodiscard]] FrameMetricSummary getSummary(FrameMetric metric) const;
+        [[nodiscard]] std::array<float, cRollingWindow> getRollingWindow(FrameMetric metric) const;    //  Oldest first, milliseconds
+        [[nodiscard]] uint64_t getFrameCount() const;     //  Frames ended since creation, not affected by reset
+
+        //  One row per frame with last value of every metric and frame counter
+        void startCsvRecording(const filesystem::Path& path);
+        void stopCsvRecording();
+        [[nodiscard]] bool checkCsvRecording() const;
+
+        static const char* getMetricName(FrameMetric metric);
+
+        static bool checkEnabled() { return s_instance != nullptr; }
+        static FrameStats& get() { return *s_instance; }
+
+    private:
+        struct MetricHistory
+        {
+            FrameHistogram histogram{};
+            std::array<double, cRollingWindow> window{};
+            uint32_t window_size = 0;
+            uint32_t next_sample = 0;
+            double last = 0.0;
+        };
+
+        mutable std::mutex m_mutex;
+        std::array<MetricHistory, cMetricCount> m_metrics{};
+
+        uint64_t m_frame = 0;
+        std::ofstream m_csv_file;
+
+        void writeCsvHeader();
+
+        static FrameStats* s_instance;
+    };
+
+}
+
+#endif //FRAMESTATS_H
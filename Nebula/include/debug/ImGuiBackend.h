@@ -9,6 +9,8 @@
 #include "rendering/renderpass/RenderPass.h"
 #include "rendering/commands/RenderCommandBuffer.h"
 
+struct ImDrawData;
+
 namespace nebula {
 
     namespace threads { class MainRenderThread; }
@@ -21,8 +23,9 @@ namespace nebula {
         virtual void onAttach() = 0;
         virtual void onDetach() = 0;
 
-        virtual void begin() = 0;
-        virtual void end(void* command_buffer_handle) = 0;
+        //  Render thread only, ImGui frame itself is built by update thread
+        virtual void newFrame() = 0;
+        virtual void renderDrawData(ImDrawData& draw_data, void* command_buffer_handle) = 0;
 
         static Scope<ImGuiBackend> create(rendering::RenderPass& renderpass);
 
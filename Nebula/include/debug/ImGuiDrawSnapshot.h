@@ -0,0 +1,60 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef IMGUIDRAWSNAPSHOT_H
+#define IMGUIDRAWSNAPSHOT_H
+
+#include <array>
+#include <atomic>
+
+#include <imgui.h>
+
+namespace nebula {
+
+    //  Deep copy of ImDrawData, draw lists keep their capacity so steady state capture does not allocate.
+    //  Render thread may draw same snapshot for several frames, so its memory can't come from per frame arena.
+    class ImGuiDrawSnapshot
+    {
+    public:
+        ImGuiDrawSnapshot() = default;
+        ~ImGuiDrawSnapshot();
+
+        ImGuiDrawSnapshot(const ImGuiDrawSnapshot&) = delete;
+        ImGuiDrawSnapshot& operator = (const ImGuiDrawSnapshot&) = delete;
+
+        void capture(const ImDrawData& source);
+        [[nodiscard]] ImDrawData& getDrawData() { return m_draw_data; }
+
+    private:
+        ImDrawData m_draw_data{};
+        ImVector<ImDrawList*> m_draw_lists{};   //  Owned, only first CmdListsCount are in use
+    };
+
+    //  Update thread writes and publishes, render thread acquires latest published snapshot.
+    //  Third slot lets both sides swap without waiting on each other.
+    class ImGuiDrawBuffer
+    {
+    public:
+        [[nodiscard]] ImGuiDrawSnapshot& getWriteSnapshot() { return m_snapshots[m_write_index]; }
+        void publish();
+
+        //  Keeps returning last snapshot until newer one is published, nullptr before first publish
+        [[nodiscard]] ImGuiDrawSnapshot* acquire();
+
+    private:
+        static constexpr uint32_t cFreshBit = 1 << 2;
+        static constexpr uint32_t cIndexMask = cFreshBit - 1;
+
+        std::array<ImGuiDrawSnapshot, 3> m_snapshots{};
+
+        uint32_t m_write_index = 0;     //  Update thread only
+        uint32_t m_read_index = 1;      //  Render thread only
+        std::atomic_uint32_t m_ready_index = 2;
+        bool m_has_snapshot = false;
+    };
+
+}
+
+#endif //IMGUIDRAWSNAPSHOT_H
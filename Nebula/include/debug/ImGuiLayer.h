@@ -14,6 +14,8 @@
 
 namespace nebula {
 
+    class ImGuiDrawBuffer;
+
     class ImGuiLayer : public Layer
     {
     public:
@@ -27,8 +29,14 @@ namespace nebula {
         void onImGuiRender() override;
         void reloadBackend(rendering::RenderPass& renderpass);
 
+        //  Update thread, builds ImGui frame of all layers and publishes deep copy of its draw data
         static void begin();
-        static void end(void* command_buffer_handle);
+        static void end();
+
+        //  Render thread, uploads and records latest published draw data
+        static void render(void* command_buffer_handle);
+
+        static bool checkEnabled() { return s_backend != nullptr; }
 
         void setBlockEvents(const bool block) { m_block_events = block; }
 
@@ -38,15 +46,18 @@ namespace nebula {
     private:
         bool m_block_events = true;
         Scope<ImGuiBackend> m_backend = nullptr;
+        Scope<ImGuiDrawBuffer> m_draw_buffer = nullptr;
 
         static int s_counter;
         static ImGuiBackend* s_backend;
+        static ImGuiDrawBuffer* s_draw_buffer;
 
         //  Debug ImGui windows
         void performanceOverlay();
         void fpsSection();
-
-        Timer m_frame_timer{};
+        void frameStatsSection();
+        void gpuTimingsSection();
+        void profilerSection();
     };
 
 }
@@ -0,0 +1,70 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <string>
+#include <chrono>
+
+#include "core/Core.h"
+#include "utility/Filesystem.h"
+
+namespace nebula {
+
+    class NEBULA_API Profiler
+    {
+    public:
+        //  Completed zones kept per thread, older zones are overwritten
+        static constexpr uint32_t cZonesPerThread = 1 << 16;
+
+        //  Writes Chrome trace JSON (viewable in Perfetto) after given number of frames is marked
+        static void captureFrames(uint32_t frames, const filesystem::Path& path);
+        [[nodiscard]] static bool checkCapturing();
+
+        static void markFrame();
+        static void setThreadName(const std::string& name);
+
+        //  Zone name has to outlive capture, string literals are expected
+        static void recordZone(const char* name, int64_t begin_nanoseconds, int64_t end_nanoseconds);
+
+        static int64_t now()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+    };
+
+    class ProfileScope
+    {
+    public:
+        explicit ProfileScope(const char* name) : m_name(name), m_begin(Profiler::now()) {}
+        ~ProfileScope() { Profiler::recordZone(m_name, m_begin, Profiler::now()); }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator = (const ProfileScope&) = delete;
+
+    private:
+        const char* m_name;
+        int64_t m_begin;
+    };
+
+}
+
+#define NB_PROFILE_CONCAT_IMPL(a, b) a##b
+#define NB_PROFILE_CONCAT(a, b) NB_PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef NB_ENABLE_PROFILING
+    #define NB_PROFILE_SCOPE(name) ::nebula::ProfileScope NB_PROFILE_CONCAT(nb_profile_scope_, __LINE__)(name)
+    #define NB_PROFILE_FUNCTION() NB_PROFILE_SCOPE(__FUNCTION__)
+    #define NB_PROFILE_THREAD(name) ::nebula::Profiler::setThreadName(name)
+    #define NB_PROFILE_FRAME() ::nebula::Profiler::markFrame()
+#else
+    #define NB_PROFILE_SCOPE(name)
+    #define NB_PROFILE_FUNCTION()
+    #define NB_PROFILE_THREAD(name)
+    #define NB_PROFILE_FRAME()
+#endif
+
+#endif //PROFILER_H
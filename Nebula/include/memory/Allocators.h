@@ -118,6 +118,39 @@ namespace nebula::memory {
         friend class ScopedAllocator;
     };
 
+    //  Fixed size blocks with intrusive free list, allocation and deallocation are O(1) in any order
+    class NEBULA_API PoolAllocator final : public impl::Allocator
+    {
+    public:
+        PoolAllocator() = default;
+        PoolAllocator(void* memory_chunk, std::size_t size, std::size_t block_size, std::uintptr_t block_alignment) noexcept;
+
+        PoolAllocator(const PoolAllocator&) = delete;
+        PoolAllocator& operator = (PoolAllocator&) = delete;
+        PoolAllocator(PoolAllocator&&) noexcept;
+        PoolAllocator& operator = (PoolAllocator&&) noexcept;
+
+        //  Size and alignment can't exceed block parameters
+        void* allocate(std::size_t size, std::uintptr_t alignment) override;
+        void deallocate(void* address) override;
+
+        [[nodiscard]] bool owns(const void* address) const;
+        [[nodiscard]] bool full() const { return m_free_list == nullptr; }
+
+        [[nodiscard]] std::size_t getBlockSize() const { return m_block_size; }
+        [[nodiscard]] std::size_t getBlockCount() const { return m_block_count; }
+        [[nodiscard]] std::size_t getFreeBlockCount() const { return m_free_block_count; }
+
+    private:
+        std::size_t m_block_size = 0;
+        std::uintptr_t m_block_alignment = 0;
+        std::size_t m_block_count = 0;
+        std::size_t m_free_block_count = 0;
+
+        void* m_first_block = nullptr;
+        void** m_free_list = nullptr;   //  Every free block stores address of next one
+    };
+
 }
 
 #endif //ALLOCATORS_H
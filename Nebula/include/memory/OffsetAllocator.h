@@ -0,0 +1,59 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef OFFSETALLOCATOR_H
+#define OFFSETALLOCATOR_H
+
+#include <map>
+#include <cstdint>
+
+#include "core/Core.h"
+
+namespace nebula::memory {
+
+    struct NEBULA_API OffsetAllocation
+    {
+        static constexpr uint64_t cInvalidOffset = ~0ull;
+
+        uint64_t offset = cInvalidOffset;
+        uint64_t size = 0;
+
+        [[nodiscard]] bool valid() const { return offset != cInvalidOffset; }
+    };
+
+    //  Manages ranges of externally owned memory, like GPU buffer, without touching it.
+    //  Best fit over free ranges sorted by size, freed ranges are merged with free neighbours.
+    //  Alignment doesn't have to be power of two, so ranges can start at multiples of vertex stride.
+    class NEBULA_API OffsetAllocator
+    {
+    public:
+        explicit OffsetAllocator(uint64_t capacity);
+
+        //  Returns invalid allocation if no free range fits
+        [[nodiscard]] OffsetAllocation allocate(uint64_t size, uint64_t alignment = 1);
+        void free(const OffsetAllocation& allocation);
+        void reset();
+
+        [[nodiscard]] uint64_t getCapacity() const { return m_capacity; }
+        [[nodiscard]] uint64_t getUsedSize() const { return m_used; }
+        [[nodiscard]] uint64_t getLargestFreeRange() const;
+        [[nodiscard]] uint32_t getFreeRangeCount() const { return static_cast<uint32_t>(m_free_by_offset.size()); }
+
+    private:
+        using SizeIterator = std::multimap<uint64_t, uint64_t>::iterator;
+
+        uint64_t m_capacity;
+        uint64_t m_used = 0;
+
+        std::map<uint64_t, SizeIterator> m_free_by_offset{};        //  Offset -> entry in m_free_by_size
+        std::multimap<uint64_t, uint64_t> m_free_by_size{};         //  Size -> offset
+
+        void insertFreeRange(uint64_t offset, uint64_t size);
+        void eraseFreeRange(std::map<uint64_t, SizeIterator>::iterator range);
+    };
+
+}
+
+#endif //OFFSETALLOCATOR_H
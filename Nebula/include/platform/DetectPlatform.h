@@ -20,7 +20,6 @@
 	#error "Android is not supported!"
 #elif defined(__linux__)
     #define NB_PLATFORM_LINUX
-	#error "Linux is not supported!"
 #else
     #error "Unknown platform!"
 #endif
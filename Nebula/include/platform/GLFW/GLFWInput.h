@@ -3,8 +3,8 @@
 // Github: https://github.com/michal-swiatek
 //
 
-#ifndef WINDOWSINPUT_H
-#define WINDOWSINPUT_H
+#ifndef GLFWINPUT_H
+#define GLFWINPUT_H
 
 #include <GLFW/glfw3.h>
 
@@ -12,10 +12,10 @@
 
 namespace nebula {
 
-    class WindowsInput final : public Input
+    class GLFWInput final : public Input
     {
     public:
-        explicit WindowsInput(const Window& window);
+        explicit GLFWInput(const Window& window);
 
         [[nodiscard]] bool isKeyPressedImplementation(Keycode key) const override;
 
@@ -30,4 +30,4 @@ namespace nebula {
 
 }
 
-#endif //WINDOWSINPUT_H
+#endif //GLFWINPUT_H
@@ -3,8 +3,8 @@
 // Github: https://github.com/michal-swiatek
 //
 
-#ifndef NEBULAENGINE_WINDOWSWINDOW_H
-#define NEBULAENGINE_WINDOWSWINDOW_H
+#ifndef NEBULAENGINE_GLFWWINDOW_H
+#define NEBULAENGINE_GLFWWINDOW_H
 
 #include "core/Window.h"
 
@@ -12,11 +12,11 @@ struct GLFWwindow;
 
 namespace nebula {
 
-    class WindowsWindow final : public Window
+    class GLFWWindow final : public Window
     {
     public:
-        explicit WindowsWindow(const WindowProperties& properties, rendering::API api);
-        ~WindowsWindow() override;
+        explicit GLFWWindow(const WindowProperties& properties, rendering::API api);
+        ~GLFWWindow() override;
 
         void onUpdate() override;
 
@@ -24,6 +24,10 @@ namespace nebula {
         [[nodiscard]] uint32_t getHeight() const override { return m_window_data.height; }
         [[nodiscard]] WindowProperties getProperties() const override { return static_cast<WindowProperties>(m_window_data); }
 
+        [[nodiscard]] bool checkMinimized() const override;
+        [[nodiscard]] bool checkFocused() const override;
+        [[nodiscard]] bool checkCloseRequested() const override;
+
         void setEventManager(EventManager& event_manager) override { m_window_data.event_manager = &event_manager; }
         void setProperties(const WindowProperties& window_properties) override;
 
@@ -53,4 +57,4 @@ namespace nebula {
 
 }
 
-#endif //NEBULAENGINE_WINDOWSWINDOW_H
+#endif //NEBULAENGINE_GLFWWINDOW_H
@@ -6,6 +6,8 @@
 #ifndef RECORDCOMMANDSVISITOR_H
 #define RECORDCOMMANDSVISITOR_H
 
+#include <glad/glad.h>
+
 #include "rendering/commands/RenderCommandVisitor.h"
 
 namespace nebula::rendering {
@@ -13,13 +15,29 @@ namespace nebula::rendering {
     class OpenGlExecuteCommandsVisitor final : public ExecuteCommandVisitor
     {
     public:
-        void executeCommands(Scope<RecordedCommandBuffer>&& commands) override;
+        explicit OpenGlExecuteCommandsVisitor(uint32_t frame_in_flight);
+        ~OpenGlExecuteCommandsVisitor() override;
+
+        void executeCommands(RecordedCommandBuffer& commands) override;
         void submitCommands() override;
 
     private:
+        uint32_t m_frame_in_flight;
+        GLenum m_primitive_mode = GL_TRIANGLES;
+        GLuint m_empty_vertex_array = 0;    //  Core profile can't draw without bound vertex array
+
+        //  Bound pipeline vertex array and geometry buffer last attached to it, VAOs are shared between pipelines
+        GLuint m_vertex_array = 0;
+        GLsizei m_vertex_stride = 0;
+        GLuint m_attached_vertex_array = 0;
+        GLuint m_attached_geometry_buffer = 0;
+
         void visit(BeginRenderPassCommand& command) override;
         void visit(EndRenderPassCommand& command) override;
+        void visit(BindGraphicsPipelineCommand& command) override;
         void visit(DrawImGuiCommand& command) override;
+        void visit(DrawDummyIndicesCommand& command) override;
+        void visit(DrawMeshCommand& command) override;
     };
 
 }
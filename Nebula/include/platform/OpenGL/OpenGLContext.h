@@ -6,6 +6,8 @@
 #ifndef OPENGLCONTEXT_H
 #define OPENGLCONTEXT_H
 
+#include <vector>
+
 #include "rendering/Framebuffer.h"
 #include "rendering/RenderContext.h"
 
@@ -13,6 +15,10 @@ struct GLFWwindow;
 
 namespace nebula::rendering {
 
+    class OpenGLGpuProfiler;
+    class OpenGLStreamBuffer;
+    class OpenGlExecuteCommandsVisitor;
+
     class OpenGLFramebufferTemplate final : public FramebufferTemplate
     {
     public:
@@ -29,6 +35,7 @@ namespace nebula::rendering {
     {
     public:
         explicit OpenGLContext(GLFWwindow* window_handle);
+        ~OpenGLContext() override;
 
         void waitForFrameResources(uint32_t frame) override;
 
@@ -39,7 +46,8 @@ namespace nebula::rendering {
         void presentImage() override;
         Reference<Framebuffer> getNextImage() override;
 
-        Scope<ExecuteCommandVisitor> getCommandExecutor() override;
+        ExecuteCommandVisitor& getCommandExecutor() override;
+        [[nodiscard]] OpenGLStreamBuffer& getStreamBuffer() const { return *m_stream_buffer; }
 
         [[nodiscard]] ApiInfo getApiInfo() const override;
         [[nodiscard]] const Reference<FramebufferTemplate>& viewFramebufferTemplate() const override;
@@ -50,6 +58,10 @@ namespace nebula::rendering {
 
         Reference<Framebuffer> m_framebuffer;
         Reference<FramebufferTemplate> m_framebuffer_template;
+
+        Scope<OpenGLGpuProfiler> m_gpu_profiler;
+        Scope<OpenGLStreamBuffer> m_stream_buffer;
+        std::vector<Scope<OpenGlExecuteCommandsVisitor>> m_command_executors;  //  One per frame in flight
     };
 
 }
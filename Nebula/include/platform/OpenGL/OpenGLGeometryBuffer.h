@@ -0,0 +1,33 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef OPENGLGEOMETRYBUFFER_H
+#define OPENGLGEOMETRYBUFFER_H
+
+#include <glad/glad.h>
+
+#include "rendering/GeometryBuffer.h"
+
+namespace nebula::rendering {
+
+    //  Immutable storage updated with glNamedBufferSubData, driver orders updates with draws reading the buffer
+    class OpenGLGeometryBuffer final : public GeometryBuffer
+    {
+    public:
+        explicit OpenGLGeometryBuffer(uint64_t size);
+        ~OpenGLGeometryBuffer() override;
+
+        [[nodiscard]] void* getBufferHandle() const override { return reinterpret_cast<void*>(static_cast<uintptr_t>(m_buffer)); }
+
+    protected:
+        uint64_t writeData(uint64_t offset, const void* data, uint64_t size) override;
+
+    private:
+        GLuint m_buffer = 0;
+    };
+
+}
+
+#endif //OPENGLGEOMETRYBUFFER_H
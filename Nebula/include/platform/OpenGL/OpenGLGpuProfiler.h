@@ -0,0 +1,43 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef OPENGLGPUPROFILER_H
+#define OPENGLGPUPROFILER_H
+
+#include <array>
+#include <vector>
+
+#include "rendering/GpuProfiler.h"
+
+namespace nebula::rendering {
+
+    class OpenGLGpuProfiler final : public GpuProfiler
+    {
+    public:
+        OpenGLGpuProfiler();
+        ~OpenGLGpuProfiler() override;
+
+        void beginPass(uint32_t frame_in_flight);
+        void endPass(uint32_t frame_in_flight);
+        void beginStage(uint32_t frame_in_flight);
+        void endStage(uint32_t frame_in_flight);
+
+        //  Called before frame_in_flight is reused, frame is dropped if results are not available yet
+        void onFrameCompleted(uint32_t frame_in_flight);
+
+        static OpenGLGpuProfiler& get() { return static_cast<OpenGLGpuProfiler&>(GpuProfiler::get()); }
+
+    private:
+        using FrameQueryObjects = std::array<uint32_t, cMaxQueriesPerFrame>;
+
+        std::vector<FrameQueryObjects> m_query_objects{};
+        std::array<uint64_t, cMaxQueriesPerFrame> m_timestamps{};
+
+        void writeTimestamp(uint32_t frame_in_flight, std::optional<uint32_t> query) const;
+    };
+
+}
+
+#endif //OPENGLGPUPROFILER_H
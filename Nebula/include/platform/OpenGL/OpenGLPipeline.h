@@ -0,0 +1,94 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef OPENGLPIPELINE_H
+#define OPENGLPIPELINE_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include <glad/glad.h>
+
+#include "rendering/PipelineState.h"
+#include "platform/OpenGL/OpenGLStateCache.h"
+
+namespace nebula::rendering {
+
+    //  OpenGL has no pipeline objects, program and state block are bound separately
+    struct OpenGLPipeline
+    {
+        GLuint program = 0;     //  Owned by OpenGLShader
+        GLenum primitive_mode = GL_TRIANGLES;
+        OpenGLStateBlock state_block{};
+
+        GLuint vertex_array = 0;    //  Owned by OpenGLPipelineCache, vertex buffer is attached at draw time
+        GLsizei vertex_stride = 0;  //  Of binding 0, where GeometryBuffer is attached
+    };
+
+    OpenGLPipeline createOpenGLPipeline(const GraphicsPipelineState& graphics_pipeline_state);
+    //  Attribute formats and bindings only, VAO can be shared by pipelines with equal VertexLayout
+    GLuint createOpenGLVertexArray(const VertexLayout& vertex_layout);
+
+    //  Linked program binaries persisted on disk, keyed by shader source hash and driver
+    class OpenGLProgramCache
+    {
+    public:
+        explicit OpenGLProgramCache(const std::string& cache_root);
+
+        //  Returns 0 if program is not cached or driver rejected cached binary
+        [[nodiscard]] GLuint loadProgram(uint64_t source_hash) const;
+        void storeProgram(uint64_t source_hash, GLuint program) const;
+
+        [[nodiscard]] bool enabled() const { return m_enabled; }
+
+    private:
+        std::string m_cache_directory;
+        uint64_t m_driver_hash = 0;     //  Vendor, renderer and version, binaries are only valid for driver that produced them
+        bool m_enabled = false;
+
+        [[nodiscard]] std::string getProgramPath(uint64_t source_hash) const;
+    };
+
+    class OpenGLPipelineCache
+    {
+    public:
+        OpenGLPipelineCache() = default;
+        ~OpenGLPipelineCache();
+
+        OpenGLPipelineCache(const OpenGLPipelineCache&) = delete;
+        OpenGLPipelineCache& operator = (const OpenGLPipelineCache&) = delete;
+
+        void destroyPipeline(void* renderpass, uint32_t stage);
+        [[nodiscard]] OpenGLPipeline* getPipeline(void* renderpass, uint32_t stage) const;
+
+        //  Pipelines outlive RenderPasses and are shared between stages with equal state
+        OpenGLPipeline* addPipeline(void* renderpass, uint32_t stage, const GraphicsPipelineState& graphics_pipeline_state);
+
+        //  Cached states keep pointer to shader and its program, so pipelines are evicted before shader goes away
+        void onShaderDestroyed(const Shader& shader);
+
+    private:
+        struct RenderStageID
+        {
+            void* renderpass;
+            uint32_t stage;
+
+            friend bool operator == (const RenderStageID&, const RenderStageID&) = default;
+        };
+
+        struct RenderStageIDHash { std::size_t operator() (const RenderStageID& id) const; };
+
+        std::unordered_map<GraphicsPipelineState, Scope<OpenGLPipeline>, GraphicsPipelineHash> m_pipelines{};
+        std::unordered_map<RenderStageID, OpenGLPipeline*, RenderStageIDHash> m_handle_map{};     //  Not owning
+        std::unordered_map<VertexLayout, GLuint, VertexLayoutHash> m_vertex_arrays{};
+    };
+
+    //  Stable across runs, unlike std::hash
+    uint64_t hashShaderSource(const std::vector<char>& source, uint64_t seed = 0);
+
+}
+
+#endif //OPENGLPIPELINE_H
@@ -7,6 +7,7 @@
 #define OPENGLRENDERERAPI_H
 
 #include "rendering/renderer/RendererAPI.h"
+#include "platform/OpenGL/OpenGLPipeline.h"
 
 namespace nebula::rendering {
 
@@ -19,6 +20,13 @@ namespace nebula::rendering {
         void compilePipelines(RenderPass& renderpass) override;
         void destroyPipeline(RenderPass& renderpass, uint32_t stage) override;
         void* getPipelineHandle(RenderPass& renderpass, uint32_t stage) override;
+
+        [[nodiscard]] const OpenGLProgramCache& getProgramCache() const { return *m_program_cache; }
+        [[nodiscard]] OpenGLPipelineCache& getPipelineCache() { return *m_pipeline_cache; }
+
+    private:
+        Scope<OpenGLProgramCache> m_program_cache = nullptr;
+        Scope<OpenGLPipelineCache> m_pipeline_cache = nullptr;
     };
 
 }
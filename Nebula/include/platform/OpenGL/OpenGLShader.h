@@ -6,10 +6,15 @@
 #ifndef OPENGLSHADER_H
 #define OPENGLSHADER_H
 
+#include <glad/glad.h>
+
 #include "rendering/Shader.h"
 
 namespace nebula::rendering {
 
+    class OpenGLProgramCache;
+
+    //  Stages are linked into single program, SPIR-V stages are cross compiled to GLSL before compilation
     class OpenGLShader final : public Shader
     {
     public:
@@ -21,7 +26,13 @@ namespace nebula::rendering {
         void* getStageHandle(ShaderStage stage) override;
 
     private:
-        std::vector<char> loadBinaryFile(const std::string& path) override;
+        GLuint m_program = 0;
+
+        void buildVertexShader(const VertexShader& shader_template, const OpenGLProgramCache& program_cache);
+
+        [[nodiscard]] std::string translateStage(const std::string& path, const std::vector<char>& code) const;
+        [[nodiscard]] GLuint compileStage(ShaderStage stage, const std::string& source) const;
+        void linkProgram(const std::vector<GLuint>& stages);
     };
 
 }
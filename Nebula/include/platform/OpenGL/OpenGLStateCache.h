@@ -0,0 +1,151 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef OPENGLSTATECACHE_H
+#define OPENGLSTATECACHE_H
+
+#include <array>
+
+#include <glad/glad.h>
+
+#include "core/Core.h"
+
+namespace nebula::rendering {
+
+    //  Fixed function state baked from GraphicsPipelineState, applied as a whole when pipeline is bound
+    struct NEBULA_API OpenGLStateBlock
+    {
+        bool primitive_restart = false;
+        bool rasterizer_discard = false;
+
+        bool cull = false;
+        GLenum cull_face = GL_BACK;
+        GLenum front_face = GL_CW;
+        GLenum polygon_mode = GL_FILL;
+        float line_width = 1.0f;
+
+        bool depth_test = false;
+        bool depth_clamp = false;
+        bool polygon_offset = false;
+        float polygon_offset_factor = 0.0f;
+        float polygon_offset_units = 0.0f;
+        float polygon_offset_clamp = 0.0f;
+
+        bool sample_shading = false;
+        float min_sample_shading = 1.0f;
+        bool alpha_to_coverage = false;
+        bool alpha_to_one = false;
+
+        bool blend = false;
+        GLenum blend_src_rgb = GL_ONE;
+        GLenum blend_dst_rgb = GL_ZERO;
+        GLenum blend_src_alpha = GL_ONE;
+        GLenum blend_dst_alpha = GL_ZERO;
+        GLenum blend_equation_rgb = GL_FUNC_ADD;
+        GLenum blend_equation_alpha = GL_FUNC_ADD;
+
+        friend bool operator == (const OpenGLStateBlock&, const OpenGLStateBlock&) = default;
+    };
+
+    //  Shadow copy of GL bindings of context current on calling thread, setters skip calls that would not change state.
+    //  All GL calls going through cache have to be made with same context current, invalidate() after switching context
+    //  or after external code changed state without restoring it.
+    class NEBULA_API OpenGLStateCache
+    {
+    public:
+        static constexpr uint32_t cMaxIndexedBindings = 16;
+
+        static OpenGLStateCache& get();
+
+        //  Forget all state, next call of every setter reaches driver
+        void invalidate();
+
+        //  Compares every known value against glGet*, asserts on mismatch
+        void validate() const;
+
+        void bindFramebuffer(GLenum target, GLuint framebuffer);
+        void setViewport(GLint x, GLint y, GLsizei width, GLsizei height);
+        void setScissor(GLint x, GLint y, GLsizei width, GLsizei height);
+        void setScissorTest(bool enabled);
+        void setClearColor(float r, float g, float b, float a);
+
+        //  Only fields differing from last applied block reach driver
+        void applyStateBlock(const OpenGLStateBlock& state_block);
+
+        void useProgram(GLuint program);
+        void bindVertexArray(GLuint vertex_array);
+        void bindBuffer(GLenum target, GLuint buffer);
+        void bindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+        void bindBufferBase(GLenum target, GLuint index, GLuint buffer);
+
+        //  DSA change of element buffer, which is part of vertex array state and replaces binding of bound vertex array
+        void setVertexArrayElementBuffer(GLuint vertex_array, GLuint buffer);
+
+        //  GL silently unbinds deleted objects, cache has to follow. Program in use stays bound until replaced.
+        void onFramebufferDeleted(GLuint framebuffer);
+        void onVertexArrayDeleted(GLuint vertex_array);
+        void onBufferDeleted(GLuint buffer);
+
+    private:
+        static constexpr GLuint cUnknown = ~0u;
+
+        enum BufferTarget : uint32_t
+        {
+            cArrayBuffer,
+            cElementArrayBuffer,
+            cUniformBuffer,
+            cShaderStorageBuffer,
+            cCopyReadBuffer,
+            cCopyWriteBuffer,
+            cPixelPackBuffer,
+            cPixelUnpackBuffer,
+            cDrawIndirectBuffer,
+
+            cBufferTargetCount
+        };
+
+        struct Rect
+        {
+            std::array<GLint, 4> values{};  //  x, y, width, height
+            bool known = false;
+        };
+
+        struct IndexedBinding
+        {
+            GLuint buffer = cUnknown;
+            GLintptr offset = 0;
+            GLsizeiptr size = 0;    //  0 for whole buffer binding
+        };
+
+        GLuint m_draw_framebuffer = cUnknown;
+        GLuint m_read_framebuffer = cUnknown;
+        Rect m_viewport{};
+        Rect m_scissor{};
+        GLint m_scissor_test = -1;
+
+        std::array<float, 4> m_clear_color{};
+        bool m_clear_color_known = false;
+
+        OpenGLStateBlock m_state_block{};
+        bool m_state_block_known = false;
+
+        GLuint m_program = cUnknown;
+        GLuint m_vertex_array = cUnknown;
+        std::array<GLuint, cBufferTargetCount> m_buffers{};
+        std::array<IndexedBinding, cMaxIndexedBindings> m_uniform_buffers{};
+        std::array<IndexedBinding, cMaxIndexedBindings> m_storage_buffers{};
+
+        OpenGLStateCache();
+
+        void onSkipped() const;
+
+        static BufferTarget getBufferTarget(GLenum target);
+        static GLenum getBindingQuery(BufferTarget target);
+        IndexedBinding& getIndexedBinding(GLenum target, GLuint index);
+    };
+
+}
+
+#endif //OPENGLSTATECACHE_H
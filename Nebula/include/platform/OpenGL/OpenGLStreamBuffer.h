@@ -0,0 +1,64 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef OPENGLSTREAMBUFFER_H
+#define OPENGLSTREAMBUFFER_H
+
+#include <vector>
+#include <cstddef>
+
+#include <glad/glad.h>
+
+#include "core/Core.h"
+
+namespace nebula::rendering {
+
+    struct OpenGLStreamAllocation
+    {
+        std::byte* data = nullptr;  //  Persistently mapped, written data is visible to GPU without flushing
+        GLuint buffer = 0;
+        GLintptr offset = 0;
+        GLsizeiptr size = 0;
+    };
+
+    //  Persistent coherent mapped ring buffer, one region per frame in flight.
+    //  Region is reused only after fence of frame that last wrote it is signaled, so writes never stall in driver.
+    class OpenGLStreamBuffer
+    {
+    public:
+        OpenGLStreamBuffer(GLsizeiptr frame_size, uint32_t frames_in_flight);
+        ~OpenGLStreamBuffer();
+
+        OpenGLStreamBuffer(const OpenGLStreamBuffer&) = delete;
+        OpenGLStreamBuffer& operator = (const OpenGLStreamBuffer&) = delete;
+
+        //  Blocks until GPU finished frame that previously used region, then makes region current
+        void beginFrame(uint32_t frame_in_flight);
+        //  Fences every command issued so far, has to be called after last draw reading this frame's region
+        void endFrame();
+
+        [[nodiscard]] OpenGLStreamAllocation allocate(GLsizeiptr size, GLsizeiptr alignment = 16);
+        [[nodiscard]] OpenGLStreamAllocation allocateUniforms(GLsizeiptr size) { return allocate(size, m_uniform_alignment); }
+
+        [[nodiscard]] GLuint getBuffer() const { return m_buffer; }
+        [[nodiscard]] GLsizeiptr getFrameSize() const { return m_frame_size; }
+
+    private:
+        GLuint m_buffer = 0;
+        std::byte* m_mapped_memory = nullptr;
+
+        GLsizeiptr m_frame_size = 0;
+        GLsizeiptr m_uniform_alignment = 256;
+
+        uint32_t m_frame_in_flight = 0;
+        GLsizeiptr m_frame_offset = 0;      //  Used bytes of current region
+        std::vector<GLsync> m_fences{};
+
+        void waitForFence(uint32_t frame_in_flight);
+    };
+
+}
+
+#endif //OPENGLSTREAMBUFFER_H
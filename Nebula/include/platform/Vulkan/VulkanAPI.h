@@ -9,6 +9,7 @@
 #include <vulkan/vulkan.h>
 #include <vk_mem_alloc.h>
 
+#include <mutex>
 #include <string>
 #include <optional>
 
@@ -32,9 +33,13 @@ namespace nebula::rendering {
     {
         VkQueue graphics_queue;
         VkQueue presentation_queue;
+        VkQueue transfer_queue;
 
         uint32_t graphics_family_index;
         uint32_t presentation_family_index;
+        uint32_t transfer_family_index;
+
+        [[nodiscard]] bool checkDedicatedTransfer() const { return transfer_family_index != graphics_family_index; }
     };
 
     struct VkApiAllocatedImage
@@ -63,11 +68,21 @@ namespace nebula::rendering {
         static QueuesInfo getQueuesInfo();
         static PhysicalDeviceInfo getPhysicalDeviceInfo();
 
+        //  Descriptor indexing features needed by VulkanBindlessTable
+        static bool checkBindlessSupport() { return s_bindless_support; }
+
+        //  Render passes use vkCmdBeginRendering instead of VkRenderPass/VkFramebuffer objects
+        static bool checkDynamicRendering() { return s_dynamic_rendering; }
+
+        //  Guards vkQueueSubmit/vkQueuePresentKHR, queues may be shared between threads
+        static std::mutex& getQueueMutex() { return s_queue_mutex; }
+
     private:
         struct QueueFamilyIndices
         {
             std::optional<uint32_t> graphics_family{};
             std::optional<uint32_t> presentation_family{};
+            std::optional<uint32_t> transfer_family{};  //  Only set for transfer-only families
 
             [[nodiscard]] bool checkMinimalSupport() const
             {
@@ -94,6 +109,9 @@ namespace nebula::rendering {
         static VkPhysicalDevice s_physical_device;
         static VmaAllocator s_vma_allocator;
         static QueuesInfo s_queues_info;
+        static std::mutex s_queue_mutex;
+        static bool s_bindless_support;
+        static bool s_dynamic_rendering;
 
         friend class nebula::rendering::VulkanContext;
 
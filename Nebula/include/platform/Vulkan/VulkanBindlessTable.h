@@ -0,0 +1,92 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef VULKANBINDLESSTABLE_H
+#define VULKANBINDLESSTABLE_H
+
+#include <mutex>
+#include <vector>
+
+#include "platform/Vulkan/VulkanAPI.h"
+
+namespace nebula::rendering {
+
+    //  Index into bindless array, passed to shaders through push constants or instance data
+    struct BindlessHandle
+    {
+        static constexpr uint32_t cInvalidIndex = UINT32_MAX;
+
+        uint32_t index = cInvalidIndex;
+
+        [[nodiscard]] bool checkValid() const { return index != cInvalidIndex; }
+    };
+
+    class VulkanBindlessTable
+    {
+    public:
+        //  Set 0 bindings of every bindless pipeline
+        static constexpr uint32_t cTexturesBinding = 0;
+        static constexpr uint32_t cStorageBuffersBinding = 1;
+
+        //  Guaranteed minimum of maxPushConstantsSize, all bindless pipelines share this range
+        static constexpr uint32_t cPushConstantsSize = 128;
+
+        VulkanBindlessTable();
+        ~VulkanBindlessTable();
+
+        //  Thread safe, slots are written with update-after-bind so bound set stays valid
+        [[nodiscard]] BindlessHandle registerTexture(VkImageView image_view, VkSampler sampler, VkImageLayout layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+        [[nodiscard]] BindlessHandle registerStorageBuffer(VkBuffer buffer, VkDeviceSize offset = 0, VkDeviceSize range = VK_WHOLE_SIZE);
+
+        //  Slots are reused only after every frame that could reference them has finished
+        void releaseTexture(BindlessHandle handle);
+        void releaseStorageBuffer(BindlessHandle handle);
+
+        void bind(VkCommandBuffer command_buffer, VkPipelineBindPoint bind_point = VK_PIPELINE_BIND_POINT_GRAPHICS) const;
+        void pushHandles(VkCommandBuffer command_buffer, const uint32_t* handles, uint32_t count, uint32_t offset = 0) const;
+
+        //  Called when frame_in_flight fence is signaled
+        void onFrameCompleted(uint32_t frame_in_flight);
+
+        [[nodiscard]] VkDescriptorSetLayout getDescriptorSetLayout() const { return m_descriptor_set_layout; }
+        [[nodiscard]] VkPipelineLayout getPipelineLayout() const { return m_pipeline_layout; }
+        [[nodiscard]] static VkPushConstantRange getPushConstantRange();
+
+        static bool checkEnabled() { return s_instance != nullptr; }
+        static VulkanBindlessTable& get() { return *s_instance; }
+
+    private:
+        struct SlotAllocator
+        {
+            uint32_t capacity = 0;
+            uint32_t next_unused = 0;
+
+            std::vector<uint32_t> free_slots{};
+            std::vector<uint32_t> released_slots{};
+            std::vector<std::vector<uint32_t>> deferred_slots{};   //  Per frame in flight
+
+            uint32_t allocate();
+            void release(uint32_t slot);
+            void reclaim(uint32_t frame_in_flight);
+        };
+
+        std::mutex m_mutex;
+
+        VkDescriptorPool m_descriptor_pool = VK_NULL_HANDLE;
+        VkDescriptorSetLayout m_descriptor_set_layout = VK_NULL_HANDLE;
+        VkDescriptorSet m_descriptor_set = VK_NULL_HANDLE;
+        VkPipelineLayout m_pipeline_layout = VK_NULL_HANDLE;
+
+        SlotAllocator m_textures{};
+        SlotAllocator m_storage_buffers{};
+
+        void writeDescriptor(uint32_t binding, uint32_t slot, VkDescriptorType type, const VkDescriptorImageInfo* image_info, const VkDescriptorBufferInfo* buffer_info) const;
+
+        static VulkanBindlessTable* s_instance;
+    };
+
+}
+
+#endif //VULKANBINDLESSTABLE_H
@@ -6,6 +6,10 @@
 #ifndef VULKANCOMMANDSVISITOR_H
 #define VULKANCOMMANDSVISITOR_H
 
+#include <span>
+#include <vector>
+#include <optional>
+
 #include <core/LayerStack.h>
 
 #include "platform/Vulkan/VulkanAPI.h"
@@ -14,36 +18,102 @@
 
 namespace nebula::rendering {
 
+    class RenderPass;
+    class VulkanCommandPool;
+
     class VulkanRecordCommandsVisitor : public RecordCommandVisitor
     {
     public:
-        explicit VulkanRecordCommandsVisitor(VkCommandBuffer command_buffer);
+        VulkanRecordCommandsVisitor(VkCommandBuffer command_buffer, uint32_t frame_in_flight);
+
+        //  Retargets reused visitor, scratch storage keeps its capacity between recordings
+        void setCommandBuffer(VkCommandBuffer command_buffer, uint32_t frame_in_flight);
 
-        Scope<RecordedCommandBuffer> recordCommands(Scope<RenderCommandBuffer>&& commands) override;
+        void recordCommands(const RenderCommandBuffer& commands) override;
+
+        //  Records only render pass structure commands, contents of every RenderStage are executed from secondary command buffers.
+        //  Command pool provides secondary buffers for commands primary buffer can't record inline, like stage timestamps.
+        void recordCommands(
+            const std::vector<RenderCommand*>& structure_commands,
+            std::span<const std::span<const VkCommandBuffer>> stage_command_buffers,
+            VulkanCommandPool& command_pool
+        );
 
         void visit(BeginRenderPassCommand& command) override;
         void visit(EndRenderPassCommand& command) override;
         void visit(BindGraphicsPipelineCommand& command) override;
         void visit(DrawImGuiCommand& command) override;
         void visit(DrawDummyIndicesCommand& command) override;
+        void visit(DrawMeshCommand& command) override;
 
     protected:
         VkCommandBuffer m_command_buffer = VK_NULL_HANDLE;
+        uint32_t m_frame_in_flight;
 
         void startRecording() const;
         void endRecording() const;
+
+        void bindPipelineState(const BindGraphicsPipelineCommand& command);
+
+    private:
+        uint32_t m_stage_count = 0;
+        std::span<const std::span<const VkCommandBuffer>> m_stage_command_buffers{};
+        VulkanCommandPool* m_command_pool = nullptr;
+
+        //  Subpass with secondary contents allows only vkCmdExecuteCommands, so stage timestamps get own secondary buffers
+        VkCommandBufferInheritanceInfo m_timestamp_inheritance_info = {};
+        std::vector<VkCommandBuffer> m_stage_executions{};
+
+        std::vector<VkClearValue> m_clear_values{};
+        VkBuffer m_bound_geometry_buffer = VK_NULL_HANDLE;     //  Vertex and index buffer, reset with every pipeline bind
+
+        [[nodiscard]] bool checkSecondaryContents() const { return !m_stage_command_buffers.empty(); }
+        [[nodiscard]] VkSubpassContents getSubpassContents() const { return checkSecondaryContents() ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE; }
+
+        void executeStageCommands(uint32_t stage);
+        [[nodiscard]] VkCommandBuffer recordStageTimestamp(uint32_t stage, bool begin);
+
+        //  Dynamic rendering state, every RenderStage is recorded as separate vkCmdBeginRendering scope
+        RenderPass* m_rendering_renderpass = nullptr;
+        VkRect2D m_rendering_area = {};
+        std::optional<uint32_t> m_rendering_stage{};
+        std::vector<VkImageLayout> m_attachment_layouts{};
+        std::vector<bool> m_attachment_loaded{};
+        std::vector<std::pair<uint32_t, VkImageLayout>> m_transitions{};
+        std::vector<VkRenderingAttachmentInfo> m_color_attachments{};
+        std::vector<VkImageMemoryBarrier> m_barriers{};
+
+        void beginRenderingStage();
+        void endRenderingStage();
+        void transitionAttachments();   //  Applies m_transitions
+    };
+
+    class VulkanRecordSecondaryCommandsVisitor final : public VulkanRecordCommandsVisitor
+    {
+    public:
+        VulkanRecordSecondaryCommandsVisitor(VkCommandBuffer command_buffer, uint32_t frame_in_flight, const VkCommandBufferInheritanceInfo& inheritance_info);
+
+        //  Pipeline state is not inherited by secondary command buffers, so every chunk starts with its stage pipeline bind
+        void recordChunk(BindGraphicsPipelineCommand& bind_command, std::span<RenderCommand* const> commands);
+
+        using VulkanRecordCommandsVisitor::visit;
+        void visit(BindGraphicsPipelineCommand& command) override;
+
+    private:
+        const VkCommandBufferInheritanceInfo& m_inheritance_info;
     };
 
     class VulkanExecuteCommandsVisitor final : public ExecuteCommandVisitor
     {
     public:
-        explicit VulkanExecuteCommandsVisitor(VulkanFrameSynchronization& frame_synchronization);
+        VulkanExecuteCommandsVisitor(VulkanFrameSynchronization& frame_synchronization, uint32_t frame_in_flight);
 
-        void executeCommands(Scope<RecordedCommandBuffer>&& commands) override;
+        void executeCommands(RecordedCommandBuffer& commands) override;
         void submitCommands() override;
 
     private:
         VulkanFrameSynchronization& m_frame_synchronization;
+        uint32_t m_frame_in_flight;
         std::vector<VkCommandBuffer> m_vulkan_commands;
     };
 
@@ -19,6 +19,12 @@ namespace nebula::rendering {
 
     class VulkanAPI;
     class VulkanSwapchain;
+    class VulkanUploadManager;
+    class VulkanBindlessTable;
+    class VulkanGpuProfiler;
+    class VulkanDescriptorAllocator;
+    class VulkanDescriptorLayoutCache;
+    class VulkanExecuteCommandsVisitor;
 
     struct VulkanFrameSynchronization
     {
@@ -48,7 +54,7 @@ namespace nebula::rendering {
         void presentImage() override;
         Reference<Framebuffer> getNextImage() override;
 
-        Scope<ExecuteCommandVisitor> getCommandExecutor() override;
+        ExecuteCommandVisitor& getCommandExecutor() override;
 
         [[nodiscard]] ApiInfo getApiInfo() const override;
         [[nodiscard]] const Reference<FramebufferTemplate>& viewFramebufferTemplate() const override;
@@ -59,8 +65,14 @@ namespace nebula::rendering {
 
         Scope<VulkanAPI> m_vulkan_api;
         Scope<VulkanSwapchain> m_swapchain;
+        Scope<VulkanUploadManager> m_upload_manager;
+        Scope<VulkanDescriptorLayoutCache> m_descriptor_layout_cache;
+        Scope<VulkanDescriptorAllocator> m_descriptor_allocator;
+        Scope<VulkanBindlessTable> m_bindless_table;
+        Scope<VulkanGpuProfiler> m_gpu_profiler;
 
         std::vector<VulkanFrameSynchronization> m_frame_synchronizations;
+        std::vector<Scope<VulkanExecuteCommandsVisitor>> m_command_executors;   //  One per frame in flight
     };
 
 }
@@ -0,0 +1,108 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef VULKANDESCRIPTORS_H
+#define VULKANDESCRIPTORS_H
+
+#include <mutex>
+#include <vector>
+#include <unordered_map>
+
+#include "rendering/PipelineState.h"
+#include "platform/Vulkan/VulkanAPI.h"
+
+namespace nebula::rendering {
+
+    VkDescriptorType getVulkanDescriptorType(DescriptorType type);
+    VkShaderStageFlags getVulkanDescriptorStages(DescriptorStage stages);
+
+    class VulkanDescriptorLayoutCache
+    {
+    public:
+        VulkanDescriptorLayoutCache();
+        ~VulkanDescriptorLayoutCache();
+
+        //  Thread safe, identical binding descriptions share one VkDescriptorSetLayout
+        VkDescriptorSetLayout getLayout(const DescriptorSetLayout& layout);
+
+        static VulkanDescriptorLayoutCache& get() { return *s_instance; }
+
+    private:
+        std::mutex m_mutex;
+        std::unordered_map<DescriptorSetLayout, VkDescriptorSetLayout, DescriptorSetLayoutHash> m_layouts{};
+
+        static VulkanDescriptorLayoutCache* s_instance;
+    };
+
+    struct VulkanDescriptorResource
+    {
+        uint32_t binding = 0;
+        VkDescriptorType type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        VkDescriptorBufferInfo buffer_info{};
+        VkDescriptorImageInfo image_info{};
+
+        friend bool operator == (const VulkanDescriptorResource& lhs, const VulkanDescriptorResource& rhs);
+    };
+
+    //  Resources bound to one descriptor set, doubles as set cache key
+    class VulkanDescriptorBindings
+    {
+    public:
+        VulkanDescriptorBindings& bindBuffer(uint32_t binding, VkDescriptorType type, VkBuffer buffer, VkDeviceSize offset, VkDeviceSize range);
+        VulkanDescriptorBindings& bindImage(uint32_t binding, VkDescriptorType type, VkImageView image_view, VkSampler sampler, VkImageLayout layout);
+
+        void clear() { m_resources.clear(); m_hash = 0; }
+
+        [[nodiscard]] std::size_t getHash() const { return m_hash; }
+        [[nodiscard]] const std::vector<VulkanDescriptorResource>& viewResources() const { return m_resources; }
+
+    private:
+        std::vector<VulkanDescriptorResource> m_resources{};
+        std::size_t m_hash = 0;
+    };
+
+    class VulkanDescriptorAllocator
+    {
+    public:
+        VulkanDescriptorAllocator();
+        ~VulkanDescriptorAllocator();
+
+        //  Sets live until frame_in_flight is reset, identical bindings reuse the same set within a frame
+        VkDescriptorSet getDescriptorSet(uint32_t frame_in_flight, VkDescriptorSetLayout layout, const VulkanDescriptorBindings& bindings);
+        VkDescriptorSet allocate(uint32_t frame_in_flight, VkDescriptorSetLayout layout);
+
+        //  Called when frame_in_flight fence is signaled
+        void reset(uint32_t frame_in_flight);
+
+        static VulkanDescriptorAllocator& get() { return *s_instance; }
+
+    private:
+        struct CachedSet
+        {
+            VkDescriptorSetLayout layout = VK_NULL_HANDLE;
+            std::vector<VulkanDescriptorResource> resources{};
+            VkDescriptorSet descriptor_set = VK_NULL_HANDLE;
+        };
+
+        struct FramePools
+        {
+            std::vector<VkDescriptorPool> pools{};
+            uint32_t current_pool = 0;
+
+            std::unordered_map<std::size_t, CachedSet> set_cache{};
+        };
+
+        std::vector<FramePools> m_frame_pools{};
+        uint32_t m_sets_per_pool = 256;
+
+        VkDescriptorPool createPool(uint32_t max_sets) const;
+        VkDescriptorPool getPool(FramePools& frame_pools);
+
+        static VulkanDescriptorAllocator* s_instance;
+    };
+
+}
+
+#endif //VULKANDESCRIPTORS_H
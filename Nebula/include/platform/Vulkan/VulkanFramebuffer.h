@@ -13,6 +13,13 @@
 
 namespace nebula::rendering {
 
+    //  Framebuffer handle in dynamic rendering mode, indexed same as FramebufferTemplate attachments
+    struct VulkanRenderingAttachments
+    {
+        std::vector<VkImage> images{};
+        std::vector<VkImageView> image_views{};
+    };
+
     class NEBULA_API VulkanFramebuffer final : public Framebuffer
     {
     public:
@@ -35,6 +42,7 @@ namespace nebula::rendering {
 
         std::vector<VkImageView> m_image_views{};
         std::vector<VkApiAllocatedImage> m_image_buffers{};
+        VulkanRenderingAttachments m_rendering_attachments{};
 
         void createAttachment(const AttachmentDescription& attachment_description, bool depth_stencil);
     };
@@ -57,7 +65,7 @@ namespace nebula::rendering {
     class VulkanSwapchainFramebuffer final : public Framebuffer
     {
     public:
-        explicit VulkanSwapchainFramebuffer(VkImageView image_view, const Reference<FramebufferTemplate>& swapchain_framebuffer_template);
+        VulkanSwapchainFramebuffer(VkImage image, VkImageView image_view, const Reference<FramebufferTemplate>& swapchain_framebuffer_template);
         ~VulkanSwapchainFramebuffer() override;
 
         void bind() override;
@@ -73,6 +81,7 @@ namespace nebula::rendering {
     private:
         VkImageView m_image_view = VK_NULL_HANDLE;
         VkFramebuffer m_framebuffer = VK_NULL_HANDLE;
+        VulkanRenderingAttachments m_rendering_attachments{};
 
         Reference<FramebufferTemplate> m_framebuffer_template;
 
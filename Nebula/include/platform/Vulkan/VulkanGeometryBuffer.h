@@ -0,0 +1,35 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef VULKANGEOMETRYBUFFER_H
+#define VULKANGEOMETRYBUFFER_H
+
+#include "rendering/GeometryBuffer.h"
+#include "platform/Vulkan/VulkanAPI.h"
+#include "platform/Vulkan/VulkanUploadManager.h"
+
+namespace nebula::rendering {
+
+    //  Device local VMA buffer, meshes are copied through VulkanUploadManager staging ring
+    class VulkanGeometryBuffer final : public GeometryBuffer
+    {
+    public:
+        explicit VulkanGeometryBuffer(uint64_t size);
+        ~VulkanGeometryBuffer() override;
+
+        [[nodiscard]] bool checkUploaded(const MeshAllocation& mesh) const override;
+        [[nodiscard]] void* getBufferHandle() const override { return m_buffer.buffer; }
+
+    protected:
+        uint64_t writeData(uint64_t offset, const void* data, uint64_t size) override;
+
+    private:
+        VkApiAllocatedBuffer m_buffer{};
+        UploadTicket m_upload_ticket{};     //  Latest upload, only waited for on destruction, tickets complete in order
+    };
+
+}
+
+#endif //VULKANGEOMETRYBUFFER_H
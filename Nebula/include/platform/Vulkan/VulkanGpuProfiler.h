@@ -0,0 +1,45 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef VULKANGPUPROFILER_H
+#define VULKANGPUPROFILER_H
+
+#include <array>
+#include <vector>
+
+#include "rendering/GpuProfiler.h"
+#include "platform/Vulkan/VulkanAPI.h"
+
+namespace nebula::rendering {
+
+    class VulkanGpuProfiler final : public GpuProfiler
+    {
+    public:
+        VulkanGpuProfiler();
+        ~VulkanGpuProfiler() override;
+
+        //  Render pass zones have to be recorded outside of VkRenderPass, stage zones inside of it or around dynamic rendering scope
+        void beginPass(VkCommandBuffer command_buffer, uint32_t frame_in_flight);
+        void endPass(VkCommandBuffer command_buffer, uint32_t frame_in_flight);
+        void beginStage(VkCommandBuffer command_buffer, uint32_t frame_in_flight);
+        void endStage(VkCommandBuffer command_buffer, uint32_t frame_in_flight);
+
+        //  Called when frame_in_flight fence is signaled, never waits for query results
+        void onFrameCompleted(uint32_t frame_in_flight);
+
+        static bool checkSupport();
+        static VulkanGpuProfiler& get() { return static_cast<VulkanGpuProfiler&>(GpuProfiler::get()); }
+
+    private:
+        std::vector<VkQueryPool> m_query_pools{};
+        std::array<uint64_t, cMaxQueriesPerFrame> m_timestamps{};
+
+        double m_nanoseconds_per_tick = 1.0;
+        uint64_t m_valid_bits_mask = UINT64_MAX;
+    };
+
+}
+
+#endif //VULKANGPUPROFILER_H
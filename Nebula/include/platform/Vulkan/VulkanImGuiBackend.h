@@ -20,8 +20,8 @@ namespace nebula {
         void onAttach() override;
         void onDetach() override;
 
-        void begin() override;
-        void end(void* command_buffer_handle) override;
+        void newFrame() override;
+        void renderDrawData(ImDrawData& draw_data, void* command_buffer_handle) override;
 
     private:
         rendering::RenderPass& m_renderpass;
@@ -6,21 +6,43 @@
 #ifndef VULKANPIPELINE_H
 #define VULKANPIPELINE_H
 
+#include <array>
 #include <vector>
 #include <unordered_map>
 
 #include "rendering/PipelineState.h"
+#include "rendering/renderpass/RenderPass.h"
 #include "platform/Vulkan/VulkanAPI.h"
 
 namespace nebula::rendering {
 
+    //  Pipelines created for dynamic rendering depend only on state and attachment formats
+    struct VulkanRenderingPipelineKey
+    {
+        GraphicsPipelineState graphics_pipeline_state;
+        std::vector<VkFormat> color_formats{};
+        VkFormat depth_format = VK_FORMAT_UNDEFINED;
+        VkFormat stencil_format = VK_FORMAT_UNDEFINED;
+
+        friend bool operator == (const VulkanRenderingPipelineKey&, const VulkanRenderingPipelineKey&) = default;
+    };
+
+    struct VulkanRenderingPipelineKeyHash { std::size_t operator() (const VulkanRenderingPipelineKey& key) const; };
+
+    //  Color and depth stencil formats used by RenderStage in dynamic rendering mode
+    VulkanRenderingPipelineKey createRenderingPipelineKey(const FramebufferTemplate& framebuffer_template, const RenderStage& render_stage);
+    void writeRenderingFormats(const FramebufferTemplate& framebuffer_template, const RenderStage& render_stage, std::vector<VkFormat>& color_formats, VkFormat& depth_format, VkFormat& stencil_format);
+
     class VulkanGraphicsPipelineInfo
     {
     public:
+        static constexpr uint32_t cMaxDynamicStates = 7;    //  Stencil mask maps to two Vulkan states
+
         explicit VulkanGraphicsPipelineInfo(const GraphicsPipelineState& graphics_pipeline_state);
         ~VulkanGraphicsPipelineInfo();
 
         VkGraphicsPipelineCreateInfo buildPipelineCreateInfo(VkRenderPass renderpass, uint32_t subpass);
+        VkGraphicsPipelineCreateInfo buildRenderingPipelineCreateInfo(const VulkanRenderingPipelineKey& key);
 
     private:
         VkPipelineDynamicStateCreateInfo m_dynamic_state_create_info = {};
@@ -32,11 +54,18 @@ namespace nebula::rendering {
         VkPipelineColorBlendAttachmentState m_color_blend_attachment = {};
         VkPipelineColorBlendStateCreateInfo m_color_blend_create_info = {};
         VkPipelineLayoutCreateInfo m_pipeline_layout_create_info = {};
+        VkPipelineRenderingCreateInfo m_rendering_create_info = {};
 
         uint32_t m_multisampling_mask = 0;
         VkPipelineLayout m_pipeline_layout = {};
-
-        std::vector<VkDynamicState> m_dynamic_states = {};
+        VkPushConstantRange m_push_constant_range = {};
+
+        std::array<VkDynamicState, cMaxDynamicStates> m_dynamic_states = {};
+        std::vector<VkVertexInputBindingDescription> m_vertex_bindings = {};
+        std::vector<VkVertexInputAttributeDescription> m_vertex_attributes = {};
+        std::vector<VkFormat> m_color_attachment_formats = {};
+        std::vector<VkPipelineColorBlendAttachmentState> m_color_blend_attachments = {};
+        std::vector<VkDescriptorSetLayout> m_descriptor_set_layouts = {};
         std::vector<VkPipelineShaderStageCreateInfo> m_shader_stages = {};
 
         void loadVertexShader(View<Shader> shader, const VertexShader& shader_template);
@@ -69,12 +98,19 @@ namespace nebula::rendering {
         VkPipeline getPipeline(VkRenderPass renderpass, uint32_t subpass) const;
 
         void addPipelines(VkRenderPass renderpass, std::vector<VkPipeline>&& pipelines);
+
+        //  Dynamic rendering pipelines outlive RenderPasses and are shared between compatible stages
+        [[nodiscard]] VkPipeline findRenderingPipeline(const VulkanRenderingPipelineKey& key) const;
+        void addRenderingPipeline(VkRenderPass renderpass, uint32_t subpass, const VulkanRenderingPipelineKey& key, VkPipeline pipeline);
+
         [[nodiscard]] VkPipelineCache getCache() const { return m_pipeline_cache; }
 
     private:
         using RenderPassID = std::pair<VkRenderPass, uint32_t>;
 
         std::unordered_map<RenderPassID, VkPipeline, hash_pair> m_handle_map{};
+        std::unordered_map<RenderPassID, VkPipeline, hash_pair> m_rendering_handle_map{};   //  Not owning
+        std::unordered_map<VulkanRenderingPipelineKey, VkPipeline, VulkanRenderingPipelineKeyHash> m_rendering_pipelines{};
         VkPipelineCache m_pipeline_cache = VK_NULL_HANDLE;
         std::string m_cache_path;
     };
@@ -22,15 +22,19 @@ namespace nebula::rendering {
 
         void reset(uint32_t frame_in_flight);
         VkCommandBuffer getCommandBuffer(uint32_t frame_in_flight);
+        VkCommandBuffer getSecondaryCommandBuffer(uint32_t frame_in_flight);
 
     private:
         using CachedBuffers = std::vector<VkCommandBuffer>;
 
         std::vector<uint32_t> m_cache_indices;
+        std::vector<uint32_t> m_secondary_cache_indices;
         std::vector<VkCommandPool> m_command_pools;
         std::vector<CachedBuffers> m_cached_buffers;
+        std::vector<CachedBuffers> m_cached_secondary_buffers;
 
         void createPools();
+        VkCommandBuffer getCachedBuffer(uint32_t frame_in_flight, VkCommandBufferLevel level, CachedBuffers& cached_buffers, uint32_t& cache_index) const;
     };
 
     class VulkanRecordedBuffer final : public RecordedCommandBuffer
@@ -38,6 +42,7 @@ namespace nebula::rendering {
     public:
         explicit VulkanRecordedBuffer(VkCommandBuffer command_buffer) : m_command_buffer(command_buffer) {}
 
+        void setBufferHandle(VkCommandBuffer command_buffer) { m_command_buffer = command_buffer; }
         void* getBufferHandle() override { return m_command_buffer; }
         [[nodiscard]] const std::vector<RenderCommand*>& viewCommands() const override { throw std::runtime_error("No implementation for Vulkan"); }
 
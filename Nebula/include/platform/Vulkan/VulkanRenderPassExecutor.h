@@ -6,23 +6,42 @@
 #ifndef VULKANRENDERPASSEXECUTOR_H
 #define VULKANRENDERPASSEXECUTOR_H
 
+#include <vector>
+
 #include "platform/Vulkan/VulkanRecordedBuffer.h"
 #include "rendering/renderpass/RenderPassExecutor.h"
 
 namespace nebula::rendering {
 
+    class VulkanRenderStageSplitter;
+    class VulkanRecordCommandsVisitor;
+
     class VulkanRenderPassExecutor final : public RenderPassExecutor
     {
     public:
         explicit VulkanRenderPassExecutor(Scope<Renderer>&& renderer);
         explicit VulkanRenderPassExecutor(Scope<RenderPass>&& renderpass);
+        ~VulkanRenderPassExecutor() override;
 
         void resetResources(uint32_t frame_in_flight) override;
 
     private:
         Scope<VulkanCommandPool> m_command_pool;
 
-        Scope<RecordedCommandBuffer> recordCommands(Scope<RenderCommandBuffer>&& commands, std::optional<uint32_t> frame_in_flight) const override;
+        //  Reused every frame, steady state recording does not touch the heap
+        Scope<VulkanRecordCommandsVisitor> m_command_recorder;
+        Scope<VulkanRenderStageSplitter> m_stage_splitter;
+        VulkanRecordedBuffer m_recorded_buffer{VK_NULL_HANDLE};
+
+        //  Parallel recording, one pool per JobSystem thread so workers never share VkCommandPool
+        bool m_parallel_recording = false;
+        uint32_t m_recording_chunk_size = 0;
+        std::vector<Scope<VulkanCommandPool>> m_thread_command_pools;
+
+        void initRecording();
+
+        RecordedCommandBuffer& recordCommands(Scope<RenderCommandBuffer>&& commands, std::optional<uint32_t> frame_in_flight) override;
+        RecordedCommandBuffer& recordCommandsParallel(Scope<RenderCommandBuffer>&& commands, uint32_t frame_in_flight);
     };
 
 }
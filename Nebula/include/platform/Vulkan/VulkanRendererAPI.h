@@ -22,6 +22,8 @@ namespace nebula::rendering {
 
     private:
         Scope<VulkanPipelineCache> m_pipeline_cache = nullptr;
+
+        void compileRenderingPipelines(RenderPass& renderpass);
     };
 
 }
@@ -27,6 +27,7 @@ namespace nebula::rendering {
         ~VulkanSwapchainImages();
 
         [[nodiscard]] uint32_t getImageCount() const;
+        [[nodiscard]] const std::vector<VkImage>& viewImages() const;
         [[nodiscard]] const std::vector<VkImageView>& viewImageViews() const;
 
     private:
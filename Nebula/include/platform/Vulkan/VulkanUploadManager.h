@@ -0,0 +1,118 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef VULKANUPLOADMANAGER_H
+#define VULKANUPLOADMANAGER_H
+
+#include <mutex>
+#include <deque>
+#include <atomic>
+#include <vector>
+#include <optional>
+
+#include "platform/Vulkan/VulkanAPI.h"
+
+namespace nebula::rendering {
+
+    class VulkanCommandPool;
+
+    //  Timeline semaphore value signaled when batch containing the upload finishes
+    struct UploadTicket
+    {
+        uint64_t value = 0;
+    };
+
+    struct VulkanImageUploadInfo
+    {
+        VkImageSubresourceLayers subresource{VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+        VkOffset3D offset{0, 0, 0};
+        VkExtent3D extent{0, 0, 1};
+        VkImageLayout final_layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    };
+
+    class VulkanUploadManager
+    {
+    public:
+        explicit VulkanUploadManager(VkDeviceSize staging_buffer_size);
+        ~VulkanUploadManager();
+
+        //  Thread safe, data is copied into staging memory before returning
+        [[nodiscard]] UploadTicket uploadBuffer(VkBuffer buffer, VkDeviceSize offset, const void* data, VkDeviceSize size);
+        [[nodiscard]] UploadTicket uploadImage(VkImage image, const VulkanImageUploadInfo& upload_info, const void* data, VkDeviceSize size);
+
+        //  Submits recorded copies, returned ticket covers every upload made so far
+        UploadTicket flush();
+
+        [[nodiscard]] bool checkCompleted(UploadTicket ticket) const;   //  Copy finished on transfer queue
+        [[nodiscard]] bool checkAvailable(UploadTicket ticket) const;   //  Ownership acquired by graphics queue, resource can be used by render commands
+        void waitForTicket(UploadTicket ticket);                        //  Blocking, meant for loader threads only
+
+        [[nodiscard]] VkSemaphore getTimelineSemaphore() const { return m_timeline_semaphore; }
+
+        static VulkanUploadManager& get() { return *s_instance; }
+
+    private:
+        struct UploadBatch
+        {
+            VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+            uint64_t ticket = 0;
+            VkDeviceSize staging_end = 0;
+
+            //  Graphics queue halves of queue family ownership transfers
+            std::vector<VkBufferMemoryBarrier> buffer_acquires;
+            std::vector<VkImageMemoryBarrier> image_acquires;
+        };
+
+        struct AcquireInfo
+        {
+            VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+            uint64_t wait_value = 0;
+        };
+
+        std::mutex m_mutex;
+        VkSemaphore m_timeline_semaphore = VK_NULL_HANDLE;
+
+        //  Staging ring buffer
+        VkApiAllocatedBuffer m_staging_buffer{};
+        std::byte* m_staging_memory = nullptr;
+        VkDeviceSize m_staging_size = 0;
+        VkDeviceSize m_staging_alignment = 16;
+        VkDeviceSize m_staging_head = 0;
+        VkDeviceSize m_staging_tail = 0;
+
+        //  Transfer queue recording
+        VkCommandPool m_transfer_pool = VK_NULL_HANDLE;
+        std::vector<VkCommandBuffer> m_free_command_buffers;
+
+        UploadBatch m_recording_batch{};
+        std::deque<UploadBatch> m_submitted_batches;
+        uint64_t m_next_ticket = 1;
+        uint64_t m_submitted_ticket = 0;
+
+        //  Graphics queue side
+        Scope<VulkanCommandPool> m_acquire_pool;
+        std::vector<VkBufferMemoryBarrier> m_pending_buffer_acquires;
+        std::vector<VkImageMemoryBarrier> m_pending_image_acquires;
+        uint64_t m_pending_acquire_ticket = 0;
+        std::atomic_uint64_t m_acquired_ticket = 0;
+
+        [[nodiscard]] std::optional<VkDeviceSize> allocateStaging(VkDeviceSize size);
+        VkDeviceSize reserveStaging(VkDeviceSize size);
+        VkCommandBuffer beginRecording();
+
+        void submitBatch();
+        void reclaimCompletedBatches();
+        [[nodiscard]] uint64_t getCompletedTicket() const;
+
+        static VulkanUploadManager* s_instance;
+
+        //  Called by VulkanExecuteCommandsVisitor on render thread, never waits for uploads
+        friend class VulkanExecuteCommandsVisitor;
+        AcquireInfo acquireUploads(uint32_t frame_in_flight);
+    };
+
+}
+
+#endif //VULKANUPLOADMANAGER_H
@@ -0,0 +1,73 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef GEOMETRYBUFFER_H
+#define GEOMETRYBUFFER_H
+
+#include <span>
+#include <cstddef>
+
+#include "core/Core.h"
+#include "core/Types.h"
+#include "memory/OffsetAllocator.h"
+
+namespace nebula::rendering {
+
+    //  Mesh stored in GeometryBuffer, vertex and first index are passed to indexed draw instead of binding buffer offsets
+    struct NEBULA_API MeshAllocation
+    {
+        memory::OffsetAllocation vertices{};
+        memory::OffsetAllocation indices{};
+
+        int32_t vertex_offset = 0;      //  In vertices of mesh stride
+        uint32_t vertex_count = 0;
+        uint32_t first_index = 0;
+        uint32_t index_count = 0;
+
+        uint64_t upload_ticket = 0;     //  Backend ticket of upload writing this mesh, 0 when written immediately
+
+        [[nodiscard]] bool valid() const { return vertices.valid() && indices.valid(); }
+    };
+
+    //  Single device local buffer holding vertices and 32 bit indices of many meshes.
+    //  Meshes are suballocated with OffsetAllocator, so drawing them doesn't rebind buffers and small meshes
+    //  don't pay for separate allocations. Vertices of every mesh start at multiple of its stride, which lets
+    //  meshes with different layouts share buffer. Buffer is bound to vertex binding 0.
+    class NEBULA_API GeometryBuffer
+    {
+    public:
+        explicit GeometryBuffer(uint64_t size);
+        virtual ~GeometryBuffer() = default;
+
+        GeometryBuffer(const GeometryBuffer&) = delete;
+        GeometryBuffer& operator = (const GeometryBuffer&) = delete;
+
+        //  Returns invalid allocation if buffer is too fragmented or full
+        [[nodiscard]] MeshAllocation uploadMesh(std::span<const std::byte> vertices, uint32_t vertex_stride, std::span<const uint32_t> indices);
+        //  Range can be reused right away, caller has to make sure no frame in flight still draws the mesh
+        void freeMesh(const MeshAllocation& mesh);
+
+        //  Uploads may be asynchronous, meshes shouldn't be drawn before they are resident
+        [[nodiscard]] virtual bool checkUploaded([[maybe_unused]] const MeshAllocation& mesh) const { return true; }
+        [[nodiscard]] virtual void* getBufferHandle() const = 0;
+
+        [[nodiscard]] uint64_t getCapacity() const { return m_allocator.getCapacity(); }
+        [[nodiscard]] uint64_t getUsedSize() const { return m_allocator.getUsedSize(); }
+        [[nodiscard]] uint32_t getMeshCount() const { return m_mesh_count; }
+
+        [[nodiscard]] static Reference<GeometryBuffer> create(uint64_t size);
+
+    protected:
+        //  Returns backend upload ticket stored in MeshAllocation, 0 when data is written immediately
+        virtual uint64_t writeData(uint64_t offset, const void* data, uint64_t size) = 0;
+
+    private:
+        memory::OffsetAllocator m_allocator;
+        uint32_t m_mesh_count = 0;
+    };
+
+}
+
+#endif //GEOMETRYBUFFER_H
@@ -0,0 +1,99 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef GPUPROFILER_H
+#define GPUPROFILER_H
+
+#include <map>
+#include <mutex>
+#include <array>
+#include <string>
+#include <vector>
+#include <optional>
+
+#include "core/Core.h"
+
+namespace nebula::rendering {
+
+    struct NEBULA_API GpuZoneStats
+    {
+        std::string name;
+        uint32_t pass = 0;
+        std::optional<uint32_t> stage{};    //  Empty for whole render pass
+
+        double milliseconds = 0.0;
+        double average_milliseconds = 0.0;
+    };
+
+    class NEBULA_API GpuProfiler
+    {
+    public:
+        static constexpr uint32_t cMaxQueriesPerFrame = 256;
+        static constexpr uint32_t cAverageWindow = 64;
+
+        virtual ~GpuProfiler();
+
+        //  Thread safe snapshot of last resolved frame, ordered by pass then stage
+        [[nodiscard]] std::vector<GpuZoneStats> getZoneStats() const;
+
+        static bool checkEnabled() { return s_instance != nullptr; }
+        static GpuProfiler& get() { return *s_instance; }
+
+    protected:
+        explicit GpuProfiler(uint32_t frames_in_flight);
+
+        struct ZoneQueries
+        {
+            uint32_t pass = 0;
+            std::optional<uint32_t> stage{};
+            uint32_t begin_query = 0;
+            uint32_t end_query = 0;
+        };
+
+        struct FrameQueries
+        {
+            uint32_t used_queries = 0;
+            uint32_t pass_count = 0;
+            uint32_t stage_count = 0;
+
+            std::optional<uint32_t> open_pass{};    //  Index into zones
+            std::optional<uint32_t> open_stage{};
+
+            std::vector<ZoneQueries> zones{};
+        };
+
+        //  Recording side, return query slot timestamp should be written to
+        std::optional<uint32_t> beginZone(uint32_t frame_in_flight, bool stage);
+        std::optional<uint32_t> endZone(uint32_t frame_in_flight, bool stage);
+
+        //  Readback side, timestamps are indexed by query slot
+        void resolveFrame(uint32_t frame_in_flight, const uint64_t* timestamps, double nanoseconds_per_tick, uint64_t valid_bits_mask = UINT64_MAX);
+        void resetFrame(uint32_t frame_in_flight);
+
+        [[nodiscard]] const FrameQueries& viewFrameQueries(const uint32_t frame_in_flight) const { return m_frame_queries[frame_in_flight]; }
+
+    private:
+        using ZoneID = std::pair<uint32_t, uint32_t>;   //  Stage UINT32_MAX marks whole pass
+
+        struct ZoneHistory
+        {
+            std::array<double, cAverageWindow> samples{};
+            uint32_t sample_count = 0;
+            uint32_t next_sample = 0;
+            double sum = 0.0;
+            double last = 0.0;
+        };
+
+        std::vector<FrameQueries> m_frame_queries;
+
+        mutable std::mutex m_stats_mutex;
+        std::map<ZoneID, ZoneHistory> m_zone_history;
+
+        static GpuProfiler* s_instance;
+    };
+
+}
+
+#endif //GPUPROFILER_H
@@ -6,11 +6,15 @@
 #ifndef GRAPHICSPIPELINESTATE_H
 #define GRAPHICSPIPELINESTATE_H
 
+#include <vector>
+#include <initializer_list>
+
 #include "core/Core.h"
 #include "core/Assert.h"
 
 #include "Shader.h"
 #include "rendering/TextureFormats.h"
+#include "rendering/VertexFormats.h"
 
 namespace nebula::rendering {
 
@@ -49,14 +53,115 @@ namespace nebula::rendering {
         cBackAndFront
     };
 
+    enum class BlendFactor : uint8_t
+    {
+        cZero,
+        cOne,
+        cSrcColor,
+        cOneMinusSrcColor,
+        cDstColor,
+        cOneMinusDstColor,
+        cSrcAlpha,
+        cOneMinusSrcAlpha,
+        cDstAlpha,
+        cOneMinusDstAlpha,
+        cConstantColor,
+        cOneMinusConstantColor,
+        cConstantAlpha,
+        cOneMinusConstantAlpha,
+        cSrcAlphaSaturate
+    };
+
+    enum class BlendOperation : uint8_t
+    {
+        cAdd,
+        cSubtract,
+        cReverseSubtract,
+        cMin,
+        cMax
+    };
+
+    enum class VertexInputRate : uint8_t
+    {
+        cVertex,
+        cInstance
+    };
+
+    struct NEBULA_API VertexAttribute
+    {
+        uint32_t location = 0;
+        uint32_t binding = 0;
+        VertexFormat format = VertexFormat::cFloat3;
+        uint32_t offset = 0;        //  In bytes from start of vertex
+
+        friend bool operator == (const VertexAttribute&, const VertexAttribute&) = default;
+    };
+
+    struct NEBULA_API VertexBinding
+    {
+        uint32_t binding = 0;
+        uint32_t stride = 0;
+        VertexInputRate input_rate = VertexInputRate::cVertex;
+
+        friend bool operator == (const VertexBinding&, const VertexBinding&) = default;
+    };
+
+    //  Empty layout means vertices are generated in shader or pulled from storage buffers
     struct NEBULA_API VertexLayout
     {
-        //  TODO: Implement!!!
+        std::vector<VertexBinding> bindings{};
+        std::vector<VertexAttribute> attributes{};
+
+        //  Single tightly packed binding, attribute locations follow given order
+        [[nodiscard]] static VertexLayout createInterleaved(std::initializer_list<VertexFormat> formats, VertexInputRate input_rate = VertexInputRate::cVertex);
+
+        [[nodiscard]] uint32_t getStride(uint32_t binding = 0) const;
+        [[nodiscard]] bool empty() const { return attributes.empty(); }
+
+        friend bool operator == (const VertexLayout&, const VertexLayout&) = default;
+    };
+
+    enum class DescriptorType : uint8_t
+    {
+        cUniformBuffer,
+        cStorageBuffer,
+        cSampler,
+        cSampledImage,
+        cStorageImage,
+        cCombinedImageSampler
+    };
+
+    enum DescriptorStage : uint8_t
+    {
+        cVertexStage = 1,
+        cFragmentStage = 2,
+        cAllGraphicsStages = cVertexStage | cFragmentStage
+    };
+
+    struct NEBULA_API DescriptorBinding
+    {
+        uint32_t binding = 0;
+        uint32_t count = 1;
+        DescriptorType type = DescriptorType::cUniformBuffer;
+        DescriptorStage stages = cAllGraphicsStages;
+
+        friend bool operator == (const DescriptorBinding&, const DescriptorBinding&) = default;
+    };
+
+    struct NEBULA_API DescriptorSetLayout
+    {
+        std::vector<DescriptorBinding> bindings{};
+
+        friend bool operator == (const DescriptorSetLayout&, const DescriptorSetLayout&) = default;
     };
 
     struct NEBULA_API PipelineLayout
     {
-        //  TODO: Implement!!!
+        //  Bindless resource table takes set 0 and resource handles are passed in push constants
+        bool bindless = false;
+        std::vector<DescriptorSetLayout> descriptor_sets{};
+
+        friend bool operator == (const PipelineLayout&, const PipelineLayout&) = default;
     };
 
     struct NEBULA_API InputAssemblyState
@@ -109,7 +214,14 @@ namespace nebula::rendering {
     struct NEBULA_API ColorBlendingState
     {
         bool enabled = false;
-        //  TODO: Implement
+
+        //  Same equation applies to every color attachment, defaults overwrite destination with source
+        BlendFactor src_color_factor = BlendFactor::cOne;
+        BlendFactor dst_color_factor = BlendFactor::cZero;
+        BlendOperation color_operation = BlendOperation::cAdd;
+        BlendFactor src_alpha_factor = BlendFactor::cOne;
+        BlendFactor dst_alpha_factor = BlendFactor::cZero;
+        BlendOperation alpha_operation = BlendOperation::cAdd;
 
         friend bool operator == (const ColorBlendingState&, const ColorBlendingState&) = default;
     };
@@ -138,6 +250,9 @@ namespace nebula::rendering {
     };
 
     //  Hash functors
+    struct VertexLayoutHash     { std::size_t operator() (const VertexLayout&) const; };
+    struct DescriptorSetLayoutHash  { std::size_t operator() (const DescriptorSetLayout&) const; };
+    struct PipelineLayoutHash   { std::size_t operator() (const PipelineLayout&) const; };
     struct InputAssemblyHash    { std::size_t operator() (const InputAssemblyState&) const; };
     struct RasterizationHash    { std::size_t operator() (const RasterizationState&) const; };
     struct DepthStencilHash     { std::size_t operator() (const DepthStencilState&) const; };
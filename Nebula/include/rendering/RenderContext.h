@@ -34,8 +34,8 @@ namespace nebula {
         public:
             virtual ~RenderContext();
 
-            void setVSync(const bool vsync) { m_vsync = vsync; }
-            [[nodiscard]] bool checkVSync() const { return m_vsync; }
+            void setVSync(const bool vsync) { m_vsync.store(vsync); }
+            [[nodiscard]] bool checkVSync() const { return m_vsync.load(); }
 
             void setRenderFps(const uint32_t fps) { m_current_render_fps.store(fps); }
             [[nodiscard]] std::atomic_uint32_t getRenderFps() const { return m_current_render_fps.load(); }
@@ -49,7 +49,7 @@ namespace nebula {
         protected:
             RenderContext();    //  Defined in MainRenderThread
 
-            bool m_vsync = true;
+            std::atomic_bool m_vsync = true;     //  Toggled from ImGui on update thread
             uint32_t m_frames_in_flight_number;
             std::atomic_uint32_t m_current_render_frame;
             std::atomic_uint32_t m_current_render_fps = 60;
@@ -68,7 +68,7 @@ namespace nebula {
             virtual void presentImage() = 0;
             virtual Reference<Framebuffer> getNextImage() = 0;
 
-            virtual Scope<ExecuteCommandVisitor> getCommandExecutor() = 0; 
+            virtual ExecuteCommandVisitor& getCommandExecutor() = 0;
 
             [[nodiscard]] virtual const Reference<FramebufferTemplate>& viewFramebufferTemplate() const = 0;
 
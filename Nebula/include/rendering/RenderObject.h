@@ -8,6 +8,7 @@
 
 #include "core/Core.h"
 #include "RenderObjectVisitor.h"
+#include "GeometryBuffer.h"
 
 namespace nebula::rendering {
 
@@ -37,6 +38,26 @@ namespace nebula::rendering {
         uint32_t m_num_indices{};
     };
 
+    class NEBULA_API MeshRenderObject final : public RenderObject
+    {
+    public:
+        MeshRenderObject(const GeometryBuffer& geometry_buffer, const MeshAllocation& mesh, const uint32_t instance_count = 1) :
+                m_geometry_buffer(geometry_buffer),
+                m_mesh(mesh),
+                m_instance_count(instance_count)
+        {}
+        void accept(RenderObjectVisitor& visitor) const override { visitor.draw(*this); }
+
+        [[nodiscard]] const GeometryBuffer& viewGeometryBuffer() const { return m_geometry_buffer; }
+        [[nodiscard]] const MeshAllocation& viewMesh() const { return m_mesh; }
+        [[nodiscard]] uint32_t getInstanceCount() const { return m_instance_count; }
+
+    private:
+        const GeometryBuffer& m_geometry_buffer;
+        MeshAllocation m_mesh;
+        uint32_t m_instance_count;
+    };
+
 }
 
 #endif //RENDEROBJECT_H
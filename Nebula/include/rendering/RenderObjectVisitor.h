@@ -12,6 +12,7 @@ namespace nebula::rendering {
 
     class ImGuiRenderObject;
     class DummyVerticesRenderObject;
+    class MeshRenderObject;
 
     class NEBULA_API RenderObjectVisitor
     {
@@ -20,6 +21,7 @@ namespace nebula::rendering {
 
         virtual void draw(const ImGuiRenderObject& imgui_layer) {}
         virtual void draw(const DummyVerticesRenderObject& imgui_layer) {}
+        virtual void draw(const MeshRenderObject& render_object) {}
     };
 
 }
@@ -0,0 +1,73 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef VERTEXFORMATS_H
+#define VERTEXFORMATS_H
+
+#include <cstdint>
+
+#include <glm/glm.hpp>
+
+#include "core/Core.h"
+
+namespace nebula::rendering {
+
+    enum class VertexFormat : uint8_t
+    {
+        cFloat,         //  float32
+        cFloat2,
+        cFloat3,
+        cFloat4,
+
+        cHalf2,         //  float16
+        cHalf4,
+
+        cSnorm16x2,     //  [-1.0, 1.0] float stored in int16, octahedral normals
+        cSnorm16x4,     //  Quantized positions, w is padding
+        cUnorm16x2,     //  [0.0, 1.0] float stored in uint16, texture coordinates
+
+        cSnorm8x4,      //  Tangents
+        cUnorm8x4,      //  Colors
+
+        cUint32         //  Passed to shader as integer
+    };
+
+    [[nodiscard]] NEBULA_API uint32_t getVertexFormatSize(VertexFormat format);
+    [[nodiscard]] NEBULA_API uint32_t getVertexFormatComponents(VertexFormat format);
+    //  Integer formats are not converted to floats when read in shaders
+    [[nodiscard]] NEBULA_API bool isIntegerVertexFormat(VertexFormat format);
+
+    ////////////////////////////////////////////////////////////////////
+    //////  Vertex packing  ////////////////////////////////////////////
+    ////////////////////////////////////////////////////////////////////
+
+    //  IEEE half precision, rounds to nearest even and keeps infinities and NaNs
+    [[nodiscard]] NEBULA_API uint16_t packHalf(float value);
+    [[nodiscard]] NEBULA_API float unpackHalf(uint16_t value);
+
+    [[nodiscard]] NEBULA_API int16_t packSnorm16(float value);
+    [[nodiscard]] NEBULA_API float unpackSnorm16(int16_t value);
+    [[nodiscard]] NEBULA_API uint16_t packUnorm16(float value);
+    [[nodiscard]] NEBULA_API float unpackUnorm16(uint16_t value);
+
+    //  Unit vector folded onto octahedron and unwrapped to [-1, 1] square, 2 components instead of 3
+    [[nodiscard]] NEBULA_API glm::vec2 encodeOctahedral(const glm::vec3& normal);
+    [[nodiscard]] NEBULA_API glm::vec3 decodeOctahedral(const glm::vec2& encoded);
+
+    //  Positions stored relative to mesh bounds, shader reconstructs them as offset + snorm * scale
+    struct NEBULA_API VertexQuantization
+    {
+        glm::vec3 offset{0.0f};     //  Center of bounds
+        glm::vec3 scale{1.0f};      //  Half extents of bounds
+
+        [[nodiscard]] static VertexQuantization fromBounds(const glm::vec3& min, const glm::vec3& max);
+
+        void quantizePosition(const glm::vec3& position, int16_t* packed) const;    //  Writes 4 components
+        [[nodiscard]] glm::vec3 dequantizePosition(const int16_t* packed) const;
+    };
+
+}
+
+#endif //VERTEXFORMATS_H
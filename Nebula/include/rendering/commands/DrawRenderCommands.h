@@ -7,6 +7,7 @@
 #define DRAWRENDERCOMMANDS_H
 
 #include "RenderCommand.h"
+#include "rendering/GeometryBuffer.h"
 
 namespace nebula::rendering {
 
@@ -18,6 +19,25 @@ namespace nebula::rendering {
         void accept(RenderCommandVisitor& command_visitor) override { command_visitor.visit(*this); }
     };
 
+    //  Indexed draw of mesh suballocated in GeometryBuffer, buffer is rebound only when it changes
+    struct NEBULA_API DrawMeshCommand final : RenderCommand
+    {
+        void* geometry_buffer_handle;
+        uint32_t first_index;
+        uint32_t index_count;
+        int32_t vertex_offset;
+        uint32_t instance_count;
+
+        DrawMeshCommand(void* geometry_buffer_handle, const MeshAllocation& mesh, const uint32_t instance_count) :
+                geometry_buffer_handle(geometry_buffer_handle),
+                first_index(mesh.first_index),
+                index_count(mesh.index_count),
+                vertex_offset(mesh.vertex_offset),
+                instance_count(instance_count)
+        {}
+        void accept(RenderCommandVisitor& command_visitor) override { command_visitor.visit(*this); }
+    };
+
 }
 
 #endif //DRAWRENDERCOMMANDS_H
@@ -6,10 +6,12 @@
 #ifndef RENDERCOMMANDBUFFER_H
 #define RENDERCOMMANDBUFFER_H
 
+#include <memory>
 #include <vector>
 
 #include "core/Core.h"
 #include "memory/Allocators.h"
+#include "debug/FrameCounters.h"
 #include "RenderCommand.h"
 
 namespace nebula::rendering {
@@ -45,13 +47,17 @@ namespace nebula::rendering {
         template <typename RenderCommand, typename... Args>
         void submit(Args&&... args)
         {
+            NB_COUNT(cRenderCommands, 1);
+            NB_COUNT(cRenderCommandBytes, sizeof(RenderCommand));
             m_commands.push_back(m_allocator.create<RenderCommand>(std::forward<Args>(args)...));
         }
 
         template <typename RenderCommand, typename... Args>
         void replace(const int index, Args&&... args)
         {
+            NB_COUNT(cRenderCommandBytes, sizeof(RenderCommand));
             RenderCommand* new_command = m_allocator.create<RenderCommand>(std::forward<Args>(args)...);
+            std::destroy_at(m_commands[index]);
             m_commands[index] = new_command;
         }
 
@@ -15,6 +15,7 @@ namespace nebula::rendering {
     struct BindGraphicsPipelineCommand;
     struct DrawImGuiCommand;
     struct DrawDummyIndicesCommand;
+    struct DrawMeshCommand;
 
     class NEBULA_API RenderCommandVisitor
     {
@@ -26,21 +27,23 @@ namespace nebula::rendering {
         virtual void visit(BindGraphicsPipelineCommand& command) {}
         virtual void visit(DrawImGuiCommand& command) {}
         virtual void visit(DrawDummyIndicesCommand& command) {}
+        virtual void visit(DrawMeshCommand& command) {}
     };
 
     class RenderCommandBuffer;
     class RecordedCommandBuffer;
 
+    //  Visitors are long lived and reused every frame, so they can keep their scratch storage
     class RecordCommandVisitor : public RenderCommandVisitor
     {
     public:
-        virtual Scope<RecordedCommandBuffer> recordCommands(Scope<RenderCommandBuffer>&& commands) = 0;
+        virtual void recordCommands(const RenderCommandBuffer& commands) = 0;
     };
 
     class ExecuteCommandVisitor : public RenderCommandVisitor
     {
     public:
-        virtual void executeCommands(Scope<RecordedCommandBuffer>&& commands) = 0;
+        virtual void executeCommands(RecordedCommandBuffer& commands) = 0;
         virtual void submitCommands() = 0;
     };
 
@@ -46,18 +46,18 @@ namespace nebula::rendering {
         RenderArea scissor;
         RenderArea viewport;
         void* graphics_pipeline_handle;
-        GraphicsPipelineState graphics_pipeline_state;
+        const GraphicsPipelineState& graphics_pipeline_state;     //  Owned by RenderPassTemplate, copying would allocate every frame
 
         explicit BindGraphicsPipelineCommand(
             RenderArea scissor,
             RenderArea viewport,
-            GraphicsPipelineState pipeline,
+            const GraphicsPipelineState& pipeline,
             void* pipeline_handle
         ) :
                 scissor(scissor),
                 viewport(viewport),
                 graphics_pipeline_handle(pipeline_handle),
-                graphics_pipeline_state(std::move(pipeline))
+                graphics_pipeline_state(pipeline)
         {}
 
         void accept(RenderCommandVisitor& command_visitor) override { command_visitor.visit(*this); }
@@ -0,0 +1,154 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef BOUNDINGVOLUMEHIERARCHY_H
+#define BOUNDINGVOLUMEHIERARCHY_H
+
+#include <span>
+#include <limits>
+#include <vector>
+#include <optional>
+
+#include "core/Core.h"
+#include "rendering/culling/Frustum.h"
+
+namespace nebula::rendering {
+
+    struct Ray
+    {
+        glm::vec3 origin{0.0f};
+        glm::vec3 direction{0.0f, 0.0f, 1.0f};
+    };
+
+    struct RayHit
+    {
+        uint32_t object;
+        float distance;     //  Entry distance into object bounds, in units of ray direction length
+    };
+
+    //  4-wide node, child bounds in SoA so one node is tested against query in single SIMD pass.
+    //  Two cache lines, empty slots have inverted bounds that fail every test.
+    struct alignas(64) BvhNode
+    {
+        static constexpr uint32_t cWidth = 4;
+        static constexpr uint32_t cEmptyChild = std::numeric_limits<uint32_t>::max();
+        static constexpr uint32_t cLeafFlag = 1u << 31;     //  Child is item id, otherwise node index
+
+        float min_x[cWidth];
+        float min_y[cWidth];
+        float min_z[cWidth];
+        float max_x[cWidth];
+        float max_y[cWidth];
+        float max_z[cWidth];
+
+        uint32_t children[cWidth];
+        uint32_t parent;
+        uint32_t parent_slot;
+    };
+
+    //  Single tree of items (up to 2^31), built top down with binned SAH or grown by incremental insertion
+    class NEBULA_API BvhTree
+    {
+    public:
+        static constexpr uint32_t cInvalidNode = std::numeric_limits<uint32_t>::max();
+
+        struct BuildItem;   //  Working record of SAH build
+
+        //  Replaces tree, item ids are indices of bounds
+        void build(std::span<const BoundingBox> bounds);
+        void clear();
+
+        void insert(uint32_t item, const BoundingBox& bounds);
+        void remove(uint32_t item);
+        //  Changes leaf bounds in place, ancestors are fixed by refit()
+        void setBounds(uint32_t item, const BoundingBox& bounds);
+        void refit();
+
+        [[nodiscard]] BoundingBox getBounds(uint32_t item) const;
+
+        //  Items are translated through item_objects when given. Leaf hits are refined against item_bounds when given,
+        //  so tree can hold enlarged bounds without returning false hits.
+        void cullFrustum(const Frustum& frustum, std::vector<uint32_t>& objects, const uint32_t* item_objects = nullptr, const BoundingBox* item_bounds = nullptr) const;
+        void queryOverlap(const BoundingBox& bounds, std::vector<uint32_t>& objects, const uint32_t* item_objects = nullptr, const BoundingBox* item_bounds = nullptr) const;
+        [[nodiscard]] std::optional<RayHit> rayCast(const Ray& ray, float max_distance, const uint32_t* item_objects = nullptr, const BoundingBox* item_bounds = nullptr) const;
+
+        [[nodiscard]] uint32_t getNodeCount() const { return static_cast<uint32_t>(m_nodes.size() - m_free_nodes.size()); }
+        [[nodiscard]] bool empty() const { return m_root == cInvalidNode; }
+
+    private:
+        struct ItemLocation
+        {
+            uint32_t node = cInvalidNode;
+            uint32_t slot = 0;
+        };
+
+        std::vector<BvhNode> m_nodes{};
+        std::vector<uint32_t> m_free_nodes{};
+        std::vector<ItemLocation> m_item_locations{};
+        std::vector<uint32_t> m_dirty_nodes{};
+        uint32_t m_root = cInvalidNode;
+
+        uint32_t allocateNode(uint32_t parent, uint32_t parent_slot);
+        void freeNode(uint32_t node);
+
+        void setChild(uint32_t node, uint32_t slot, uint32_t child, const BoundingBox& bounds);
+        void clearChild(uint32_t node, uint32_t slot);
+        [[nodiscard]] BoundingBox getNodeBounds(uint32_t node) const;
+        [[nodiscard]] BoundingBox getChildBounds(uint32_t node, uint32_t slot) const;
+
+        //  Propagates union of node children to parents while it changes
+        void refitUpwards(uint32_t node);
+
+        uint32_t buildNode(std::span<BuildItem> items, const BoundingBox& bounds, uint32_t parent, uint32_t parent_slot);
+    };
+
+    struct BvhStatistics
+    {
+        double build_milliseconds = 0.0;    //  Last static build
+        double refit_milliseconds = 0.0;    //  Last dynamic refit
+        uint32_t reinsertions = 0;          //  Dynamic proxies moved outside their fat bounds since last refit
+        uint32_t static_nodes = 0;
+        uint32_t dynamic_nodes = 0;
+    };
+
+    //  Scene queries over render object bounds. Static objects are built once with SAH,
+    //  dynamic ones live in second tree with fattened bounds, moves inside them are free and objects leaving them are reinserted.
+    //  Hits of dynamic tree are refined against exact proxy bounds.
+    class NEBULA_API BoundingVolumeHierarchy
+    {
+    public:
+        using Proxy = uint32_t;
+
+        //  Object ids are indices of bounds
+        void buildStatic(std::span<const BoundingBox> bounds);
+
+        Proxy addDynamic(uint32_t object, const BoundingBox& bounds);
+        void updateDynamic(Proxy proxy, const BoundingBox& bounds);
+        void removeDynamic(Proxy proxy);
+        //  Has to be called after dynamic updates, before queries
+        void refit();
+
+        //  Appends object ids of both trees
+        void cullFrustum(const Frustum& frustum, std::vector<uint32_t>& objects) const;
+        void queryOverlap(const BoundingBox& bounds, std::vector<uint32_t>& objects) const;
+        [[nodiscard]] std::optional<RayHit> rayCast(const Ray& ray, float max_distance = std::numeric_limits<float>::max()) const;
+
+        [[nodiscard]] const BvhStatistics& getStatistics() const { return m_statistics; }
+
+    private:
+        BvhTree m_static_tree{};
+        BvhTree m_dynamic_tree{};
+
+        std::vector<uint32_t> m_proxy_objects{};
+        std::vector<BoundingBox> m_proxy_bounds{};      //  Exact, tree holds fattened ones
+        std::vector<Proxy> m_free_proxies{};
+
+        uint32_t m_reinsertions = 0;
+        BvhStatistics m_statistics{};
+    };
+
+}
+
+#endif //BOUNDINGVOLUMEHIERARCHY_H
@@ -0,0 +1,62 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef CULLINGBOUNDS_H
+#define CULLINGBOUNDS_H
+
+#include <vector>
+
+#include "core/Core.h"
+#include "rendering/culling/Frustum.h"
+
+namespace nebula::rendering {
+
+    //  Object bounds in SoA arrays, every object keeps both box extents and sphere radius so tests use the tighter one.
+    //  Arrays are padded to cLaneCount with bounds that never pass a plane test, so SIMD kernels need no tail handling.
+    class NEBULA_API CullingBounds
+    {
+    public:
+        static constexpr uint32_t cLaneCount = 8;
+
+        uint32_t add(const BoundingBox& box);
+        uint32_t add(const BoundingSphere& sphere);
+
+        void set(uint32_t index, const BoundingBox& box);
+        void set(uint32_t index, const BoundingSphere& sphere);
+
+        void clear();
+        void reserve(uint32_t count);
+
+        [[nodiscard]] uint32_t size() const { return m_count; }
+        //  Multiple of cLaneCount
+        [[nodiscard]] uint32_t getPaddedSize() const { return static_cast<uint32_t>(m_radius.size()); }
+
+        [[nodiscard]] const float* getCentersX() const { return m_center_x.data(); }
+        [[nodiscard]] const float* getCentersY() const { return m_center_y.data(); }
+        [[nodiscard]] const float* getCentersZ() const { return m_center_z.data(); }
+        [[nodiscard]] const float* getExtentsX() const { return m_extent_x.data(); }
+        [[nodiscard]] const float* getExtentsY() const { return m_extent_y.data(); }
+        [[nodiscard]] const float* getExtentsZ() const { return m_extent_z.data(); }
+        [[nodiscard]] const float* getRadii() const { return m_radius.data(); }
+
+        [[nodiscard]] BoundingBox getBox(uint32_t index) const;
+
+    private:
+        std::vector<float> m_center_x{};
+        std::vector<float> m_center_y{};
+        std::vector<float> m_center_z{};
+        std::vector<float> m_extent_x{};
+        std::vector<float> m_extent_y{};
+        std::vector<float> m_extent_z{};
+        std::vector<float> m_radius{};
+
+        uint32_t m_count = 0;
+
+        uint32_t push();
+    };
+
+}
+
+#endif //CULLINGBOUNDS_H
@@ -0,0 +1,61 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+#include <array>
+#include <cstdint>
+
+#include <glm/glm.hpp>
+
+namespace nebula::rendering {
+
+    struct BoundingSphere
+    {
+        glm::vec3 center{0.0f};
+        float radius = 0.0f;
+    };
+
+    struct BoundingBox
+    {
+        glm::vec3 min{0.0f};
+        glm::vec3 max{0.0f};
+    };
+
+    //  Planes point inside, xyz is unit normal and w distance, so point p is inside plane if dot(n, p) + w >= 0
+    struct Frustum
+    {
+        enum Plane : uint32_t { cLeft, cRight, cBottom, cTop, cNear, cFar, cPlaneCount };
+
+        std::array<glm::vec4, cPlaneCount> planes{};
+
+        //  Gribb-Hartmann extraction from column major matrix.
+        //  Near plane is derived for [-1, 1] depth range, which is conservative for zero to one projections.
+        static Frustum fromViewProjection(const glm::mat4& view_projection)
+        {
+            const glm::vec4 row0{view_projection[0][0], view_projection[1][0], view_projection[2][0], view_projection[3][0]};
+            const glm::vec4 row1{view_projection[0][1], view_projection[1][1], view_projection[2][1], view_projection[3][1]};
+            const glm::vec4 row2{view_projection[0][2], view_projection[1][2], view_projection[2][2], view_projection[3][2]};
+            const glm::vec4 row3{view_projection[0][3], view_projection[1][3], view_projection[2][3], view_projection[3][3]};
+
+            Frustum frustum;
+            frustum.planes[cLeft] = row3 + row0;
+            frustum.planes[cRight] = row3 - row0;
+            frustum.planes[cBottom] = row3 + row1;
+            frustum.planes[cTop] = row3 - row1;
+            frustum.planes[cNear] = row3 + row2;
+            frustum.planes[cFar] = row3 - row2;
+
+            for (auto& plane : frustum.planes)
+                plane /= glm::length(glm::vec3(plane));
+
+            return frustum;
+        }
+    };
+
+}
+
+#endif //FRUSTUM_H
@@ -0,0 +1,125 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef OCCLUSIONCULLER_H
+#define OCCLUSIONCULLER_H
+
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "core/Core.h"
+#include "rendering/culling/Frustum.h"
+#include "rendering/culling/CullingBounds.h"
+
+namespace nebula::rendering {
+
+    struct OcclusionStatistics
+    {
+        uint32_t occluder_triangles = 0;    //  Submitted this frame
+        uint32_t rasterized_triangles = 0;  //  Left after near plane clipping, degenerate and off screen rejection
+        uint32_t tested = 0;
+        uint32_t occluded = 0;
+        double raster_milliseconds = 0.0;   //  Occluder setup, rasterization and Hi-Z build
+        double test_milliseconds = 0.0;
+
+        [[nodiscard]] float getCullingRate() const { return tested > 0 ? static_cast<float>(occluded) / static_cast<float>(tested) : 0.0f; }
+    };
+
+    //  Software occlusion culling against low resolution depth of designated occluder meshes.
+    //  Occluder triangles are binned into screen tiles and every tile is rasterized by single job. Depth keeps nearest value,
+    //  so buffer contents don't depend on triangle or thread order. Hi-Z pyramid keeps farthest depth per texel and object
+    //  is occluded when nearest depth of its projected bounds lies behind every texel it covers.
+    //  Depth is z / w of regular (not reversed) projection, near plane is z = -w as in Frustum.
+    class NEBULA_API OcclusionCuller
+    {
+    public:
+        static constexpr uint32_t cTileSize = 32;
+
+        //  Both dimensions have to be multiples of cTileSize
+        explicit OcclusionCuller(uint32_t width = 256, uint32_t height = 128);
+
+        //  Indexed triangle list in model space, returns id used to submit occluders
+        uint32_t addOccluderMesh(std::vector<glm::vec3> vertices, std::vector<uint32_t> indices);
+        void clearOccluderMeshes();
+
+        //  Clears depth and statistics
+        void beginFrame(const glm::mat4& view_projection);
+        void addOccluder(uint32_t mesh, const glm::mat4& transform);
+        //  Rasterizes occluders on JobSystem and builds Hi-Z pyramid, has to be called before tests
+        void renderOccluders();
+
+        [[nodiscard]] bool isOccluded(const BoundingBox& bounds) const;
+        //  Removes occluded objects from indices keeping their order, returns number of remaining ones
+        uint32_t cullOccluded(const CullingBounds& bounds, std::vector<uint32_t>& indices);
+
+        [[nodiscard]] uint32_t getWidth() const { return m_width; }
+        [[nodiscard]] uint32_t getHeight() const { return m_height; }
+        [[nodiscard]] uint32_t getLevelCount() const { return static_cast<uint32_t>(m_levels.size()); }
+        //  Row major from bottom row, level 0 is full resolution depth
+        [[nodiscard]] std::span<const float> getDepth(const uint32_t level = 0) const { return m_levels[level].depth; }
+        [[nodiscard]] const OcclusionStatistics& getStatistics() const { return m_statistics; }
+
+    private:
+        struct OccluderMesh
+        {
+            std::vector<glm::vec3> vertices;
+            std::vector<uint32_t> indices;
+        };
+
+        struct OccluderInstance
+        {
+            uint32_t mesh;
+            uint32_t first_triangle;        //  Index in all triangles submitted this frame
+            glm::mat4 transform;            //  Model to clip space
+        };
+
+        struct SetupTriangle
+        {
+            float edge_a[3];                //  Edge functions a * x + b * y + c, non negative inside
+            float edge_b[3];
+            float edge_c[3];
+            float depth_a;                  //  Depth plane in screen space
+            float depth_b;
+            float depth_c;
+            int32_t min_x, min_y;           //  Inclusive pixel bounds clamped to screen
+            int32_t max_x, max_y;
+        };
+
+        struct HiZLevel
+        {
+            uint32_t width;
+            uint32_t height;
+            std::vector<float> depth;
+        };
+
+        uint32_t m_width;
+        uint32_t m_height;
+        uint32_t m_tiles_x;
+        uint32_t m_tiles_y;
+
+        glm::mat4 m_view_projection{1.0f};
+        std::vector<OccluderMesh> m_meshes{};
+        std::vector<OccluderInstance> m_instances{};
+        uint32_t m_triangle_count = 0;
+
+        //  Setup jobs own their triangles and per tile bins, indexed by job * tile count + tile
+        std::vector<std::vector<SetupTriangle>> m_setup_triangles{};
+        std::vector<std::vector<uint32_t>> m_tile_bins{};
+
+        std::vector<HiZLevel> m_levels{};
+        std::vector<uint8_t> m_visibility{};
+        OcclusionStatistics m_statistics{};
+
+        void setupTriangles(uint32_t job_index);
+        void setupTriangle(uint32_t job_index, const glm::vec4& v0, const glm::vec4& v1, const glm::vec4& v2);
+        void rasterizeTile(uint32_t tile);
+        void buildHiZ();
+    };
+
+}
+
+#endif //OCCLUSIONCULLER_H
@@ -40,6 +40,7 @@ namespace nebula::rendering {
         void nextRenderStage();
 
         [[nodiscard]] Scope<RenderCommandBuffer> getCommandBuffer() const;
+        void recycleCommandBuffer(Scope<RenderCommandBuffer>&& command_buffer);
 
         template <typename RendererType, typename RendererBackendType = ForwardRendererBackend>
         static Scope<Renderer> create()
@@ -60,10 +61,12 @@ namespace nebula::rendering {
 
         void draw(const ImGuiRenderObject& imgui_layer) override;
         void draw(const DummyVerticesRenderObject& render_object) override;
+        void draw(const MeshRenderObject& render_object) override;
 
     private:
         Scope<RendererBackend> m_renderer_backend = nullptr;
         Scope<RenderCommandBuffer> m_command_buffer = nullptr;
+        Scope<RenderCommandBuffer> m_free_command_buffer = nullptr;    //  Reused by next RenderPass
         Scope<RenderPass> m_renderpass = nullptr;
 
         RenderArea m_render_area{};
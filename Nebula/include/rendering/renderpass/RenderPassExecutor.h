@@ -22,7 +22,8 @@ namespace nebula::rendering {
         virtual ~RenderPassExecutor() = default;
 
         virtual void resetResources(uint32_t frame_in_flight);
-        [[nodiscard]] virtual Scope<RecordedCommandBuffer> execute(const RenderPassObjects& renderpass_objects, std::optional<uint32_t> frame_in_flight = {}) const; // NOLINT(*-default-arguments)
+        //  Recorded buffer is owned by executor and stays valid until next execute
+        [[nodiscard]] virtual RecordedCommandBuffer& execute(const RenderPassObjects& renderpass_objects, std::optional<uint32_t> frame_in_flight = {}); // NOLINT(*-default-arguments)
 
         void setRenderer(Scope<Renderer>&& renderer);
         void setFramebuffer(const Reference<Framebuffer>& framebuffer) const;
@@ -38,12 +39,15 @@ namespace nebula::rendering {
         explicit RenderPassExecutor(Scope<Renderer>&& renderer);
         explicit RenderPassExecutor(Scope<RenderPass>&& renderpass);
 
-        [[nodiscard]] virtual Scope<RecordedCommandBuffer> recordCommands(Scope<RenderCommandBuffer>&& commands, std::optional<uint32_t> frame_in_flight) const;
+        [[nodiscard]] virtual RecordedCommandBuffer& recordCommands(Scope<RenderCommandBuffer>&& commands, std::optional<uint32_t> frame_in_flight);
+
+        //  Hands RenderCommandBuffer back to Renderer once its commands are no longer referenced
+        void recycleCommandBuffer(Scope<RenderCommandBuffer>&& commands) const;
 
     private:
         Scope<Renderer> m_renderer;
         Scope<RenderPass> m_renderpass;
-        Scope<RecordedCommandBuffer> m_recorded_command_buffer;
+        Scope<RenderCommandBuffer> m_recorded_commands;
     };
 
 }
@@ -23,6 +23,8 @@ namespace nebula::rendering {
 
         void setStages(uint32_t stages);
         void addObject(uint32_t stage, View<RenderObject> object);
+        //  Keeps stages, objects are repopulated every frame by culling
+        void clearObjects();
 
         [[nodiscard]] const StageObjects& viewStageObjects(uint32_t stage) const;
 
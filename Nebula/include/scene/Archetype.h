@@ -0,0 +1,92 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef ARCHETYPE_H
+#define ARCHETYPE_H
+
+#include <array>
+#include <vector>
+
+#include "core/Core.h"
+#include "scene/Entity.h"
+#include "scene/Component.h"
+#include "scene/ChunkAllocator.h"
+
+namespace nebula::scene {
+
+    class Archetype;
+
+    //  Chunk memory starts with entity column followed by one column per component (SoA)
+    struct Chunk
+    {
+        std::byte* memory = nullptr;
+        uint32_t count = 0;
+    };
+
+    struct EntityLocation
+    {
+        Archetype* archetype = nullptr;
+        uint32_t chunk = 0;
+        uint32_t row = 0;
+    };
+
+    //  Storage of all entities with exactly the same component set.
+    //  Rows are kept dense, every chunk except the last one is full.
+    class NEBULA_API Archetype
+    {
+    public:
+        Archetype(const ComponentMask& mask, ChunkAllocator& chunk_allocator);
+        ~Archetype();
+
+        Archetype(const Archetype&) = delete;
+        Archetype& operator = (const Archetype&) = delete;
+
+        //  Appends row with uninitialized components, caller constructs all of them
+        EntityLocation pushEntity(Entity entity);
+        //  Components of row have to be already destroyed or relocated, last row is moved into the gap.
+        //  Returns entity that was moved or cNullEntity.
+        Entity removeEntity(uint32_t chunk, uint32_t row);
+        void destroyComponents(const EntityLocation& location);
+
+        [[nodiscard]] bool hasComponent(const ComponentID component) const { return m_mask.test(component); }
+
+        [[nodiscard]] Entity* getEntities(const Chunk& chunk) const { return reinterpret_cast<Entity*>(chunk.memory); }
+        [[nodiscard]] void* getColumn(const Chunk& chunk, const ComponentID component) const { return chunk.memory + m_column_offsets[component]; }
+        [[nodiscard]] void* getComponent(const EntityLocation& location, ComponentID component) const;
+
+        template <typename T>
+        [[nodiscard]] T* getColumn(const Chunk& chunk) const
+        {
+            return reinterpret_cast<T*>(getColumn(chunk, ComponentRegistry::getID<T>()));
+        }
+
+        [[nodiscard]] const ComponentMask& getMask() const { return m_mask; }
+        [[nodiscard]] const std::vector<ComponentID>& getComponents() const { return m_components; }
+        [[nodiscard]] const std::vector<Chunk>& getChunks() const { return m_chunks; }
+        [[nodiscard]] uint32_t getChunkCapacity() const { return m_chunk_capacity; }
+        [[nodiscard]] uint32_t getEntityCount() const { return m_entity_count; }
+
+    private:
+        ComponentMask m_mask;
+        std::vector<ComponentID> m_components{};
+        std::array<uint32_t, cMaxComponents> m_column_offsets{};
+
+        uint32_t m_chunk_capacity = 0;
+        uint32_t m_entity_count = 0;
+        std::vector<Chunk> m_chunks{};
+        ChunkAllocator& m_chunk_allocator;
+
+        //  Archetype graph, cached neighbours with one component added or removed
+        std::array<Archetype*, cMaxComponents> m_add_edges{};
+        std::array<Archetype*, cMaxComponents> m_remove_edges{};
+
+        [[nodiscard]] std::size_t computeLayout(uint32_t capacity);
+
+        friend class World;
+    };
+
+}
+
+#endif //ARCHETYPE_H
@@ -0,0 +1,50 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef CHUNKALLOCATOR_H
+#define CHUNKALLOCATOR_H
+
+#include <vector>
+#include <cstddef>
+
+#include "core/Core.h"
+#include "memory/Types.h"
+#include "memory/Allocators.h"
+
+namespace nebula::scene {
+
+    static constexpr std::size_t cChunkSize = 16_Kb;
+    static constexpr std::size_t cChunkAlignment = 64;     //  Cache line, columns never share line with chunk neighbour
+
+    //  Hands out fixed size archetype chunks from pages requested in MemoryManager.
+    //  Pages are kept until allocator is destroyed, so entity churn doesn't reach MemoryManager.
+    class NEBULA_API ChunkAllocator
+    {
+    public:
+        explicit ChunkAllocator(uint32_t chunks_per_page = 64);
+        ~ChunkAllocator();
+
+        ChunkAllocator(const ChunkAllocator&) = delete;
+        ChunkAllocator& operator = (const ChunkAllocator&) = delete;
+
+        [[nodiscard]] std::byte* allocateChunk();
+        void deallocateChunk(std::byte* chunk);
+
+        [[nodiscard]] std::size_t getPageCount() const { return m_pages.size(); }
+
+    private:
+        struct Page
+        {
+            void* memory;
+            memory::PoolAllocator allocator;
+        };
+
+        uint32_t m_chunks_per_page;
+        std::vector<Scope<Page>> m_pages{};
+    };
+
+}
+
+#endif //CHUNKALLOCATOR_H
@@ -0,0 +1,114 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef COMPONENT_H
+#define COMPONENT_H
+
+#include <new>
+#include <bitset>
+#include <string>
+#include <cstring>
+#include <typeinfo>
+#include <type_traits>
+
+#include "core/Core.h"
+
+namespace nebula::scene {
+
+    using ComponentID = uint32_t;
+
+    static constexpr uint32_t cMaxComponents = 64;
+    using ComponentMask = std::bitset<cMaxComponents>;
+
+    struct ComponentInfo
+    {
+        std::string name{};
+        uint32_t size = 0;
+        uint32_t alignment = 0;
+
+        //  Null for trivially copyable and trivially destructible components, rows are then memcpy'd and dropped
+        void (*relocate)(void* destination, void* source) = nullptr;    //  Move constructs destination and destroys source
+        void (*destroy)(void* address) = nullptr;
+    };
+
+    //  Type erased component value, consumed by relocation into World
+    struct ComponentData
+    {
+        ComponentID component;
+        void* data;
+    };
+
+    template <typename T>
+    concept ComponentType = std::is_same_v<T, std::remove_cvref_t<T>> && std::is_nothrow_move_constructible_v<T> && std::is_nothrow_destructible_v<T>;
+
+    class NEBULA_API ComponentRegistry
+    {
+    public:
+        template <ComponentType T>
+        static ComponentID getID()
+        {
+            //  Registered by type name, so engine and client modules agree on IDs
+            static const ComponentID s_id = registerComponent(createInfo<T>());
+            return s_id;
+        }
+
+        template <typename... Components>
+        static const ComponentMask& getMask()
+        {
+            static const ComponentMask s_mask = []
+            {
+                ComponentMask mask;
+                (mask.set(getID<Components>()), ...);
+                return mask;
+            }();
+
+            return s_mask;
+        }
+
+        static const ComponentInfo& getInfo(ComponentID component);
+        static uint32_t getComponentCount();
+
+    private:
+        static ComponentID registerComponent(ComponentInfo&& info);
+
+        template <typename T>
+        static ComponentInfo createInfo()
+        {
+            ComponentInfo info{typeid(T).name(), sizeof(T), alignof(T)};
+
+            if constexpr (!std::is_trivially_copyable_v<T>)
+            {
+                info.relocate = [](void* destination, void* source)
+                {
+                    T* object = static_cast<T*>(source);
+                    new (destination) T(std::move(*object));
+                    object->~T();
+                };
+            }
+
+            if constexpr (!std::is_trivially_destructible_v<T>)
+                info.destroy = [](void* address) { static_cast<T*>(address)->~T(); };
+
+            return info;
+        }
+    };
+
+    inline void relocateComponent(const ComponentInfo& info, void* destination, void* source)
+    {
+        if (info.relocate)
+            info.relocate(destination, source);
+        else
+            std::memcpy(destination, source, info.size);
+    }
+
+    inline void destroyComponent(const ComponentInfo& info, void* address)
+    {
+        if (info.destroy)
+            info.destroy(address);
+    }
+
+}
+
+#endif //COMPONENT_H
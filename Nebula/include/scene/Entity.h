@@ -0,0 +1,38 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef ENTITY_H
+#define ENTITY_H
+
+#include <cstdint>
+#include <limits>
+#include <functional>
+
+namespace nebula::scene {
+
+    //  Handle to entity slot, generation invalidates handles of destroyed entities when slot is reused
+    struct Entity
+    {
+        static constexpr uint32_t cInvalidIndex = std::numeric_limits<uint32_t>::max();
+
+        uint32_t index = cInvalidIndex;
+        uint32_t generation = 0;
+
+        [[nodiscard]] bool valid() const { return index != cInvalidIndex; }
+        [[nodiscard]] uint64_t getID() const { return static_cast<uint64_t>(generation) << 32 | index; }
+
+        friend bool operator == (const Entity&, const Entity&) = default;
+    };
+
+    static constexpr Entity cNullEntity{};
+
+    struct EntityHash
+    {
+        std::size_t operator() (const Entity& entity) const { return std::hash<uint64_t>{}(entity.getID()); }
+    };
+
+}
+
+#endif //ENTITY_H
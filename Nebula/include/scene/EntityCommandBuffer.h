@@ -0,0 +1,127 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef ENTITYCOMMANDBUFFER_H
+#define ENTITYCOMMANDBUFFER_H
+
+#include <vector>
+#include <cstddef>
+
+#include "core/Core.h"
+#include "memory/Types.h"
+#include "scene/Entity.h"
+#include "scene/Component.h"
+
+namespace nebula::scene {
+
+    class World;
+
+    //  Records structural changes to apply them later on owning thread, not thread safe so jobs use one buffer per thread.
+    //  Component values are constructed in recording and relocated into World by playback.
+    class NEBULA_API EntityCommandBuffer
+    {
+    public:
+        EntityCommandBuffer() = default;
+        ~EntityCommandBuffer();
+
+        EntityCommandBuffer(const EntityCommandBuffer&) = delete;
+        EntityCommandBuffer& operator = (const EntityCommandBuffer&) = delete;
+        EntityCommandBuffer(EntityCommandBuffer&&) noexcept = default;
+        EntityCommandBuffer& operator = (EntityCommandBuffer&&) noexcept = default;
+
+        //  Entity handle is only known after playback
+        template <typename... Components>
+        requires (ComponentType<std::remove_cvref_t<Components>> && ...)
+        void createEntity(Components&&... components)
+        {
+            const auto first_component = static_cast<uint32_t>(m_components.size());
+            (recordComponent<std::remove_cvref_t<Components>>(std::forward<Components>(components)), ...);
+
+            m_commands.push_back({CommandType::cCreateEntity, cNullEntity, first_component, sizeof...(Components)});
+        }
+
+        void destroyEntity(Entity entity);
+
+        template <typename T, typename... Args>
+        void addComponent(const Entity entity, Args&&... args)
+        {
+            const auto first_component = static_cast<uint32_t>(m_components.size());
+            recordComponent<T>(std::forward<Args>(args)...);
+
+            m_commands.push_back({CommandType::cAddComponent, entity, first_component, 1});
+        }
+
+        template <typename T>
+        void removeComponent(const Entity entity) { removeComponent(entity, ComponentRegistry::getID<T>()); }
+        void removeComponent(Entity entity, ComponentID component);
+
+        //  Applies commands in recording order and clears buffer, commands on destroyed entities are dropped
+        void playback(World& world);
+        void clear();
+
+        [[nodiscard]] bool empty() const { return m_commands.empty(); }
+
+    private:
+        enum class CommandType : uint8_t
+        {
+            cCreateEntity,
+            cDestroyEntity,
+            cAddComponent,
+            cRemoveComponent
+        };
+
+        struct Command
+        {
+            CommandType type;
+            Entity entity;
+            uint32_t first_component;   //  Removed component ID for cRemoveComponent
+            uint32_t component_count;
+        };
+
+        //  Recorded values are never moved, so payload lives in stable blocks instead of growing vector
+        struct Block
+        {
+            Scope<std::byte[]> memory;
+            std::size_t size;
+            std::size_t offset;
+        };
+
+        std::vector<Command> m_commands{};
+        std::vector<ComponentData> m_components{};
+
+        std::vector<Block> m_blocks{};
+        std::size_t m_current_block = 0;
+
+        template <typename T, typename... Args>
+        void recordComponent(Args&&... args)
+        {
+            void* data = allocatePayload(sizeof(T), alignof(T));
+            new (data) T(std::forward<Args>(args)...);
+
+            m_components.push_back({ComponentRegistry::getID<T>(), data});
+        }
+
+        void* allocatePayload(std::size_t size, std::size_t alignment);
+        void destroyComponents(uint32_t first_component, uint32_t component_count);
+    };
+
+    //  One EntityCommandBuffer per JobSystem thread, indexed with thread index passed to parallel query jobs
+    class NEBULA_API ThreadCommandBuffers
+    {
+    public:
+        ThreadCommandBuffers();
+
+        [[nodiscard]] EntityCommandBuffer& get(const uint32_t thread_index) { return m_buffers[thread_index]; }
+
+        //  Plays buffers back in thread index order
+        void playback(World& world);
+
+    private:
+        std::vector<EntityCommandBuffer> m_buffers{};
+    };
+
+}
+
+#endif //ENTITYCOMMANDBUFFER_H
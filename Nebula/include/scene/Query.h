@@ -0,0 +1,159 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef QUERY_H
+#define QUERY_H
+
+#include <span>
+#include <tuple>
+#include <vector>
+#include <type_traits>
+
+#include "scene/World.h"
+#include "threads/JobSystem.h"
+
+namespace nebula::scene {
+
+    //  Columns of single chunk matched by query, const components are read only
+    template <typename... Components>
+    struct QueryChunk
+    {
+        const Entity* entities = nullptr;
+        std::tuple<Components*...> columns{};
+        uint32_t count = 0;
+
+        template <typename T>
+        [[nodiscard]] std::span<T> get() const { return {std::get<T*>(columns), count}; }
+        [[nodiscard]] std::span<const Entity> getEntities() const { return {entities, count}; }
+    };
+
+    //  Iterates every entity having at least given components.
+    //  Matching archetypes are cached and only archetypes created since last iteration are tested,
+    //  so query should be kept alive between frames.
+    template <typename... Components>
+    class Query
+    {
+        static_assert(sizeof...(Components) > 0, "Query requires at least one component!");
+
+    public:
+        using Chunk = QueryChunk<Components...>;
+
+        explicit Query(World& world) : m_world(world), m_mask(ComponentRegistry::getMask<std::remove_const_t<Components>...>()) {}
+
+        //  function(Entity, Components&...)
+        template <typename Function>
+        void forEach(Function&& function)
+        {
+            forEachChunk([&function](const Chunk& chunk)
+            {
+                std::apply([&function, &chunk](auto*... columns)
+                {
+                    for (uint32_t row = 0; row < chunk.count; ++row)
+                        function(chunk.entities[row], columns[row]...);
+                }, chunk.columns);
+            });
+        }
+
+        //  function(const Chunk&)
+        template <typename Function>
+        void forEachChunk(Function&& function)
+        {
+            collectChunks();
+
+            m_world.lock();
+            for (const auto& chunk : m_chunks)
+                function(chunk);
+            m_world.unlock();
+        }
+
+        //  function(Entity, Components&...), runs concurrently for different chunks
+        template <typename Function>
+        void parallelForEach(Function&& function)
+        {
+            parallelForEachChunk([&function](const Chunk& chunk, uint32_t)
+            {
+                std::apply([&function, &chunk](auto*... columns)
+                {
+                    for (uint32_t row = 0; row < chunk.count; ++row)
+                        function(chunk.entities[row], columns[row]...);
+                }, chunk.columns);
+            });
+        }
+
+        //  function(const Chunk&, uint32_t thread_index), one job per chunk on JobSystem.
+        //  Thread index is below getThreadCount(), structural changes go to per thread command buffers.
+        template <typename Function>
+        void parallelForEachChunk(Function&& function)
+        {
+            collectChunks();
+
+            m_world.lock();
+            if (threads::JobSystem::checkEnabled() && m_chunks.size() > 1)
+            {
+                threads::JobSystem::get().parallelFor(static_cast<uint32_t>(m_chunks.size()), [this, &function](const uint32_t job_index, const uint32_t thread_index)
+                {
+                    function(m_chunks[job_index], thread_index);
+                });
+            }
+            else
+            {
+                const uint32_t thread_index = getThreadCount() - 1;
+                for (const auto& chunk : m_chunks)
+                    function(chunk, thread_index);
+            }
+            m_world.unlock();
+        }
+
+        [[nodiscard]] uint32_t getEntityCount()
+        {
+            updateArchetypes();
+
+            uint32_t count = 0;
+            for (const Archetype* archetype : m_archetypes)
+                count += archetype->getEntityCount();
+
+            return count;
+        }
+
+        //  Calling thread always uses last index
+        [[nodiscard]] static uint32_t getThreadCount() { return threads::JobSystem::checkEnabled() ? threads::JobSystem::get().getThreadCount() : 1; }
+
+    private:
+        World& m_world;
+        ComponentMask m_mask;
+
+        std::vector<Archetype*> m_archetypes{};
+        std::size_t m_checked_archetypes = 0;
+        std::vector<Chunk> m_chunks{};     //  Rebuilt before every iteration, chunks move with structural changes
+
+        void updateArchetypes()
+        {
+            const auto& archetypes = m_world.getArchetypes();
+            for (; m_checked_archetypes < archetypes.size(); ++m_checked_archetypes)
+            {
+                Archetype* archetype = archetypes[m_checked_archetypes].get();
+                if ((archetype->getMask() & m_mask) == m_mask)
+                    m_archetypes.push_back(archetype);
+            }
+        }
+
+        void collectChunks()
+        {
+            updateArchetypes();
+
+            m_chunks.clear();
+            for (const Archetype* archetype : m_archetypes)
+                for (const auto& chunk : archetype->getChunks())
+                    m_chunks.push_back({
+                        archetype->getEntities(chunk),
+                        {archetype->template getColumn<std::remove_const_t<Components>>(chunk)...},
+                        chunk.count
+                    });
+        }
+    };
+
+}
+
+#endif //QUERY_H
@@ -0,0 +1,111 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef TRANSFORMHIERARCHY_H
+#define TRANSFORMHIERARCHY_H
+
+#include <span>
+#include <limits>
+#include <vector>
+#include <cstdint>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include "core/Core.h"
+
+namespace nebula::scene {
+
+    struct TransformHandle
+    {
+        static constexpr uint32_t cInvalidIndex = std::numeric_limits<uint32_t>::max();
+
+        uint32_t index = cInvalidIndex;
+        uint32_t generation = 0;
+
+        [[nodiscard]] bool valid() const { return index != cInvalidIndex; }
+
+        friend bool operator == (const TransformHandle&, const TransformHandle&) = default;
+    };
+
+    static constexpr TransformHandle cNullTransform{};
+
+    //  Local TRS and world matrices of transform nodes in SoA arrays sorted by hierarchy depth, parents always precede children.
+    //  update() recomputes world matrices of dirty subtrees one depth level at a time, each level in parallel on JobSystem.
+    //  Structural changes (create, destroy, reparent) reorder slots lazily on next update().
+    class NEBULA_API TransformHierarchy
+    {
+    public:
+        TransformHandle createTransform(
+            TransformHandle parent = cNullTransform,
+            const glm::vec3& translation = glm::vec3{0.0f},
+            const glm::quat& rotation = glm::quat{1.0f, 0.0f, 0.0f, 0.0f},
+            const glm::vec3& scale = glm::vec3{1.0f}
+        );
+
+        //  Descendants are destroyed on next update(), their handles stay valid until then
+        void destroyTransform(TransformHandle transform);
+        void setParent(TransformHandle transform, TransformHandle parent);
+
+        void setTranslation(TransformHandle transform, const glm::vec3& translation);
+        void setRotation(TransformHandle transform, const glm::quat& rotation);
+        void setScale(TransformHandle transform, const glm::vec3& scale);
+        void setLocalTransform(TransformHandle transform, const glm::vec3& translation, const glm::quat& rotation, const glm::vec3& scale);
+
+        [[nodiscard]] const glm::vec3& getTranslation(TransformHandle transform) const { return m_translations[getSlot(transform)]; }
+        [[nodiscard]] const glm::quat& getRotation(TransformHandle transform) const { return m_rotations[getSlot(transform)]; }
+        [[nodiscard]] const glm::vec3& getScale(TransformHandle transform) const { return m_scales[getSlot(transform)]; }
+        [[nodiscard]] TransformHandle getParent(TransformHandle transform) const;
+
+        //  Result of last update()
+        [[nodiscard]] const glm::mat4& getWorldMatrix(TransformHandle transform) const { return m_world_matrices[getSlot(transform)]; }
+
+        void update();
+
+        //  Slot of transform in per slot arrays, changes only when update() reorders hierarchy
+        [[nodiscard]] uint32_t getSlot(TransformHandle transform) const;
+        [[nodiscard]] bool isValid(TransformHandle transform) const;
+
+        //  Contiguous world matrices in slot order, ready to be uploaded as instance data
+        [[nodiscard]] std::span<const glm::mat4> getWorldMatrices() const { return m_world_matrices; }
+        //  Non zero for slots recomputed by last update(), lets renderer upload changed ranges only
+        [[nodiscard]] std::span<const uint8_t> getUpdatedSlots() const { return m_updated; }
+
+        [[nodiscard]] uint32_t getTransformCount() const { return static_cast<uint32_t>(m_parents.size()); }
+        [[nodiscard]] uint32_t getLevelCount() const { return m_level_offsets.empty() ? 0 : static_cast<uint32_t>(m_level_offsets.size() - 1); }
+
+    private:
+        static constexpr uint32_t cNoParent = std::numeric_limits<uint32_t>::max();
+
+        //  SoA per slot
+        std::vector<glm::vec3> m_translations{};
+        std::vector<glm::quat> m_rotations{};
+        std::vector<glm::vec3> m_scales{};
+        std::vector<uint32_t> m_parents{};          //  Parent slot or cNoParent
+        std::vector<uint32_t> m_slot_handles{};     //  Handle index, invalid for destroyed slots
+        std::vector<uint8_t> m_local_dirty{};
+        std::vector<uint8_t> m_updated{};
+        std::vector<glm::mat4> m_world_matrices{};
+
+        std::vector<uint32_t> m_level_offsets{};    //  First slot of every depth level followed by slot count
+
+        std::vector<uint32_t> m_handle_slots{};
+        std::vector<uint32_t> m_handle_generations{};
+        std::vector<uint32_t> m_free_handles{};
+
+        uint32_t m_dirty_count = 0;
+        bool m_structure_changed = false;
+        bool m_has_updates = false;
+
+        void markDirty(uint32_t slot);
+        void releaseHandle(uint32_t slot);
+
+        void rebuildOrder();
+        void updateSlots(uint32_t begin, uint32_t end);
+    };
+
+}
+
+#endif //TRANSFORMHIERARCHY_H
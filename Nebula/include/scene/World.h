@@ -0,0 +1,124 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef WORLD_H
+#define WORLD_H
+
+#include <span>
+#include <vector>
+#include <unordered_map>
+
+#include "core/Core.h"
+#include "core/Assert.h"
+#include "memory/Types.h"
+#include "scene/Entity.h"
+#include "scene/Archetype.h"
+#include "scene/Component.h"
+#include "scene/ChunkAllocator.h"
+
+namespace nebula::scene {
+
+    template <typename... Components>
+    class Query;
+
+    //  Entities with components stored in archetype chunks.
+    //  Structural changes (create, destroy, add, remove) are only allowed on owning thread outside of query iteration,
+    //  jobs record them in EntityCommandBuffer instead.
+    class NEBULA_API World
+    {
+    public:
+        World();
+        ~World();
+
+        World(const World&) = delete;
+        World& operator = (const World&) = delete;
+
+        template <typename... Components>
+        requires (ComponentType<std::remove_cvref_t<Components>> && ...)
+        Entity createEntity(Components&&... components)
+        {
+            const auto& mask = ComponentRegistry::getMask<std::remove_cvref_t<Components>...>();
+            NB_CORE_ASSERT(mask.count() == sizeof...(Components), "Entity can't have duplicated components!");
+
+            EntityLocation location;
+            const Entity entity = spawnEntity(getArchetype(mask), location);
+            (new (location.archetype->getComponent(location, ComponentRegistry::getID<std::remove_cvref_t<Components>>()))
+                std::remove_cvref_t<Components>(std::forward<Components>(components)), ...);
+
+            return entity;
+        }
+
+        //  Replaces component value if entity already has it
+        template <typename T, typename... Args>
+        T& addComponent(const Entity entity, Args&&... args)
+        {
+            const ComponentID component = ComponentRegistry::getID<T>();
+            if (void* address = getComponent(entity, component))
+                return *static_cast<T*>(address) = T(std::forward<Args>(args)...);
+
+            return *new (insertComponent(entity, component)) T(std::forward<Args>(args)...);
+        }
+
+        template <typename T>
+        void removeComponent(const Entity entity) { removeComponent(entity, ComponentRegistry::getID<T>()); }
+
+        template <typename T>
+        [[nodiscard]] bool hasComponent(const Entity entity) const { return getComponent(entity, ComponentRegistry::getID<T>()) != nullptr; }
+
+        //  Returns nullptr if entity doesn't have component, pointer is invalidated by structural changes
+        template <typename T>
+        [[nodiscard]] T* getComponent(const Entity entity) const { return static_cast<T*>(getComponent(entity, ComponentRegistry::getID<T>())); }
+
+        //  Type erased variants, component values are relocated from data
+        Entity createEntity(std::span<const ComponentData> components);
+        void addComponent(Entity entity, const ComponentData& component);
+        void removeComponent(Entity entity, ComponentID component);
+        [[nodiscard]] void* getComponent(Entity entity, ComponentID component) const;
+
+        void destroyEntity(Entity entity);
+        [[nodiscard]] bool isAlive(Entity entity) const;
+
+        [[nodiscard]] uint32_t getEntityCount() const { return m_entity_count; }
+        [[nodiscard]] const std::vector<Scope<Archetype>>& getArchetypes() const { return m_archetypes; }
+
+    private:
+        struct EntityRecord
+        {
+            EntityLocation location{};
+            uint32_t generation = 0;
+        };
+
+        ChunkAllocator m_chunk_allocator{};
+
+        //  Archetypes are never removed, queries track them by index
+        std::vector<Scope<Archetype>> m_archetypes{};
+        std::unordered_map<ComponentMask, Archetype*> m_archetype_map{};
+
+        std::vector<EntityRecord> m_entities{};
+        std::vector<uint32_t> m_free_entities{};
+        uint32_t m_entity_count = 0;
+
+        uint32_t m_lock_count = 0;      //  Iterating queries
+
+        Archetype& getArchetype(const ComponentMask& mask);
+        Archetype& getNeighbour(Archetype& archetype, ComponentID component, bool add);
+
+        Entity spawnEntity(Archetype& archetype, EntityLocation& location);
+        void moveEntity(Entity entity, Archetype& target);
+        void removeRow(const EntityLocation& location);
+
+        //  Moves entity to archetype with component and returns its uninitialized storage
+        void* insertComponent(Entity entity, ComponentID component);
+
+        void lock() { ++m_lock_count; }
+        void unlock() { --m_lock_count; }
+
+        template <typename... Components>
+        friend class Query;
+    };
+
+}
+
+#endif //WORLD_H
@@ -0,0 +1,71 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <condition_variable>
+
+#include "core/Core.h"
+
+namespace nebula::threads {
+
+    class NEBULA_API JobSystem
+    {
+    public:
+        using Job = std::function<void(uint32_t job_index, uint32_t thread_index)>;
+
+        explicit JobSystem(uint32_t worker_count);
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator = (const JobSystem&) = delete;
+
+        //  Runs jobs on workers and calling thread, blocks until all of them finished
+        //  Batches from different threads are serialized, jobs can't dispatch nested batches
+        void parallelFor(uint32_t job_count, const Job& job);
+
+        //  Worker threads plus calling thread, which always runs with last thread index
+        [[nodiscard]] uint32_t getThreadCount() const { return static_cast<uint32_t>(m_workers.size()) + 1; }
+
+        static bool checkEnabled() { return s_instance != nullptr; }
+        static JobSystem& get() { return *s_instance; }
+
+    private:
+        struct Batch
+        {
+            const Job* job = nullptr;
+            uint32_t job_count = 0;
+            uint32_t active_workers = 0;    //  Guarded by m_mutex
+
+            std::atomic_uint32_t next_job = 0;
+            std::atomic_uint32_t finished_jobs = 0;
+        };
+
+        std::vector<std::thread> m_workers;
+
+        std::mutex m_dispatch_mutex;
+        std::mutex m_mutex;
+        std::condition_variable m_batch_ready;
+        std::condition_variable m_batch_finished;
+
+        Batch* m_batch = nullptr;
+        uint64_t m_batch_generation = 0;
+        bool m_running = true;
+
+        void workerLoop(uint32_t thread_index);
+        static void runJobs(Batch& batch, uint32_t thread_index);
+
+        static JobSystem* s_instance;
+    };
+
+}
+
+#endif //JOBSYSTEM_H
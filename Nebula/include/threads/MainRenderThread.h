@@ -30,6 +30,7 @@ namespace nebula::threads {
         Scope<rendering::RenderContext> m_render_context;
 
         bool m_vsync = true;
+        Timer m_frame_timer;
         ImGuiLayer* m_im_gui_layer = nullptr;
 
         Scope<rendering::RenderPassExecutor> m_renderpass_executor;
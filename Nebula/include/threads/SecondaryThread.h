@@ -32,6 +32,9 @@ namespace nebula::threads {
 
         [[nodiscard]] const std::string& getName() const;
 
+        //  Blocks while application is minimized, returns true if thread was idle
+        bool waitWhileMinimized() const;
+
     private:
         std::string m_name;
         std::thread m_thread;
@@ -43,6 +46,7 @@ namespace nebula::threads {
         std::atomic_flag m_shutdown_ready = ATOMIC_FLAG_INIT;
 
         void mainLoop();
+        void logSleepStats() const;
     };
 
 }
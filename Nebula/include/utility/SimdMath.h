@@ -0,0 +1,104 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#ifndef SIMDMATH_H
+#define SIMDMATH_H
+
+#include <glm/glm.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define NB_SIMD_SSE
+    #include <immintrin.h>
+
+    //  AVX2 kernels are compiled per function and only called after supportsAvx2() check
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define NB_TARGET_AVX2
+    #else
+        #define NB_TARGET_AVX2 __attribute__((target("avx2,fma")))
+    #endif
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+    #define NB_SIMD_NEON
+    #include <arm_neon.h>
+#endif
+
+namespace nebula::simd {
+
+    inline bool supportsAvx2()
+    {
+        #if defined(NB_SIMD_SSE) && defined(_MSC_VER) && !defined(__clang__)
+        static const bool s_supported = []
+        {
+            int info[4];
+            __cpuid(info, 1);
+
+            //  OS has to save YMM registers on context switch
+            const bool avx = (info[2] & 1 << 27) && (info[2] & 1 << 28) && (_xgetbv(0) & 6) == 6;
+            if (!avx)
+                return false;
+
+            __cpuidex(info, 7, 0);
+            return (info[1] & 1 << 5) != 0;
+        }();
+
+        return s_supported;
+        #elif defined(NB_SIMD_SSE)
+        static const bool s_supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+        return s_supported;
+        #else
+        return false;
+        #endif
+    }
+
+    //  result = lhs * rhs for column major matrices, result may alias either operand.
+    //  Every result column is a linear combination of lhs columns, so it maps to 4 broadcast multiply-adds.
+    inline void multiplyMatrices(const glm::mat4& lhs, const glm::mat4& rhs, glm::mat4& result)
+    {
+        const float* a = &lhs[0][0];
+        const float* b = &rhs[0][0];
+        float* r = &result[0][0];
+
+        #if defined(NB_SIMD_SSE)
+        const __m128 a0 = _mm_loadu_ps(a);
+        const __m128 a1 = _mm_loadu_ps(a + 4);
+        const __m128 a2 = _mm_loadu_ps(a + 8);
+        const __m128 a3 = _mm_loadu_ps(a + 12);
+
+        for (int column = 0; column < 4; ++column)
+        {
+            const float* b_column = b + column * 4;
+
+            __m128 value = _mm_mul_ps(a0, _mm_set1_ps(b_column[0]));
+            value = _mm_add_ps(value, _mm_mul_ps(a1, _mm_set1_ps(b_column[1])));
+            value = _mm_add_ps(value, _mm_mul_ps(a2, _mm_set1_ps(b_column[2])));
+            value = _mm_add_ps(value, _mm_mul_ps(a3, _mm_set1_ps(b_column[3])));
+
+            _mm_storeu_ps(r + column * 4, value);
+        }
+        #elif defined(NB_SIMD_NEON)
+        const float32x4_t a0 = vld1q_f32(a);
+        const float32x4_t a1 = vld1q_f32(a + 4);
+        const float32x4_t a2 = vld1q_f32(a + 8);
+        const float32x4_t a3 = vld1q_f32(a + 12);
+
+        for (int column = 0; column < 4; ++column)
+        {
+            const float32x4_t b_column = vld1q_f32(b + column * 4);
+
+            float32x4_t value = vmulq_laneq_f32(a0, b_column, 0);
+            value = vfmaq_laneq_f32(value, a1, b_column, 1);
+            value = vfmaq_laneq_f32(value, a2, b_column, 2);
+            value = vfmaq_laneq_f32(value, a3, b_column, 3);
+
+            vst1q_f32(r + column * 4, value);
+        }
+        #else
+        result = lhs * rhs;
+        #endif
+    }
+
+}
+
+#endif //SIMDMATH_H
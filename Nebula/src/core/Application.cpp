@@ -5,12 +5,18 @@
 
 #include "core/Config.h"
 #include "core/Logging.h"
+#include "debug/Profiler.h"
 
 #include "threads/MainUpdateThread.h"
 #include "threads/MainRenderThread.h"
 
 namespace nebula {
 
+    static int64_t getSteadyTime()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
     Application* Application::s_instance = nullptr;
 
     Application::Application(
@@ -21,7 +27,7 @@ namespace nebula {
             m_event_manager(
               m_layer_stack,
               [this](Event& event) { onEvent(event); },
-              Config::getEngineConfig()["memory"]["event_queue_size"].as<int>()
+              Config::getEngineSettings().memory.event_queue_size
             )
     {
         NB_CORE_ASSERT(!s_instance, "Can't create another instance of Application!");
@@ -38,27 +44,95 @@ namespace nebula {
         m_window->setEventManager(m_event_manager);
         m_input = Input::create(m_window.get());
 
+        m_settings_subscription = Config::subscribe([this](const EngineSettings& settings) { onSettingsReloaded(settings); });
+
         createThreads();
     }
 
     Application::~Application()
     {
+        Config::unsubscribe(m_settings_subscription);
         cleanupThreads();
     }
 
-    void Application::run() const
+    void Application::run()
     {
         for (const auto& thread : m_threads)
             thread->run();
 
+        NB_PROFILE_THREAD("MainThread");
         while (m_running)
         {
+            NB_PROFILE_SCOPE("Application::run");
+
             m_window->onUpdate();
+            updateWindowState();
         }
     }
 
+    double Application::waitWhileMinimized() const
+    {
+        if (!m_minimized.load())
+            return 0.0;
+
+        uint32_t generation = m_window_state_generation.load();
+        while (m_minimized.load() && m_running.load() && !m_close_requested.load())
+        {
+            m_window_state_generation.wait(generation);
+            generation = m_window_state_generation.load();
+        }
+
+        return static_cast<double>(getSteadyTime() - m_window_state_change_time.load()) * 0.000'000'001;
+    }
+
+    uint32_t Application::getFpsLimit(const uint32_t render_fps) const
+    {
+        const uint32_t background_fps = Config::getEngineSettings().threads.background_fps;
+        if (background_fps == 0 || m_focused.load())
+            return render_fps;
+
+        return render_fps > 0 ? std::min(render_fps, background_fps) : background_fps;
+    }
+
+    void Application::updateWindowState()
+    {
+        //  Main thread is the only writer, events are dispatched by update thread which may be blocked
+        const bool minimized = m_window->checkMinimized();
+        const bool focused = m_window->checkFocused();
+
+        const bool minimized_changed = m_minimized.exchange(minimized) != minimized;
+        const bool focused_changed = m_focused.exchange(focused) != focused;
+
+        //  WindowCloseEvent is dispatched by update thread, so it has to be woken up if it's waiting while minimized
+        const bool close_requested = m_window->checkCloseRequested() && !m_close_requested.exchange(true);
+
+        if (minimized_changed || focused_changed || close_requested)
+            notifyWindowStateChanged();
+    }
+
+    void Application::notifyWindowStateChanged()
+    {
+        m_window_state_change_time.store(getSteadyTime());
+        m_window_state_generation.fetch_add(1);
+        m_window_state_generation.notify_all();
+    }
+
     void Application::createThreads()
     {
+        m_frame_stats = createScope<FrameStats>();
+
+        //  Headless frame timing capture
+        m_frame_stats_csv = Config::getEngineSettings().debug.frame_stats_csv;
+        if (!m_frame_stats_csv.empty())
+            m_frame_stats->startCsvRecording(m_frame_stats_csv);
+
+        //  Main, update and render threads are already busy
+        uint32_t job_workers = Config::getEngineSettings().threads.job_workers;
+        if (job_workers == 0)
+            job_workers = std::max(std::thread::hardware_concurrency(), 4u) - 3;
+
+        m_job_system = createScope<threads::JobSystem>(job_workers);
+
         m_threads.emplace_back(createScope<threads::MainRenderThread>());
         m_threads.emplace_back(createScope<threads::MainUpdateThread>());
 
@@ -78,6 +152,8 @@ namespace nebula {
             thread->waitShutdownReady();
 
         m_threads.clear();
+        m_job_system.reset();
+        m_frame_stats.reset();
     }
 
     void Application::closeThreads() const
@@ -91,6 +167,7 @@ namespace nebula {
         std::lock_guard lock{m_mutex};
         m_running = false;
         closeThreads();
+        notifyWindowStateChanged();
     }
 
     void Application::onEvent(Event& event)
@@ -108,14 +185,7 @@ namespace nebula {
 
     bool Application::onWindowResize(WindowResizeEvent& event)
     {
-        if (event.getWidth() == 0 || event.getHeight() == 0)
-        {
-            minimize(true);
-            return false;
-        }
-
-        minimize(false);
-
+        //  Minimized state is tracked by main thread, see updateWindowState
         return false;
     }
 
@@ -125,9 +195,24 @@ namespace nebula {
         NB_CORE_INFO("Reloaded engine config.");
     }
 
+    void Application::onSettingsReloaded(const EngineSettings& settings)
+    {
+        //  Only reacts to changed path, so recording started from ImGui survives unrelated reloads
+        const auto& frame_stats_csv = settings.debug.frame_stats_csv;
+        if (!m_frame_stats || frame_stats_csv == m_frame_stats_csv)
+            return;
+
+        if (frame_stats_csv.empty())
+            m_frame_stats->stopCsvRecording();
+        else
+            m_frame_stats->startCsvRecording(frame_stats_csv);
+
+        m_frame_stats_csv = frame_stats_csv;
+    }
+
     filesystem::Path Application::getResourcesPath(const bool absolute)
     {
-        auto resources_dir = Config::getEngineConfig()["resources"]["resources_directory"].as<std::string>();
+        const auto& resources_dir = Config::getEngineSettings().resources.resources_directory;
         if (absolute)
             return filesystem::getCurrentWorkingDirectory() / resources_dir;
         return resources_dir;
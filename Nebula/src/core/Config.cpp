@@ -5,25 +5,31 @@
 
 #include "core/Config.h"
 
+#include <ranges>
 #include <sstream>
 #include <fstream>
 
-#include "memory/Types.h"
 #include "core/Assert.h"
-#include "platform/EngineConfiguration.h"
-
-using namespace nebula::literals;
 
 namespace nebula {
 
     Config* Config::s_instance = nullptr;
 
+    std::atomic<const EngineSettings*> Config::s_engine_settings = nullptr;
+    std::vector<Scope<const EngineSettings>> Config::s_settings_snapshots{};
+
+    std::mutex Config::s_settings_mutex;
+    std::map<Config::SubscriptionID, Config::SettingsCallback> Config::s_subscribers{};
+    Config::SubscriptionID Config::s_next_subscription = 0;
+
     void Config::setEngineConfig(Config& config)
     {
         NB_CORE_ASSERT(!s_instance, "Can't create two instances of engine config!");
         if (config.isEmpty())
             config.getConfig() = defaultEngineConfig();
         s_instance = &config;
+
+        publishEngineSettings();
     }
 
     void Config::reloadEngineConfig(const std::string& path)
@@ -33,6 +39,44 @@ namespace nebula {
             s_instance->getConfig() = defaultEngineConfig();
         else
             s_instance->reload(path);
+
+        publishEngineSettings();
+    }
+
+    void Config::publishEngineSettings()
+    {
+        std::vector<SettingsCallback> subscribers;
+        const EngineSettings* settings = nullptr;
+        {
+            std::lock_guard lock{s_settings_mutex};
+
+            auto snapshot = EngineSettings::fromYaml(s_instance->getConfig());
+            snapshot.version = s_settings_snapshots.size() + 1;
+
+            s_settings_snapshots.push_back(createScope<const EngineSettings>(std::move(snapshot)));
+            settings = s_settings_snapshots.back().get();
+            s_engine_settings.store(settings, std::memory_order_release);
+
+            for (const auto& callback : s_subscribers | std::views::values)
+                subscribers.push_back(callback);
+        }
+
+        //  Outside of lock, so callbacks can subscribe and unsubscribe
+        for (const auto& callback : subscribers)
+            callback(*settings);
+    }
+
+    Config::SubscriptionID Config::subscribe(SettingsCallback callback)
+    {
+        std::lock_guard lock{s_settings_mutex};
+        s_subscribers.emplace(++s_next_subscription, std::move(callback));
+        return s_next_subscription;
+    }
+
+    void Config::unsubscribe(const SubscriptionID subscription)
+    {
+        std::lock_guard lock{s_settings_mutex};
+        s_subscribers.erase(subscription);
     }
 
     Config::Config(const std::string& path)
@@ -61,24 +105,8 @@ namespace nebula {
 
     YAML::Node Config::defaultEngineConfig()
     {
-        YAML::Node node;
-
-        auto memory_section = YAML::Node();
-        memory_section["event_queue_size"] = 1_Mb;
-        memory_section["render_command_buffer_size"] = 100_Kb;
-
-        auto rendering_section = YAML::Node();
-        rendering_section["cache_path"] = "cache/rendering";
-        rendering_section["frames_in_flight"] = 2;
-
-        auto resources_section = YAML::Node();
-        resources_section["resources_directory"] = NEBULA_RESOURCES_DIRECTORY;
-
-        node["memory"] = memory_section;
-        node["rendering"] = rendering_section;
-        node["resources"] = resources_section;
-
-        return node;
+        //  Default values live in EngineSettings, so typed and YAML config can't diverge
+        return EngineSettings::fromYaml(YAML::Node()).toYaml();
     }
 
 }
@@ -0,0 +1,95 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "core/EngineSettings.h"
+
+#include "platform/EngineConfiguration.h"
+
+namespace nebula {
+
+    template <typename T>
+    static void readValue(const YAML::Node& section, const char* key, T& value)
+    {
+        if (section && section[key])
+            value = section[key].as<T>();
+    }
+
+    EngineSettings EngineSettings::fromYaml(const YAML::Node& config)
+    {
+        EngineSettings settings;
+
+        const YAML::Node memory = config["memory"];
+        readValue(memory, "event_queue_size", settings.memory.event_queue_size);
+        readValue(memory, "render_command_buffer_size", settings.memory.render_command_buffer_size);
+        readValue(memory, "staging_buffer_size", settings.memory.staging_buffer_size);
+        readValue(memory, "stream_buffer_size", settings.memory.stream_buffer_size);
+
+        const YAML::Node rendering = config["rendering"];
+        readValue(rendering, "cache_path", settings.rendering.cache_path);
+        readValue(rendering, "frames_in_flight", settings.rendering.frames_in_flight);
+        readValue(rendering, "gpu_profiler", settings.rendering.gpu_profiler);
+        readValue(rendering, "vulkan_dynamic_rendering", settings.rendering.vulkan_dynamic_rendering);
+        readValue(rendering, "parallel_recording", settings.rendering.parallel_recording);
+        readValue(rendering, "recording_chunk_size", settings.rendering.recording_chunk_size);
+
+        const YAML::Node threads = config["threads"];
+        readValue(threads, "adaptive_sleep", settings.threads.adaptive_sleep);
+        readValue(threads, "background_fps", settings.threads.background_fps);
+        readValue(threads, "max_fixed_updates", settings.threads.max_fixed_updates);
+        readValue(threads, "job_workers", settings.threads.job_workers);
+
+        const YAML::Node debug = config["debug"];
+        readValue(debug, "frame_stats_csv", settings.debug.frame_stats_csv);
+        readValue(debug, "allocation_guard_warmup_frames", settings.debug.allocation_guard_warmup_frames);
+
+        const YAML::Node resources = config["resources"];
+        readValue(resources, "resources_directory", settings.resources.resources_directory);
+        if (settings.resources.resources_directory.empty())
+            settings.resources.resources_directory = NEBULA_RESOURCES_DIRECTORY;
+
+        return settings;
+    }
+
+    YAML::Node EngineSettings::toYaml() const
+    {
+        YAML::Node node;
+
+        auto memory_section = YAML::Node();
+        memory_section["event_queue_size"] = memory.event_queue_size;
+        memory_section["render_command_buffer_size"] = memory.render_command_buffer_size;
+        memory_section["staging_buffer_size"] = memory.staging_buffer_size;
+        memory_section["stream_buffer_size"] = memory.stream_buffer_size;
+
+        auto rendering_section = YAML::Node();
+        rendering_section["cache_path"] = rendering.cache_path;
+        rendering_section["frames_in_flight"] = rendering.frames_in_flight;
+        rendering_section["gpu_profiler"] = rendering.gpu_profiler;
+        rendering_section["vulkan_dynamic_rendering"] = rendering.vulkan_dynamic_rendering;
+        rendering_section["parallel_recording"] = rendering.parallel_recording;
+        rendering_section["recording_chunk_size"] = rendering.recording_chunk_size;
+
+        auto threads_section = YAML::Node();
+        threads_section["adaptive_sleep"] = threads.adaptive_sleep;
+        threads_section["background_fps"] = threads.background_fps;
+        threads_section["max_fixed_updates"] = threads.max_fixed_updates;
+        threads_section["job_workers"] = threads.job_workers;
+
+        auto debug_section = YAML::Node();
+        debug_section["frame_stats_csv"] = debug.frame_stats_csv;
+        debug_section["allocation_guard_warmup_frames"] = debug.allocation_guard_warmup_frames;
+
+        auto resources_section = YAML::Node();
+        resources_section["resources_directory"] = resources.resources_directory;
+
+        node["memory"] = memory_section;
+        node["rendering"] = rendering_section;
+        node["threads"] = threads_section;
+        node["debug"] = debug_section;
+        node["resources"] = resources_section;
+
+        return node;
+    }
+
+}
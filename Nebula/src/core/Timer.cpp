@@ -10,6 +10,86 @@
 
 namespace nebula {
 
+    struct SleepState
+    {
+        bool adaptive = true;
+        double busy_offset = Timer::cDefaultBusyOffset;
+
+        //  Exponentially weighted estimate of system sleep wake-up latency
+        bool calibrated = false;
+        double jitter_mean = 0.0;
+        double jitter_deviation = 0.0;
+
+        SleepStats stats{};
+    };
+
+    static thread_local SleepState s_sleep_state;
+
+    static void updateBusyOffset(const double oversleep)
+    {
+        auto& state = s_sleep_state;
+        if (!state.adaptive)
+            return;
+
+        if (!state.calibrated)
+        {
+            state.jitter_mean = oversleep;
+            state.jitter_deviation = oversleep / 2.0;
+            state.calibrated = true;
+        }
+        else
+        {
+            const double error = oversleep - state.jitter_mean;
+            state.jitter_mean += error / 8.0;
+            state.jitter_deviation += (std::abs(error) - state.jitter_deviation) / 4.0;
+        }
+
+        //  Mean latency plus four deviations, spikes widen margin immediately and decay slowly
+        const double busy_offset = state.jitter_mean + 4.0 * state.jitter_deviation;
+        state.busy_offset = std::clamp(busy_offset, Timer::cMinBusyOffset, Timer::cMaxBusyOffset);
+    }
+
+    static void preciseWait(Timer& clock, const double deadline, const double busy_offset)
+    {
+        auto& stats = s_sleep_state.stats;
+        stats.busy_offset = busy_offset;
+
+        const double start_time = clock.elapsedSeconds();
+        if (deadline <= start_time)
+        {
+            ++stats.overruns;
+            return;
+        }
+
+        const double wake_time = deadline - busy_offset;
+        const bool sleeping = wake_time > start_time;
+
+        if (sleeping)
+            system_sleep(wake_time - start_time);   //  Thread sleeping
+
+        const double woke_time = clock.elapsedSeconds();
+        if (sleeping)
+            updateBusyOffset(woke_time - wake_time);
+
+        if (woke_time > deadline)
+        {
+            const double lateness = woke_time - deadline;
+            const auto bucket = std::ranges::lower_bound(SleepStats::cMissBucketBounds, lateness) - SleepStats::cMissBucketBounds.begin();
+
+            ++stats.deadline_misses;
+            ++stats.miss_histogram[bucket];
+        }
+
+        double current_time = woke_time;
+        while (current_time < deadline)             //  Spin-lock remaining duration
+            current_time = clock.elapsedSeconds();
+
+        ++stats.sleeps;
+        stats.slept_seconds += woke_time - start_time;
+        stats.spun_seconds += current_time - woke_time;
+        stats.overshoot_seconds += current_time - deadline;
+    }
+
     void Timer::sleep(double seconds)
     {
         system_sleep(seconds);
@@ -21,22 +101,43 @@ namespace nebula {
         system_sleep(sleep_time);
     }
 
-    void Timer::sleepPrecise(double seconds, double busy_offset)
+    void Timer::sleepPrecise(const double seconds)
     {
-        Timer busy_timer;
-        double sleep_time = std::max(seconds - busy_offset, 0.0);
+        sleepPrecise(seconds, s_sleep_state.busy_offset);
+    }
 
-        system_sleep(sleep_time);                       //  Thread sleeping
-        while (busy_timer.elapsedSeconds() < seconds);  //  Spin-lock remaining duration
+    void Timer::sleepUntilPrecise(const double application_time)
+    {
+        sleepUntilPrecise(application_time, s_sleep_state.busy_offset);
+    }
+
+    void Timer::sleepPrecise(const double seconds, const double busy_offset)
+    {
+        Timer busy_timer;
+        preciseWait(busy_timer, seconds, busy_offset);
     }
 
-    void Timer::sleepUntilPrecise(double application_time, double busy_offset)
+    void Timer::sleepUntilPrecise(const double application_time, const double busy_offset)
     {
-        static constexpr double epsilon = 0.0;
         Timer busy_timer(UpdateContext::get().getTime());
+        preciseWait(busy_timer, application_time, busy_offset);
+    }
+
+    void Timer::setAdaptiveBusyOffset(const bool adaptive)
+    {
+        s_sleep_state.adaptive = adaptive;
+        if (!adaptive)
+            s_sleep_state.busy_offset = cDefaultBusyOffset;
+    }
 
-        sleepUntil(application_time - busy_offset);                       //  Thread sleeping
-        while (application_time - busy_timer.elapsedSeconds() > epsilon); //  Spin-lock remaining duration
+    SleepStats Timer::getSleepStats()
+    {
+        return s_sleep_state.stats;
+    }
+
+    void Timer::resetSleepStats()
+    {
+        s_sleep_state.stats = SleepStats();
     }
 
 }
@@ -0,0 +1,215 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "debug/AllocationGuard.h"
+
+#include <new>
+#include <atomic>
+#include <cstdlib>
+
+#include "core/Logging.h"
+
+namespace nebula {
+
+    //  Trivial thread locals only, they are touched from inside operator new
+    static thread_local const char* s_guarded_thread = nullptr;
+    static thread_local uint32_t s_suppress_depth = 0;
+    static thread_local uint64_t s_thread_allocations = 0;
+
+    static std::atomic_uint64_t s_allocation_count = 0;
+
+    void AllocationGuard::guardThread(const char* thread_name)
+    {
+        #ifdef NB_ALLOCATION_GUARD
+        s_guarded_thread = thread_name;
+        s_thread_allocations = 0;
+        #endif
+    }
+
+    void AllocationGuard::releaseThread()
+    {
+        if (!s_guarded_thread)
+            return;
+
+        const char* thread_name = s_guarded_thread;
+        s_guarded_thread = nullptr;
+
+        if (s_thread_allocations > 0)
+            NB_CORE_WARN("{} made {} heap allocations after warm-up", thread_name, s_thread_allocations);
+    }
+
+    void AllocationGuard::onAllocation(const std::size_t size, const char* source)
+    {
+        if (!s_guarded_thread || s_suppress_depth > 0)
+            return;
+
+        ++s_thread_allocations;
+        if (s_allocation_count.fetch_add(1, std::memory_order_relaxed) >= cMaxReports)
+            return;
+
+        //  Logging allocates on its own
+        Suppress suppress;
+        NB_CORE_WARN("{} allocated {} bytes through {} after warm-up", s_guarded_thread, size, source);
+    }
+
+    uint64_t AllocationGuard::getAllocationCount()
+    {
+        return s_allocation_count.load(std::memory_order_relaxed);
+    }
+
+    AllocationGuard::Suppress::Suppress()
+    {
+        ++s_suppress_depth;
+    }
+
+    AllocationGuard::Suppress::~Suppress()
+    {
+        --s_suppress_depth;
+    }
+
+}
+
+#ifdef NB_ALLOCATION_GUARD
+
+#ifdef NB_PLATFORM_WINDOWS
+    #include <malloc.h>
+#endif
+
+static void* guardedAllocate(const std::size_t size, const char* source)
+{
+    nebula::AllocationGuard::onAllocation(size, source);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+static void* guardedAllocateAligned(std::size_t size, std::align_val_t alignment, const char* source)
+{
+    nebula::AllocationGuard::onAllocation(size, source);
+
+    const auto align = static_cast<std::size_t>(alignment);
+    #ifdef NB_PLATFORM_WINDOWS
+    return _aligned_malloc(size == 0 ? 1 : size, align);
+    #else
+    //  aligned_alloc requires size to be multiple of alignment
+    size = (size + align - 1) / align * align;
+    return std::aligned_alloc(align, size == 0 ? align : size);
+    #endif
+}
+
+static void guardedFreeAligned(void* address)
+{
+    #ifdef NB_PLATFORM_WINDOWS
+    _aligned_free(address);
+    #else
+    std::free(address);
+    #endif
+}
+
+void* operator new(const std::size_t size)
+{
+    if (void* address = guardedAllocate(size, "operator new"))
+        return address;
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](const std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(const std::size_t size, const std::nothrow_t&) noexcept
+{
+    return guardedAllocate(size, "operator new");
+}
+
+void* operator new[](const std::size_t size, const std::nothrow_t&) noexcept
+{
+    return guardedAllocate(size, "operator new");
+}
+
+void* operator new(const std::size_t size, const std::align_val_t alignment)
+{
+    if (void* address = guardedAllocateAligned(size, alignment, "aligned operator new"))
+        return address;
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](const std::size_t size, const std::align_val_t alignment)
+{
+    return operator new(size, alignment);
+}
+
+void* operator new(const std::size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return guardedAllocateAligned(size, alignment, "aligned operator new");
+}
+
+void* operator new[](const std::size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return guardedAllocateAligned(size, alignment, "aligned operator new");
+}
+
+void operator delete(void* address) noexcept
+{
+    std::free(address);
+}
+
+void operator delete[](void* address) noexcept
+{
+    std::free(address);
+}
+
+void operator delete(void* address, std::size_t) noexcept
+{
+    std::free(address);
+}
+
+void operator delete[](void* address, std::size_t) noexcept
+{
+    std::free(address);
+}
+
+void operator delete(void* address, const std::nothrow_t&) noexcept
+{
+    std::free(address);
+}
+
+void operator delete[](void* address, const std::nothrow_t&) noexcept
+{
+    std::free(address);
+}
+
+void operator delete(void* address, std::align_val_t) noexcept
+{
+    guardedFreeAligned(address);
+}
+
+void operator delete[](void* address, std::align_val_t) noexcept
+{
+    guardedFreeAligned(address);
+}
+
+void operator delete(void* address, std::size_t, std::align_val_t) noexcept
+{
+    guardedFreeAligned(address);
+}
+
+void operator delete[](void* address, std::size_t, std::align_val_t) noexcept
+{
+    guardedFreeAligned(address);
+}
+
+void operator delete(void* address, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    guardedFreeAligned(address);
+}
+
+void operator delete[](void* address, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    guardedFreeAligned(address);
+}
+
+#endif
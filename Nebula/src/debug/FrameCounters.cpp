@@ -0,0 +1,107 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "debug/FrameCounters.h"
+
+#include <mutex>
+#include <vector>
+#include <algorithm>
+
+namespace nebula {
+
+    struct FrameCountersRegistry
+    {
+        std::mutex mutex;
+        std::vector<FrameCounters::ThreadCounters*> threads{};
+
+        std::array<uint64_t, FrameCounters::cCounterCount> retired_totals{};   //  Threads that already exited
+        std::array<uint64_t, FrameCounters::cCounterCount> previous_totals{};
+        std::array<std::atomic_uint64_t, FrameCounters::cCounterCount> frame_values{};
+    };
+
+    static FrameCountersRegistry& getRegistry()
+    {
+        static FrameCountersRegistry registry;
+        return registry;
+    }
+
+    FrameCounters::ThreadCounters::ThreadCounters()
+    {
+        auto& registry = getRegistry();
+
+        std::lock_guard lock{registry.mutex};
+        registry.threads.push_back(this);
+    }
+
+    FrameCounters::ThreadCounters::~ThreadCounters()
+    {
+        auto& registry = getRegistry();
+
+        std::lock_guard lock{registry.mutex};
+        for (uint32_t counter = 0; counter < cCounterCount; ++counter)
+            registry.retired_totals[counter] += values[counter].load(std::memory_order_relaxed);
+
+        std::erase(registry.threads, this);
+    }
+
+    FrameCounters::ThreadCounters& FrameCounters::getThreadCounters()
+    {
+        static thread_local ThreadCounters thread_counters;
+        return thread_counters;
+    }
+
+    void FrameCounters::aggregateFrame()
+    {
+        auto& registry = getRegistry();
+
+        std::lock_guard lock{registry.mutex};
+
+        auto totals = registry.retired_totals;
+        for (const auto thread_counters : registry.threads)
+            for (uint32_t counter = 0; counter < cCounterCount; ++counter)
+                totals[counter] += thread_counters->values[counter].load(std::memory_order_relaxed);
+
+        for (uint32_t counter = 0; counter < cCounterCount; ++counter)
+            registry.frame_values[counter].store(totals[counter] - registry.previous_totals[counter], std::memory_order_relaxed);
+
+        registry.previous_totals = totals;
+    }
+
+    uint64_t FrameCounters::getFrameValue(FrameCounter counter)
+    {
+        return getRegistry().frame_values[static_cast<uint32_t>(counter)].load(std::memory_order_relaxed);
+    }
+
+    std::optional<uint64_t> FrameCounters::getFrameValue(const std::string_view name)
+    {
+        for (uint32_t counter = 0; counter < cCounterCount; ++counter)
+            if (name == getCounterName(static_cast<FrameCounter>(counter)))
+                return getFrameValue(static_cast<FrameCounter>(counter));
+
+        return std::nullopt;
+    }
+
+    const char* FrameCounters::getCounterName(const FrameCounter counter)
+    {
+        switch (counter)
+        {
+            case FrameCounter::cRenderCommands: return "render_commands";
+            case FrameCounter::cRenderCommandBytes: return "render_command_bytes";
+            case FrameCounter::cDrawCalls: return "draw_calls";
+            case FrameCounter::cPipelineBinds: return "pipeline_binds";
+            case FrameCounter::cMemoryRequests: return "memory_requests";
+            case FrameCounter::cMemoryRequestBytes: return "memory_request_bytes";
+            case FrameCounter::cEventsDispatched: return "events_dispatched";
+            case FrameCounter::cLayersUpdated: return "layers_updated";
+            case FrameCounter::cGlStateCallsSkipped: return "gl_state_calls_skipped";
+            case FrameCounter::cTransformsUpdated: return "transforms_updated";
+            case FrameCounter::cObjectsVisible: return "objects_visible";
+            case FrameCounter::cObjectsCulled: return "objects_culled";
+            case FrameCounter::cObjectsOccluded: return "objects_occluded";
+            default: return "unknown";
+        }
+    }
+
+}
@@ -0,0 +1,255 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "debug/FrameStats.h"
+
+#include <bit>
+#include <cmath>
+#include <format>
+#include <iterator>
+#include <algorithm>
+
+#include "core/Assert.h"
+#include "core/Logging.h"
+#include "debug/FrameCounters.h"
+
+namespace nebula {
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    //////////////////////////////////////////////  FrameHistogram  ////////////////////////////////////////////////////
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FrameHistogram::record(const double seconds)
+    {
+        const double clamped_seconds = std::max(seconds, 0.0);
+        const auto microseconds = static_cast<uint64_t>(std::llround(clamped_seconds * 1e6));
+
+        m_buckets[getBucket(microseconds)]++;
+        m_count++;
+        m_sum += clamped_seconds;
+        m_max = std::max(m_max, clamped_seconds);
+    }
+
+    void FrameHistogram::reset()
+    {
+        m_buckets.fill(0);
+        m_count = 0;
+        m_sum = 0.0;
+        m_max = 0.0;
+    }
+
+    double FrameHistogram::getPercentile(const double percentile) const
+    {
+        if (m_count == 0)
+            return 0.0;
+
+        const auto target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(m_count))));
+
+        uint64_t accumulated = 0;
+        for (uint32_t bucket = 0; bucket < cBuckets; ++bucket)
+        {
+            accumulated += m_buckets[bucket];
+            if (accumulated >= target)
+                return std::min(getBucketValue(bucket), m_max);
+        }
+
+        return m_max;
+    }
+
+    //  First cSubBuckets values are exact, then every octave gets cSubBuckets / 2 linear buckets
+    uint32_t FrameHistogram::getBucket(uint64_t microseconds)
+    {
+        microseconds = std::min<uint64_t>(microseconds, (1ull << cMaxValueBits) - 1);
+        if (microseconds < cSubBuckets)
+            return static_cast<uint32_t>(microseconds);
+
+        const uint32_t shift = static_cast<uint32_t>(std::bit_width(microseconds)) - cSubBucketBits;
+        const auto sub_bucket = static_cast<uint32_t>(microseconds >> shift);
+
+        return cSubBuckets + (shift - 1) * (cSubBuckets / 2) + (sub_bucket - cSubBuckets / 2);
+    }
+
+    double FrameHistogram::getBucketValue(const uint32_t bucket)
+    {
+        if (bucket < cSubBuckets)
+            return static_cast<double>(bucket) * 1e-6;
+
+        const uint32_t octave_bucket = bucket - cSubBuckets;
+        const uint32_t shift = octave_bucket / (cSubBuckets / 2) + 1;
+        const uint64_t sub_bucket = octave_bucket % (cSubBuckets / 2) + cSubBuckets / 2;
+
+        //  Middle of the bucket keeps error symmetric
+        const uint64_t lower = sub_bucket << shift;
+        return static_cast<double>(lower + (1ull << shift) / 2) * 1e-6;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ////////////////////////////////////////////////  FrameStats  //////////////////////////////////////////////////////
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FrameStats* FrameStats::s_instance = nullptr;
+
+    FrameStats::FrameStats()
+    {
+        NB_CORE_ASSERT(!s_instance, "Can have only one FrameStats!");
+        s_instance = this;
+    }
+
+    FrameStats::~FrameStats()
+    {
+        stopCsvRecording();
+
+        NB_CORE_ASSERT(s_instance);
+        s_instance = nullptr;
+    }
+
+    void FrameStats::record(FrameMetric metric, const double seconds)
+    {
+        auto& history = m_metrics[static_cast<uint32_t>(metric)];
+
+        std::lock_guard lock{m_mutex};
+        history.histogram.record(seconds);
+        history.window[history.next_sample] = seconds;
+        history.next_sample = (history.next_sample + 1) % cRollingWindow;
+        history.window_size = std::min(history.window_size + 1, cRollingWindow);
+        history.last = seconds;
+    }
+
+    void FrameStats::endFrame()
+    {
+        FrameCounters::aggregateFrame();
+
+        std::lock_guard lock{m_mutex};
+        m_frame++;
+
+        if (!m_csv_file.is_open())
+            return;
+
+        m_csv_file << m_frame;
+        //  Formats straight into file buffer, recording does not allocate per frame
+        for (const auto& history : m_metrics)
+            std::format_to(std::ostreambuf_iterator<char>(m_csv_file), ",{:.4f}", history.last * 1e3);
+        for (uint32_t counter = 0; counter < FrameCounters::cCounterCount; ++counter)
+            m_csv_file << ',' << FrameCounters::getFrameValue(static_cast<FrameCounter>(counter));
+        m_csv_file << '\n';
+    }
+
+    void FrameStats::reset()
+    {
+        std::lock_guard lock{m_mutex};
+        for (auto& history : m_metrics)
+            history = MetricHistory{};
+    }
+
+    uint64_t FrameStats::getFrameCount() const
+    {
+        std::lock_guard lock{m_mutex};
+        return m_frame;
+    }
+
+    FrameMetricSummary FrameStats::getSummary(FrameMetric metric) const
+    {
+        const auto& history = m_metrics[static_cast<uint32_t>(metric)];
+
+        std::lock_guard lock{m_mutex};
+
+        FrameMetricSummary summary;
+        summary.last = history.last * 1e3;
+        summary.p50 = history.histogram.getPercentile(50.0) * 1e3;
+        summary.p95 = history.histogram.getPercentile(95.0) * 1e3;
+        summary.p99 = history.histogram.getPercentile(99.0) * 1e3;
+        summary.max = history.histogram.getMax() * 1e3;
+
+        if (history.window_size > 0)
+        {
+            double sum = 0.0;
+            for (uint32_t i = 0; i < history.window_size; ++i)
+            {
+                sum += history.window[i];
+                summary.window_max = std::max(summary.window_max, history.window[i]);
+            }
+
+            summary.window_mean = sum / history.window_size * 1e3;
+            summary.window_max *= 1e3;
+        }
+
+        return summary;
+    }
+
+    std::array<float, FrameStats::cRollingWindow> FrameStats::getRollingWindow(FrameMetric metric) const
+    {
+        const auto& history = m_metrics[static_cast<uint32_t>(metric)];
+
+        std::lock_guard lock{m_mutex};
+
+        //  Until window fills up, missing samples are left as zeros at the front
+        std::array<float, cRollingWindow> samples{};
+        const uint32_t first_sample = history.window_size < cRollingWindow ? 0 : history.next_sample;
+        const uint32_t offset = cRollingWindow - history.window_size;
+
+        for (uint32_t i = 0; i < history.window_size; ++i)
+            samples[offset + i] = static_cast<float>(history.window[(first_sample + i) % cRollingWindow] * 1e3);
+
+        return samples;
+    }
+
+    void FrameStats::startCsvRecording(const filesystem::Path& path)
+    {
+        std::lock_guard lock{m_mutex};
+
+        if (m_csv_file.is_open())
+            m_csv_file.close();
+
+        m_csv_file.open(path, std::ios::out | std::ios::trunc);
+        if (!m_csv_file.is_open())
+        {
+            NB_CORE_ERROR("Failed to open frame stats file {}!", path.string());
+            return;
+        }
+
+        writeCsvHeader();
+        NB_CORE_INFO("Recording frame stats to {}", path.string());
+    }
+
+    void FrameStats::stopCsvRecording()
+    {
+        std::lock_guard lock{m_mutex};
+
+        if (m_csv_file.is_open())
+            m_csv_file.close();
+    }
+
+    bool FrameStats::checkCsvRecording() const
+    {
+        std::lock_guard lock{m_mutex};
+        return m_csv_file.is_open();
+    }
+
+    const char* FrameStats::getMetricName(const FrameMetric metric)
+    {
+        switch (metric)
+        {
+            case FrameMetric::cUpdateCpu: return "update_cpu";
+            case FrameMetric::cUpdateSleep: return "update_sleep";
+            case FrameMetric::cRenderCpu: return "render_cpu";
+            case FrameMetric::cFenceWait: return "fence_wait";
+            case FrameMetric::cPresent: return "present";
+            case FrameMetric::cRenderSleep: return "render_sleep";
+            case FrameMetric::cFrameTime: return "frame_time";
+            default: return "unknown";
+        }
+    }
+
+    void FrameStats::writeCsvHeader()
+    {
+        m_csv_file << "frame";
+        for (uint32_t metric = 0; metric < cMetricCount; ++metric)
+            m_csv_file << ',' << getMetricName(static_cast<FrameMetric>(metric)) << "_ms";
+        for (uint32_t counter = 0; counter < FrameCounters::cCounterCount; ++counter)
+            m_csv_file << ',' << FrameCounters::getCounterName(static_cast<FrameCounter>(counter));
+        m_csv_file << '\n';
+    }
+
+}
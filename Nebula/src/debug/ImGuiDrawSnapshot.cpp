@@ -0,0 +1,73 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "debug/ImGuiDrawSnapshot.h"
+
+#include <cstring>
+
+namespace nebula {
+
+    template <typename T>
+    static void copyVector(const ImVector<T>& source, ImVector<T>& destination)
+    {
+        destination.resize(source.Size);
+        if (source.Size > 0)
+            std::memcpy(destination.Data, source.Data, source.size_in_bytes());
+    }
+
+    ImGuiDrawSnapshot::~ImGuiDrawSnapshot()
+    {
+        for (const auto draw_list : m_draw_lists)
+            IM_DELETE(draw_list);
+    }
+
+    void ImGuiDrawSnapshot::capture(const ImDrawData& source)
+    {
+        //  Output only draw lists, renderer backends never touch shared data
+        while (m_draw_lists.Size < source.CmdListsCount)
+            m_draw_lists.push_back(IM_NEW(ImDrawList)(nullptr));
+
+        m_draw_data.Valid = source.Valid;
+        m_draw_data.CmdListsCount = source.CmdListsCount;
+        m_draw_data.TotalIdxCount = source.TotalIdxCount;
+        m_draw_data.TotalVtxCount = source.TotalVtxCount;
+        m_draw_data.DisplayPos = source.DisplayPos;
+        m_draw_data.DisplaySize = source.DisplaySize;
+        m_draw_data.FramebufferScale = source.FramebufferScale;
+        m_draw_data.OwnerViewport = source.OwnerViewport;   //  Persistent, backends keep per viewport render buffers in it
+
+        m_draw_data.CmdLists.resize(source.CmdListsCount);
+        for (int i = 0; i < source.CmdListsCount; ++i)
+        {
+            const ImDrawList& source_list = *source.CmdLists[i];
+            ImDrawList& draw_list = *m_draw_lists[i];
+
+            copyVector(source_list.CmdBuffer, draw_list.CmdBuffer);
+            copyVector(source_list.IdxBuffer, draw_list.IdxBuffer);
+            copyVector(source_list.VtxBuffer, draw_list.VtxBuffer);
+            draw_list.Flags = source_list.Flags;
+
+            m_draw_data.CmdLists[i] = &draw_list;
+        }
+    }
+
+    void ImGuiDrawBuffer::publish()
+    {
+        //  Release makes captured draw data visible to render thread, acquire takes back slot it no longer reads
+        m_write_index = m_ready_index.exchange(m_write_index | cFreshBit, std::memory_order_acq_rel) & cIndexMask;
+    }
+
+    ImGuiDrawSnapshot* ImGuiDrawBuffer::acquire()
+    {
+        if (m_ready_index.load(std::memory_order_relaxed) & cFreshBit)
+        {
+            m_read_index = m_ready_index.exchange(m_read_index, std::memory_order_acq_rel) & cIndexMask;
+            m_has_snapshot = true;
+        }
+
+        return m_has_snapshot ? &m_snapshots[m_read_index] : nullptr;
+    }
+
+}
@@ -9,13 +9,16 @@
 #include <format>
 
 #include <imgui.h>
-#include <numeric>
 #include <GLFW/glfw3.h>
 #include <backends/imgui_impl_glfw.h>
 
-#include "core/Timestep.h"
 #include "core/Application.h"
 #include "core/UpdateContext.h"
+#include "debug/Profiler.h"
+#include "debug/FrameStats.h"
+#include "debug/FrameCounters.h"
+#include "debug/ImGuiDrawSnapshot.h"
+#include "rendering/GpuProfiler.h"
 #include "rendering/RenderContext.h"
 
 #include "platform/Vulkan/VulkanImGuiBackend.h"
@@ -27,6 +30,7 @@ namespace nebula {
 
     int ImGuiLayer::s_counter = 0;
     ImGuiBackend* ImGuiLayer::s_backend = nullptr;
+    ImGuiDrawBuffer* ImGuiLayer::s_draw_buffer = nullptr;
 
     void ImGuiBackend::init()
     {
@@ -53,12 +57,16 @@ namespace nebula {
         NB_CORE_ASSERT(!s_backend);
         m_backend = ImGuiBackend::create(renderpass);
         s_backend = m_backend.get();
+
+        m_draw_buffer = createScope<ImGuiDrawBuffer>();
+        s_draw_buffer = m_draw_buffer.get();
     }
 
     ImGuiLayer::~ImGuiLayer()
     {
         NB_CORE_ASSERT(s_backend);
         s_backend = nullptr;
+        s_draw_buffer = nullptr;
     }
 
     void ImGuiLayer::onAttach()
@@ -78,7 +86,11 @@ namespace nebula {
             style.Colors[ImGuiCol_WindowBg].w = 1.0f;
         }
 
+        //  Update thread starts building frames right after init, fonts have to be ready before first NewFrame
+        io.Fonts->Build();
+
         s_backend->onAttach();
+        s_backend->newFrame();
     }
 
     void ImGuiLayer::onDetach()
@@ -100,27 +112,33 @@ namespace nebula {
 
     void ImGuiLayer::begin()
     {
-        s_backend->begin();
-
         ImGui_ImplGlfw_NewFrame();
         ImGui::NewFrame();
     }
 
-    void ImGuiLayer::end(void* command_buffer_handle)
+    void ImGuiLayer::end()
     {
         ImGuiIO& io = ImGui::GetIO();
         const Window& window = Application::getWindow();
         io.DisplaySize = ImVec2(static_cast<float>(window.getWidth()), static_cast<float>(window.getHeight()));
 
-        s_backend->end(command_buffer_handle);
+        ImGui::Render();
 
-        if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
-        {
-            GLFWwindow* backup_current_context = glfwGetCurrentContext();
-            ImGui::UpdatePlatformWindows();
-            ImGui::RenderPlatformWindowsDefault();
-            glfwMakeContextCurrent(backup_current_context);
-        }
+        //  Platform windows are not snapshotted, so multi-viewport has to stay disabled
+        NB_CORE_ASSERT(!(io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable), "ImGui viewports are not supported!");
+
+        s_draw_buffer->getWriteSnapshot().capture(*ImGui::GetDrawData());
+        s_draw_buffer->publish();
+    }
+
+    void ImGuiLayer::render(void* command_buffer_handle)
+    {
+        NB_PROFILE_FUNCTION();
+
+        s_backend->newFrame();
+
+        if (const auto snapshot = s_draw_buffer->acquire())
+            s_backend->renderDrawData(snapshot->getDrawData(), command_buffer_handle);
     }
 
     void ImGuiLayer::reloadBackend(RenderPass& renderpass)
@@ -146,45 +164,34 @@ namespace nebula {
 
         apiSection();
         fpsSection();
+        frameStatsSection();
+        gpuTimingsSection();
+        profilerSection();
 
         ImGui::End();
     }
 
     void ImGuiLayer::fpsSection()
     {
-        //  Frame time graph
-        static constexpr int n_frames = 100;
-        static std::array<float, n_frames> frame_times{};
-        static int frame_offset = 0;
-
-        //  FPS control variables
-        static bool vsync = RenderContext::get().checkVSync();
-        static float update_timestep = UpdateContext::get().getUpdateTimestep();
-        static int render_fps = RenderContext::get().getRenderFps();
-
-        //  Update current application settings
-        auto& application = Application::get();
         auto& update_context = UpdateContext::get();
         auto& render_context = RenderContext::get();
 
-        // vsync = application.getWindow().getProperties().vsync;
-        vsync = render_context.checkVSync();
-        update_timestep = update_context.getUpdateTimestep();
-        render_fps = render_context.getRenderFps();
+        //  FPS control variables, contexts are written only when widget changed them
+        bool vsync = render_context.checkVSync();
+        float update_timestep = update_context.getUpdateTimestep();
+        int render_fps = render_context.getRenderFps();
 
-        //  Update current frame time info
-        auto frame_time = Timestep(m_frame_timer.elapsedSeconds(true));
-        auto frame_milliseconds = frame_time.getMilliSeconds();
+        //  Frame time is measured by render thread, this layer runs at update thread cadence
+        auto& frame_stats = FrameStats::get();
+        const auto frame_time = frame_stats.getSummary(FrameMetric::cFrameTime);
+        const auto frame_times = frame_stats.getRollingWindow(FrameMetric::cFrameTime);
+        const double frame_milliseconds = frame_time.last;
 
-        int current_fps = 1.0 / frame_time;
+        int current_fps = frame_milliseconds > 0.0 ? 1000.0 / frame_milliseconds : 0;
         float target_milliseconds = render_fps == 0 ? 0.0f : 1000.0f / render_fps;
 
-        //  Update graph info
-        frame_times[frame_offset] = static_cast<float>(frame_milliseconds);
-        frame_offset = (frame_offset + 1) % n_frames;
-
-        int average_fps = 1000.0f * n_frames / std::accumulate(frame_times.begin(), frame_times.end(), 0.0f);
-        int one_percent_low = 1000.0f / *std::ranges::max_element(frame_times);
+        int average_fps = frame_time.window_mean > 0.0 ? 1000.0 / frame_time.window_mean : 0;
+        int one_percent_low = frame_time.p99 > 0.0 ? 1000.0 / frame_time.p99 : 0;
 
         //  Prepare text
         auto fps_text = render_fps == 0 ? "unlimited" : std::to_string(render_fps);
@@ -193,9 +200,13 @@ namespace nebula {
 
         if (ImGui::CollapsingHeader("Frames per second", ImGuiTreeNodeFlags_DefaultOpen))
         {
-            ImGui::Checkbox("VSync", &vsync);
-            ImGui::SliderFloat("Update timestep", &update_timestep, 0.01, 1.0);
-            ImGui::SliderInt("Render fps", &render_fps, 0, 500);
+            //  Render thread reads these settings every frame
+            if (ImGui::Checkbox("VSync", &vsync))
+                render_context.setVSync(vsync);
+            if (ImGui::SliderFloat("Update timestep", &update_timestep, 0.01, 1.0))
+                update_context.setUpdateTimestep(update_timestep);
+            if (ImGui::SliderInt("Render fps", &render_fps, 0, 500))
+                render_context.setRenderFps(render_fps);
 
             ImGui::Separator();
 
@@ -207,13 +218,104 @@ namespace nebula {
 
             ImGui::Separator();
 
-            ImGui::PlotLines("Frame time [ms]", frame_times.data(), n_frames, frame_offset, average_fps_text.c_str(), 0.0f, 50.0f, ImVec2(0, 80.0f));
+            ImGui::PlotLines("Frame time [ms]", frame_times.data(), FrameStats::cRollingWindow, 0, average_fps_text.c_str(), 0.0f, 50.0f, ImVec2(0, 80.0f));
+        }
+    }
+
+    void ImGuiLayer::frameStatsSection()
+    {
+        if (!FrameStats::checkEnabled())
+            return;
+
+        auto& frame_stats = FrameStats::get();
+
+        if (ImGui::CollapsingHeader("Frame stats"))
+        {
+            if (ImGui::BeginTable("frame_stats", 6, ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+            {
+                ImGui::TableSetupColumn("Metric");
+                ImGui::TableSetupColumn("Avg [ms]");
+                ImGui::TableSetupColumn("p50");
+                ImGui::TableSetupColumn("p95");
+                ImGui::TableSetupColumn("p99");
+                ImGui::TableSetupColumn("Max");
+                ImGui::TableHeadersRow();
+
+                for (uint32_t metric = 0; metric < FrameStats::cMetricCount; ++metric)
+                {
+                    const auto summary = frame_stats.getSummary(static_cast<FrameMetric>(metric));
+
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();   ImGui::TextUnformatted(FrameStats::getMetricName(static_cast<FrameMetric>(metric)));
+                    ImGui::TableNextColumn();   ImGui::Text("%.3f", summary.window_mean);
+                    ImGui::TableNextColumn();   ImGui::Text("%.3f", summary.p50);
+                    ImGui::TableNextColumn();   ImGui::Text("%.3f", summary.p95);
+                    ImGui::TableNextColumn();   ImGui::Text("%.3f", summary.p99);
+                    ImGui::TableNextColumn();   ImGui::Text("%.3f", summary.max);
+                }
+
+                ImGui::EndTable();
+            }
+
+            for (uint32_t counter = 0; counter < FrameCounters::cCounterCount; ++counter)
+            {
+                const auto frame_counter = static_cast<FrameCounter>(counter);
+                ImGui::Text("%s: %llu", FrameCounters::getCounterName(frame_counter), static_cast<unsigned long long>(FrameCounters::getFrameValue(frame_counter)));
+            }
+
+            const auto frame_times = frame_stats.getRollingWindow(FrameMetric::cFrameTime);
+            ImGui::PlotLines("Frame time [ms]", frame_times.data(), FrameStats::cRollingWindow, 0, nullptr, 0.0f, 50.0f, ImVec2(0, 80.0f));
+
+            if (ImGui::Button("Reset"))
+                frame_stats.reset();
+
+            ImGui::SameLine();
+
+            if (frame_stats.checkCsvRecording())
+            {
+                if (ImGui::Button("Stop CSV recording"))
+                    frame_stats.stopCsvRecording();
+            }
+            else if (ImGui::Button("Record CSV"))
+                frame_stats.startCsvRecording("nebula_frame_stats.csv");
         }
+    }
+
+    void ImGuiLayer::gpuTimingsSection()
+    {
+        if (!GpuProfiler::checkEnabled())
+            return;
+
+        if (ImGui::CollapsingHeader("GPU timings", ImGuiTreeNodeFlags_DefaultOpen))
+        {
+            for (const auto& zone_stats : GpuProfiler::get().getZoneStats())
+            {
+                if (zone_stats.stage)
+                    ImGui::Indent();
 
-        //  Set new fps settings
-        update_context.setUpdateTimestep(update_timestep);
-        render_context.setRenderFps(render_fps);
-        render_context.setVSync(vsync);
+                ImGui::Text("%s: %.3fms (avg %.3fms)", zone_stats.name.c_str(), zone_stats.milliseconds, zone_stats.average_milliseconds);
+
+                if (zone_stats.stage)
+                    ImGui::Unindent();
+            }
+        }
+    }
+
+    void ImGuiLayer::profilerSection()
+    {
+        #ifdef NB_ENABLE_PROFILING
+        static int capture_frames = 120;
+
+        if (ImGui::CollapsingHeader("CPU profiler"))
+        {
+            ImGui::SliderInt("Frames", &capture_frames, 1, 1000);
+
+            if (Profiler::checkCapturing())
+                ImGui::Text("Capturing...");
+            else if (ImGui::Button("Capture Chrome trace"))
+                Profiler::captureFrames(capture_frames, "nebula_trace.json");
+        }
+        #endif
     }
 
 }
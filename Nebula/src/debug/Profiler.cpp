@@ -0,0 +1,214 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "debug/Profiler.h"
+
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <format>
+#include <vector>
+#include <fstream>
+
+#include "core/Types.h"
+#include "core/Logging.h"
+
+namespace nebula {
+
+    struct ProfilerZone
+    {
+        const char* name = nullptr;
+        int64_t begin = 0;
+        int64_t end = 0;
+    };
+
+    //  Single writer ring buffer, only owning thread writes zones
+    struct ProfilerThreadTrace
+    {
+        std::string name;
+        uint32_t thread_index = 0;
+
+        std::atomic_uint64_t written_zones = 0;
+        uint64_t capture_first_zone = 0;    //  Guarded by ProfilerState::mutex
+
+        std::array<ProfilerZone, Profiler::cZonesPerThread> zones{};
+    };
+
+    struct ProfilerState
+    {
+        std::mutex mutex;
+        std::vector<Scope<ProfilerThreadTrace>> threads;
+
+        std::atomic_bool capturing = false;
+        uint32_t capture_frames = 0;
+        uint32_t capture_frames_left = 0;
+        int64_t capture_begin = 0;
+        filesystem::Path capture_path;
+    };
+
+    static ProfilerState& getProfilerState()
+    {
+        static ProfilerState state;
+        return state;
+    }
+
+    static thread_local ProfilerThreadTrace* s_thread_trace = nullptr;
+
+    static ProfilerThreadTrace& getThreadTrace()
+    {
+        if (!s_thread_trace)
+        {
+            auto& state = getProfilerState();
+            std::lock_guard lock{state.mutex};
+
+            auto& thread_trace = state.threads.emplace_back(createScope<ProfilerThreadTrace>());
+            thread_trace->thread_index = static_cast<uint32_t>(state.threads.size() - 1);
+            thread_trace->name = std::format("Thread {}", thread_trace->thread_index);
+            thread_trace->capture_first_zone = thread_trace->written_zones.load();
+
+            s_thread_trace = thread_trace.get();
+        }
+
+        return *s_thread_trace;
+    }
+
+    static std::string escapeJson(const std::string_view text)
+    {
+        std::string escaped;
+        escaped.reserve(text.size());
+
+        for (const char character : text)
+        {
+            if (character == '"' || character == '\\')
+                escaped.push_back('\\');
+            escaped.push_back(character);
+        }
+
+        return escaped;
+    }
+
+    static void writeCapture(ProfilerState& state)
+    {
+        std::ofstream file(state.capture_path);
+        if (!file.good())
+        {
+            NB_CORE_ERROR("Unable to write CPU profiler capture to {}!", state.capture_path.string());
+            return;
+        }
+
+        file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+        bool first_event = true;
+        auto separator = [&first_event]
+        {
+            const char* text = first_event ? "\n" : ",\n";
+            first_event = false;
+            return text;
+        };
+
+        std::vector<ProfilerZone> zones;
+        for (const auto& thread_trace : state.threads)
+        {
+            file << separator() << std::format(
+                R"({{"name":"thread_name","ph":"M","pid":0,"tid":{},"args":{{"name":"{}"}}}})",
+                thread_trace->thread_index, escapeJson(thread_trace->name)
+            );
+
+            //  Owning thread may still be finishing its last zone, drop anything it overwrote while copying
+            const uint64_t written_zones = thread_trace->written_zones.load(std::memory_order_acquire);
+            const uint64_t first_zone = std::max(thread_trace->capture_first_zone, written_zones > Profiler::cZonesPerThread ? written_zones - Profiler::cZonesPerThread : 0);
+
+            zones.clear();
+            for (uint64_t zone = first_zone; zone < written_zones; ++zone)
+                zones.push_back(thread_trace->zones[zone % Profiler::cZonesPerThread]);
+
+            const uint64_t overwritten_zones = thread_trace->written_zones.load(std::memory_order_acquire);
+            if (overwritten_zones > first_zone + Profiler::cZonesPerThread)
+            {
+                const uint64_t torn_zones = std::min<uint64_t>(overwritten_zones - first_zone - Profiler::cZonesPerThread, zones.size());
+                zones.erase(zones.begin(), zones.begin() + static_cast<std::ptrdiff_t>(torn_zones));
+            }
+
+            for (const auto& zone : zones)
+            {
+                file << separator() << std::format(
+                    R"({{"name":"{}","ph":"X","pid":0,"tid":{},"ts":{:.3f},"dur":{:.3f}}})",
+                    escapeJson(zone.name), thread_trace->thread_index,
+                    static_cast<double>(zone.begin - state.capture_begin) * 0.001,
+                    static_cast<double>(zone.end - zone.begin) * 0.001
+                );
+            }
+        }
+
+        file << "\n]}\n";
+
+        NB_CORE_INFO("Written CPU profiler capture of {} frames to {}", state.capture_frames, state.capture_path.string());
+    }
+
+    void Profiler::captureFrames(const uint32_t frames, const filesystem::Path& path)
+    {
+        NB_CORE_ASSERT(frames > 0, "CPU profiler capture needs at least one frame!");
+
+        auto& state = getProfilerState();
+        std::lock_guard lock{state.mutex};
+
+        if (state.capturing.load())
+        {
+            NB_CORE_WARN("CPU profiler capture is already running!");
+            return;
+        }
+
+        state.capture_frames = frames;
+        state.capture_frames_left = frames;
+        state.capture_path = path;
+        state.capture_begin = now();
+
+        for (const auto& thread_trace : state.threads)
+            thread_trace->capture_first_zone = thread_trace->written_zones.load(std::memory_order_acquire);
+
+        state.capturing.store(true, std::memory_order_release);
+    }
+
+    bool Profiler::checkCapturing()
+    {
+        return getProfilerState().capturing.load(std::memory_order_relaxed);
+    }
+
+    void Profiler::markFrame()
+    {
+        auto& state = getProfilerState();
+        if (!state.capturing.load(std::memory_order_relaxed))
+            return;
+
+        std::lock_guard lock{state.mutex};
+        if (--state.capture_frames_left > 0)
+            return;
+
+        state.capturing.store(false);
+        writeCapture(state);
+    }
+
+    void Profiler::setThreadName(const std::string& name)
+    {
+        auto& thread_trace = getThreadTrace();
+
+        std::lock_guard lock{getProfilerState().mutex};
+        thread_trace.name = name;
+    }
+
+    void Profiler::recordZone(const char* name, const int64_t begin_nanoseconds, const int64_t end_nanoseconds)
+    {
+        //  Zones are only stored while capture is running, otherwise profiling costs two clock reads
+        if (!getProfilerState().capturing.load(std::memory_order_relaxed))
+            return;
+
+        auto& thread_trace = getThreadTrace();
+        const uint64_t zone = thread_trace.written_zones.load(std::memory_order_relaxed);
+
+        thread_trace.zones[zone % cZonesPerThread] = ProfilerZone{name, begin_nanoseconds, end_nanoseconds};
+        thread_trace.written_zones.store(zone + 1, std::memory_order_release);
+    }
+
+}
@@ -8,6 +8,7 @@
 #include <ranges>
 
 #include "memory/MemoryManager.h"
+#include "debug/FrameCounters.h"
 
 namespace nebula {
 
@@ -41,6 +42,7 @@ namespace nebula {
     void EventManager::dispatchEvents()
     {
         std::lock_guard<std::mutex> lock{m_mutex};
+        NB_COUNT(cEventsDispatched, m_events.size());
 
         //  Events don't get destroyed, so their destructors aren't called
         for (const auto& event : m_events)
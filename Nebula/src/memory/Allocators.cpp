@@ -5,6 +5,8 @@
 
 #include "memory/Allocators.h"
 
+#include <algorithm>
+
 namespace nebula::memory {
 
     //  Helpers
@@ -227,4 +229,117 @@ namespace nebula::memory {
         m_current_address = shiftPointer(address, header->adjustment, false);
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////
+    ////    PoolAllocator    ////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PoolAllocator::PoolAllocator(
+        void* memory_chunk,
+        std::size_t size,
+        std::size_t block_size,
+        std::uintptr_t block_alignment
+    ) noexcept :
+            Allocator(memory_chunk, size),
+            m_block_alignment(block_alignment)
+    {
+        NB_CORE_ASSERT(block_size > 0 && block_alignment > 0, "Invalid pool allocator block!");
+
+        //  Free blocks hold next pointer, blocks are laid out back to back so size is multiple of alignment
+        block_size = std::max(block_size, sizeof(void*));
+        m_block_size = (block_size + block_alignment - 1) / block_alignment * block_alignment;
+
+        const auto adjustment = alignForwardAdjustment(memory_chunk, block_alignment);
+        m_first_block = shiftPointer(memory_chunk, adjustment);
+        m_block_count = size > adjustment ? (size - adjustment) / m_block_size : 0;
+        m_free_block_count = m_block_count;
+
+        NB_CORE_ASSERT(m_block_count > 0, "Pool allocator memory can't fit single block!");
+
+        void** block = nullptr;
+        for (std::size_t i = m_block_count; i > 0; --i)
+        {
+            auto** next = static_cast<void**>(shiftPointer(m_first_block, (i - 1) * m_block_size));
+            *next = block;
+            block = next;
+        }
+        m_free_list = block;
+    }
+
+    PoolAllocator::PoolAllocator(PoolAllocator&& rhs) noexcept :
+            Allocator(std::move(rhs)),
+            m_block_size(rhs.m_block_size),
+            m_block_alignment(rhs.m_block_alignment),
+            m_block_count(rhs.m_block_count),
+            m_free_block_count(rhs.m_free_block_count),
+            m_first_block(rhs.m_first_block),
+            m_free_list(rhs.m_free_list)
+    {
+        rhs.m_block_count = 0;
+        rhs.m_free_block_count = 0;
+        rhs.m_first_block = nullptr;
+        rhs.m_free_list = nullptr;
+    }
+
+    PoolAllocator& PoolAllocator::operator=(PoolAllocator&& rhs) noexcept
+    {
+        Allocator::operator=(std::move(rhs));
+
+        m_block_size = rhs.m_block_size;
+        m_block_alignment = rhs.m_block_alignment;
+        m_block_count = rhs.m_block_count;
+        m_free_block_count = rhs.m_free_block_count;
+        m_first_block = rhs.m_first_block;
+        m_free_list = rhs.m_free_list;
+
+        rhs.m_block_count = 0;
+        rhs.m_free_block_count = 0;
+        rhs.m_first_block = nullptr;
+        rhs.m_free_list = nullptr;
+
+        return *this;
+    }
+
+    void* PoolAllocator::allocate(std::size_t size, std::uintptr_t alignment)
+    {
+        NB_CORE_ASSERT(size > 0 && alignment > 0, "Invalid allocation request!");
+        NB_CORE_ASSERT(size <= m_block_size && m_block_alignment % alignment == 0, "Allocation doesn't fit pool allocator block!");
+
+        if (!m_free_list)
+            throw std::bad_alloc();
+
+        void* block = m_free_list;
+        m_free_list = static_cast<void**>(*m_free_list);
+        --m_free_block_count;
+
+        #ifdef NB_DEBUG_BUILD
+        m_used += m_block_size;
+        ++m_num_allocations;
+        #endif
+
+        return block;
+    }
+
+    void PoolAllocator::deallocate(void* address)
+    {
+        NB_CORE_ASSERT(owns(address), "Address was not allocated by this pool allocator!");
+
+        auto** block = static_cast<void**>(address);
+        *block = m_free_list;
+        m_free_list = block;
+        ++m_free_block_count;
+
+        #ifdef NB_DEBUG_BUILD
+        m_used -= m_block_size;
+        --m_num_allocations;
+        #endif
+    }
+
+    bool PoolAllocator::owns(const void* address) const
+    {
+        const auto begin = reinterpret_cast<std::uintptr_t>(m_first_block);
+        const auto position = reinterpret_cast<std::uintptr_t>(address);
+
+        return position >= begin && position < begin + m_block_count * m_block_size && (position - begin) % m_block_size == 0;
+    }
+
 }
@@ -5,6 +5,9 @@
 
 #include "memory/MemoryManager.h"
 
+#include "debug/FrameCounters.h"
+#include "debug/AllocationGuard.h"
+
 namespace nebula::memory {
 
     using namespace impl;
@@ -14,6 +17,12 @@ namespace nebula::memory {
 
     void* MemoryManager::requestMemory(std::size_t size)
     {
+        NB_COUNT(cMemoryRequests, 1);
+        NB_COUNT(cMemoryRequestBytes, size);
+
+        AllocationGuard::onAllocation(size, "MemoryManager");
+        AllocationGuard::Suppress suppress;
+
         std::lock_guard<std::mutex> lock{s_mutex};
         s_memory_chunks.emplace_back(std::make_unique<MemoryChunk>(size));
         return s_memory_chunks.back()->getAddress();
@@ -0,0 +1,111 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "memory/OffsetAllocator.h"
+
+#include <iterator>
+
+#include "core/Assert.h"
+
+namespace nebula::memory {
+
+    OffsetAllocator::OffsetAllocator(const uint64_t capacity) : m_capacity(capacity)
+    {
+        NB_CORE_ASSERT(capacity > 0, "OffsetAllocator requires non empty range!");
+        reset();
+    }
+
+    OffsetAllocation OffsetAllocator::allocate(const uint64_t size, const uint64_t alignment)
+    {
+        NB_CORE_ASSERT(size > 0 && alignment > 0, "Invalid OffsetAllocator request!");
+
+        //  Smallest range that fits, ranges with too much alignment padding are skipped
+        for (auto it = m_free_by_size.lower_bound(size); it != m_free_by_size.end(); ++it)
+        {
+            const auto [range_size, range_offset] = *it;
+            const uint64_t offset = (range_offset + alignment - 1) / alignment * alignment;
+            const uint64_t padding = offset - range_offset;
+            if (padding + size > range_size)
+                continue;
+
+            eraseFreeRange(m_free_by_offset.find(range_offset));
+
+            //  Padding stays free, so aligned allocations don't leak memory
+            if (padding > 0)
+                insertFreeRange(range_offset, padding);
+            if (padding + size < range_size)
+                insertFreeRange(offset + size, range_size - padding - size);
+
+            m_used += size;
+            return {offset, size};
+        }
+
+        return {};
+    }
+
+    void OffsetAllocator::free(const OffsetAllocation& allocation)
+    {
+        if (!allocation.valid())
+            return;
+
+        NB_CORE_ASSERT(allocation.offset + allocation.size <= m_capacity, "Freed range doesn't belong to OffsetAllocator!");
+
+        uint64_t offset = allocation.offset;
+        uint64_t size = allocation.size;
+
+        //  Merge with free neighbours, so fragmentation doesn't accumulate
+        auto next = m_free_by_offset.lower_bound(offset);
+        NB_CORE_ASSERT(next == m_free_by_offset.end() || next->first >= offset + size, "OffsetAllocation freed twice!");
+
+        if (next != m_free_by_offset.begin())
+        {
+            const auto previous = std::prev(next);
+            const uint64_t previous_size = previous->second->first;
+            NB_CORE_ASSERT(previous->first + previous_size <= offset, "OffsetAllocation freed twice!");
+
+            if (previous->first + previous_size == offset)
+            {
+                offset = previous->first;
+                size += previous_size;
+                eraseFreeRange(previous);
+            }
+        }
+
+        if (next != m_free_by_offset.end() && next->first == allocation.offset + allocation.size)
+        {
+            size += next->second->first;
+            eraseFreeRange(next);
+        }
+
+        insertFreeRange(offset, size);
+        m_used -= allocation.size;
+    }
+
+    void OffsetAllocator::reset()
+    {
+        m_free_by_offset.clear();
+        m_free_by_size.clear();
+        m_used = 0;
+
+        insertFreeRange(0, m_capacity);
+    }
+
+    uint64_t OffsetAllocator::getLargestFreeRange() const
+    {
+        return m_free_by_size.empty() ? 0 : m_free_by_size.rbegin()->first;
+    }
+
+    void OffsetAllocator::insertFreeRange(const uint64_t offset, const uint64_t size)
+    {
+        m_free_by_offset.emplace(offset, m_free_by_size.emplace(size, offset));
+    }
+
+    void OffsetAllocator::eraseFreeRange(const std::map<uint64_t, SizeIterator>::iterator range)
+    {
+        m_free_by_size.erase(range->second);
+        m_free_by_offset.erase(range);
+    }
+
+}
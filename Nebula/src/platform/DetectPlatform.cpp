@@ -20,18 +20,24 @@
 #include "platform/Vulkan/VulkanContext.h"
 #include "platform/Vulkan/VulkanRenderPass.h"
 #include "platform/Vulkan/VulkanFramebuffer.h"
+#include "platform/Vulkan/VulkanGeometryBuffer.h"
 #include "platform/Vulkan/VulkanImGuiBackend.h"
 #include "platform/Vulkan/VulkanRenderPassExecutor.h"
 
 #include "platform/OpenGL/OpenGLShader.h"
 #include "platform/OpenGL/OpenGLContext.h"
 #include "platform/OpenGL/OpenGLFramebuffer.h"
+#include "platform/OpenGL/OpenGLGeometryBuffer.h"
 #include "platform/OpenGL/OpenGLImGuiBackend.h"
 
+#include "platform/GLFW/GLFWWindow.h"
+#include "platform/GLFW/GLFWInput.h"
+
 #ifdef NB_PLATFORM_WINDOWS
     #include <Windows.h>
-    #include "platform/Windows/WindowsWindow.h"
-    #include "platform/Windows/WindowsInput.h"
+#elif defined(NB_PLATFORM_LINUX)
+    #include <time.h>
+    #include <errno.h>
 #endif
 
 using namespace nebula::rendering;
@@ -42,22 +48,13 @@ namespace nebula {
 
     Scope<Window> Window::create(const WindowProperties& properties, const rendering::API api)
     {
-        #ifdef NB_PLATFORM_WINDOWS
-        return createScope<WindowsWindow>(properties, api);
-        #else
-        NB_CORE_ASSERT(false, "Unknown platform!");
-        return nullptr;
-        #endif
+        //  GLFW backs windows on every supported platform
+        return createScope<GLFWWindow>(properties, api);
     }
 
     Scope<Input> Input::create(View<Window> window)
     {
-        #ifdef NB_PLATFORM_WINDOWS
-        return createScope<WindowsInput>(*window);
-        #else
-        NB_CORE_ASSERT(false, "Unknown platform!");
-        return nullptr;
-        #endif
+        return createScope<GLFWInput>(*window);
     }
 
     Scope<ImGuiBackend> ImGuiBackend::create(RenderPass& renderpass)
@@ -158,6 +155,19 @@ namespace nebula {
             return createReferenceFromPointer(framebuffer);
         }
 
+        Reference<GeometryBuffer> GeometryBuffer::create(const uint64_t size)
+        {
+            GeometryBuffer* geometry_buffer = nullptr;
+            switch (Application::get().getRenderingAPI())
+            {
+                case API::cVulkan:  geometry_buffer = new VulkanGeometryBuffer(size);  break;
+                case API::cOpenGL:  geometry_buffer = new OpenGLGeometryBuffer(size);  break;
+                default:    NB_CORE_ASSERT(false, "Unknown rendering API!");
+            }
+
+            return createReferenceFromPointer(geometry_buffer);
+        }
+
     }
 
     void system_sleep(double seconds)
@@ -175,6 +185,24 @@ namespace nebula {
 
         WaitForSingleObject(timer, INFINITE);
         CloseHandle(timer);
+        #elif defined(NB_PLATFORM_LINUX)
+        if (nanoseconds <= 0)
+            return;
+
+        timespec deadline = {};
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+
+        const long long wake_time = deadline.tv_sec * 1'000'000'000ll + deadline.tv_nsec + nanoseconds;
+        deadline.tv_sec = static_cast<time_t>(wake_time / 1'000'000'000);
+        deadline.tv_nsec = static_cast<long>(wake_time % 1'000'000'000);
+
+        //  Absolute deadline, so sleep interrupted by signal resumes without accumulating drift
+        int result;
+        do
+            result = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, nullptr);
+        while (result == EINTR);
+
+        NB_CORE_ASSERT(result == 0, "Unable to sleep on Linux monotonic clock!");
         #else
         NB_CORE_ASSERT(false, "Unknown platform!");
         #endif
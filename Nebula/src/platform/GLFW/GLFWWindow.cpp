@@ -3,7 +3,7 @@
 // Github: https://github.com/michal-swiatek
 //
 
-#include "platform/Windows/WindowsWindow.h"
+#include "platform/GLFW/GLFWWindow.h"
 
 #include <GLFW/glfw3.h>
 
@@ -24,7 +24,7 @@ namespace nebula {
         NB_CORE_ERROR("GLFW Error ({0}): {1}", error, description);
     }
 
-    WindowsWindow::WindowsWindow(const WindowProperties& properties, const rendering::API api)
+    GLFWWindow::GLFWWindow(const WindowProperties& properties, const rendering::API api)
     {
         m_window_data.title = properties.title;
         m_window_data.width = properties.width;
@@ -63,7 +63,7 @@ namespace nebula {
         setGLFWCallbacks();
     }
 
-    WindowsWindow::~WindowsWindow()
+    GLFWWindow::~GLFWWindow()
     {
         glfwDestroyWindow(m_window);
 
@@ -75,7 +75,7 @@ namespace nebula {
         }
     }
 
-    void WindowsWindow::setGLFWCallbacks() const
+    void GLFWWindow::setGLFWCallbacks() const
     {
         glfwSetWindowSizeCallback(m_window, [](GLFWwindow* window, int width, int height)
         {
@@ -138,13 +138,30 @@ namespace nebula {
         });
     }
 
-    void WindowsWindow::onUpdate()
+    void GLFWWindow::onUpdate()
     {
         glfwWaitEvents();
-        // glfwPollEvents();
     }
 
-    void WindowsWindow::setProperties(const WindowProperties& window_properties)
+    bool GLFWWindow::checkMinimized() const
+    {
+        int width, height;
+        glfwGetFramebufferSize(m_window, &width, &height);
+
+        return glfwGetWindowAttrib(m_window, GLFW_ICONIFIED) || width == 0 || height == 0;
+    }
+
+    bool GLFWWindow::checkFocused() const
+    {
+        return glfwGetWindowAttrib(m_window, GLFW_FOCUSED);
+    }
+
+    bool GLFWWindow::checkCloseRequested() const
+    {
+        return glfwWindowShouldClose(m_window);
+    }
+
+    void GLFWWindow::setProperties(const WindowProperties& window_properties)
     {
         m_window_data.title = window_properties.title;
         m_window_data.width = window_properties.width;
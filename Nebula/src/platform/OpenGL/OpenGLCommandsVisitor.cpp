@@ -7,23 +7,49 @@
 
 #include <glad/glad.h>
 
-#include "core/Application.h"
+#include "debug/Profiler.h"
 #include "debug/ImGuiLayer.h"
+#include "debug/FrameCounters.h"
+#include "platform/OpenGL/OpenGLPipeline.h"
+#include "platform/OpenGL/OpenGLGpuProfiler.h"
+#include "platform/OpenGL/OpenGLStateCache.h"
 #include "platform/OpenGL/OpenGLFramebuffer.h"
 #include "rendering/commands/RenderPassCommands.h"
+#include "rendering/commands/DrawRenderCommands.h"
 #include "rendering/commands/RenderCommandBuffer.h"
 
 namespace nebula::rendering {
 
-    void OpenGlExecuteCommandsVisitor::executeCommands(Scope<RecordedCommandBuffer>&& commands)
+    OpenGlExecuteCommandsVisitor::OpenGlExecuteCommandsVisitor(const uint32_t frame_in_flight) : m_frame_in_flight(frame_in_flight)
     {
-        for (const auto command : commands->viewCommands())
+        glCreateVertexArrays(1, &m_empty_vertex_array);
+    }
+
+    OpenGlExecuteCommandsVisitor::~OpenGlExecuteCommandsVisitor()
+    {
+        OpenGLStateCache::get().onVertexArrayDeleted(m_empty_vertex_array);
+        glDeleteVertexArrays(1, &m_empty_vertex_array);
+    }
+
+    void OpenGlExecuteCommandsVisitor::executeCommands(RecordedCommandBuffer& commands)
+    {
+        NB_PROFILE_FUNCTION();
+
+        //  Attachments could have changed if buffer was deleted and its name reused
+        m_attached_vertex_array = 0;
+        m_attached_geometry_buffer = 0;
+
+        for (const auto command : commands.viewCommands())
             command->accept(*this);
+
+        #ifdef NB_GL_STATE_VALIDATION
+        OpenGLStateCache::get().validate();
+        #endif
     }
 
     void OpenGlExecuteCommandsVisitor::submitCommands()
     {
-
+        NB_PROFILE_FUNCTION();
     }
 
     void OpenGlExecuteCommandsVisitor::visit(BeginRenderPassCommand& command)
@@ -32,10 +58,16 @@ namespace nebula::rendering {
         auto viewport = command.render_area;
         auto* framebuffer = static_cast<OpenGlFramebuffer*>(command.renderpass.getFramebufferHandle());
 
-        glViewport(viewport.x_offset, viewport.y_offset, viewport.width, viewport.height);
+        if (OpenGLGpuProfiler::checkEnabled())
+            OpenGLGpuProfiler::get().beginPass(m_frame_in_flight);
+
+        auto& state_cache = OpenGLStateCache::get();
+        state_cache.setViewport(viewport.x_offset, viewport.y_offset, viewport.width, viewport.height);
         framebuffer->bind();
 
-        glClearColor(clear_color.color.r, clear_color.color.g, clear_color.color.b, clear_color.color.a);
+        //  Scissor of previous frame would clip clear
+        state_cache.setScissorTest(false);
+        state_cache.setClearColor(clear_color.color.r, clear_color.color.g, clear_color.color.b, clear_color.color.a);
         glClear(GL_COLOR_BUFFER_BIT);
     }
 
@@ -43,19 +75,72 @@ namespace nebula::rendering {
     {
         auto* framebuffer = static_cast<OpenGlFramebuffer*>(command.renderpass.getFramebufferHandle());
         framebuffer->unbind();
+
+        if (OpenGLGpuProfiler::checkEnabled())
+            OpenGLGpuProfiler::get().endPass(m_frame_in_flight);
     }
 
-    void OpenGlExecuteCommandsVisitor::visit(DrawImGuiCommand& command)
+    void OpenGlExecuteCommandsVisitor::visit(BindGraphicsPipelineCommand& command)
     {
-        if (Application::get().closed())
-            return;
+        if (OpenGLGpuProfiler::checkEnabled())
+            OpenGLGpuProfiler::get().beginStage(m_frame_in_flight);
+
+        const auto* pipeline = static_cast<OpenGLPipeline*>(command.graphics_pipeline_handle);
+        m_primitive_mode = pipeline->primitive_mode;
+        m_vertex_array = pipeline->vertex_array;
+        m_vertex_stride = pipeline->vertex_stride;
+
+        auto& state_cache = OpenGLStateCache::get();
+        state_cache.useProgram(pipeline->program);
+        state_cache.applyStateBlock(pipeline->state_block);
+        NB_COUNT(cPipelineBinds, 1);
+
+        const auto& viewport = command.viewport;
+        const auto& scissor = command.scissor;
+        state_cache.setViewport(viewport.x_offset, viewport.y_offset, viewport.width, viewport.height);
+        state_cache.setScissor(scissor.x_offset, scissor.y_offset, scissor.width, scissor.height);
+        state_cache.setScissorTest(true);
+    }
 
-        ImGuiLayer::begin();
+    void OpenGlExecuteCommandsVisitor::visit(DrawImGuiCommand& command)
+    {
+        //  ImGui OpenGL backend restores every binding it changes, so state cache stays valid
+        ImGuiLayer::render(nullptr);
+    }
 
-        for (const auto& layer : Application::get().m_layer_stack)
-            layer->onImGuiRender();
+    void OpenGlExecuteCommandsVisitor::visit(DrawDummyIndicesCommand& command)
+    {
+        OpenGLStateCache::get().bindVertexArray(m_empty_vertex_array);
+        glDrawArrays(m_primitive_mode, 0, static_cast<GLsizei>(command.num_indices));
+        NB_COUNT(cDrawCalls, 1);
+    }
 
-        ImGuiLayer::end(nullptr);
+    void OpenGlExecuteCommandsVisitor::visit(DrawMeshCommand& command)
+    {
+        const auto geometry_buffer = static_cast<GLuint>(reinterpret_cast<uintptr_t>(command.geometry_buffer_handle));
+        if (m_vertex_array != m_attached_vertex_array || geometry_buffer != m_attached_geometry_buffer)
+        {
+            //  Empty layouts pull vertices from storage buffers, but indices still come from element buffer
+            if (m_vertex_stride > 0)
+                glVertexArrayVertexBuffer(m_vertex_array, 0, geometry_buffer, 0, m_vertex_stride);
+            OpenGLStateCache::get().setVertexArrayElementBuffer(m_vertex_array, geometry_buffer);
+
+            m_attached_vertex_array = m_vertex_array;
+            m_attached_geometry_buffer = geometry_buffer;
+        }
+
+        OpenGLStateCache::get().bindVertexArray(m_vertex_array);
+
+        const auto* indices_offset = reinterpret_cast<const void*>(static_cast<uintptr_t>(command.first_index) * sizeof(uint32_t));
+        glDrawElementsInstancedBaseVertex(
+            m_primitive_mode,
+            static_cast<GLsizei>(command.index_count),
+            GL_UNSIGNED_INT,
+            indices_offset,
+            static_cast<GLsizei>(command.instance_count),
+            command.vertex_offset
+        );
+        NB_COUNT(cDrawCalls, 1);
     }
 
 }
@@ -12,7 +12,12 @@
 #include <rendering/Framebuffer.h>
 
 #include "core/Assert.h"
+#include "core/Config.h"
+#include "debug/Profiler.h"
 #include "platform/EngineConfiguration.h"
+#include "platform/OpenGL/OpenGLGpuProfiler.h"
+#include "platform/OpenGL/OpenGLStateCache.h"
+#include "platform/OpenGL/OpenGLStreamBuffer.h"
 #include "platform/OpenGL/OpenGLConfiguration.h"
 #include "platform/OpenGL/OpenGLCommandsVisitor.h"
 
@@ -25,6 +30,7 @@ namespace nebula::rendering {
         glfwMakeContextCurrent(m_window);
         int status = gladLoadGLLoader((GLADloadproc)glfwGetProcAddress);
         NB_CORE_ASSERT(status, "Failed to initialize Glad!");
+        OpenGLStateCache::get().invalidate();
 
         setVSync(true);
 
@@ -43,16 +49,37 @@ namespace nebula::rendering {
 
         m_framebuffer_template = createReference<OpenGLFramebufferTemplate>();
         m_framebuffer = Framebuffer::create(m_framebuffer_template);
+
+        const auto& settings = Config::getEngineSettings();
+        if (settings.rendering.gpu_profiler)
+            m_gpu_profiler = createScope<OpenGLGpuProfiler>();
+
+        m_stream_buffer = createScope<OpenGLStreamBuffer>(settings.memory.stream_buffer_size, getFramesInFlightNumber());
+
+        for (uint32_t frame = 0; frame < getFramesInFlightNumber(); ++frame)
+            m_command_executors.push_back(createScope<OpenGlExecuteCommandsVisitor>(frame));
+    }
+
+    OpenGLContext::~OpenGLContext()
+    {
+        //  Query objects, buffers and vertex arrays have to be deleted with context current
+        glfwMakeContextCurrent(m_window);
+        m_gpu_profiler.reset();
+        m_stream_buffer.reset();
+        m_command_executors.clear();
+        glfwMakeContextCurrent(nullptr);
     }
 
     void OpenGLContext::bind()
     {
         glfwMakeContextCurrent(m_window);
+        OpenGLStateCache::get().invalidate();
     }
 
     void OpenGLContext::unbind()
     {
         glfwMakeContextCurrent(nullptr);
+        OpenGLStateCache::get().invalidate();
     }
 
     void OpenGLContext::reload()
@@ -65,7 +92,13 @@ namespace nebula::rendering {
 
     void OpenGLContext::presentImage()
     {
+        NB_PROFILE_FUNCTION();
+
+        //  Fence after last command of frame, its stream buffer region is free once fence is signaled
+        m_stream_buffer->endFrame();
+
         glfwSwapBuffers(m_window);
+        m_current_render_frame = (m_current_render_frame + 1) % m_frames_in_flight_number;
     }
 
     Reference<Framebuffer> OpenGLContext::getNextImage()
@@ -73,14 +106,18 @@ namespace nebula::rendering {
         return m_framebuffer;
     }
 
-    Scope<ExecuteCommandVisitor> OpenGLContext::getCommandExecutor()
+    ExecuteCommandVisitor& OpenGLContext::getCommandExecutor()
     {
-        return createScope<OpenGlExecuteCommandsVisitor>();
+        return *m_command_executors[getCurrentRenderFrame()];
     }
 
-    void OpenGLContext::waitForFrameResources(uint32_t frame)
+    void OpenGLContext::waitForFrameResources(const uint32_t frame)
     {
+        //  Same frames in flight model as Vulkan, CPU runs ahead until it needs region still read by GPU
+        m_stream_buffer->beginFrame(frame);
 
+        if (m_gpu_profiler)
+            m_gpu_profiler->onFrameCompleted(frame);
     }
 
     ApiInfo OpenGLContext::getApiInfo() const
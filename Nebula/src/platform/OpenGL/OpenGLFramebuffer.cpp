@@ -5,6 +5,8 @@
 
 #include "platform/OpenGL/OpenGLFramebuffer.h"
 
+#include "platform/OpenGL/OpenGLStateCache.h"
+
 namespace nebula::rendering {
 
     OpenGlFramebuffer::OpenGlFramebuffer(const Reference<FramebufferTemplate>& framebuffer_template) :
@@ -20,12 +22,12 @@ namespace nebula::rendering {
 
     void OpenGlFramebuffer::bind()
     {
-        glBindFramebuffer(GL_FRAMEBUFFER, m_id);
+        OpenGLStateCache::get().bindFramebuffer(GL_FRAMEBUFFER, m_id);
     }
 
     void OpenGlFramebuffer::unbind()
     {
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        OpenGLStateCache::get().bindFramebuffer(GL_FRAMEBUFFER, 0);
     }
 
     bool OpenGlFramebuffer::attached() const
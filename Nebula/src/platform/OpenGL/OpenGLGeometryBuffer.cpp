@@ -0,0 +1,30 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "platform/OpenGL/OpenGLGeometryBuffer.h"
+
+#include "platform/OpenGL/OpenGLStateCache.h"
+
+namespace nebula::rendering {
+
+    OpenGLGeometryBuffer::OpenGLGeometryBuffer(const uint64_t size) : GeometryBuffer(size)
+    {
+        glCreateBuffers(1, &m_buffer);
+        glNamedBufferStorage(m_buffer, static_cast<GLsizeiptr>(size), nullptr, GL_DYNAMIC_STORAGE_BIT);
+    }
+
+    OpenGLGeometryBuffer::~OpenGLGeometryBuffer()
+    {
+        OpenGLStateCache::get().onBufferDeleted(m_buffer);
+        glDeleteBuffers(1, &m_buffer);
+    }
+
+    uint64_t OpenGLGeometryBuffer::writeData(const uint64_t offset, const void* data, const uint64_t size)
+    {
+        glNamedBufferSubData(m_buffer, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data);
+        return 0;
+    }
+
+}
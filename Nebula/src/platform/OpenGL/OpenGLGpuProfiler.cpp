@@ -0,0 +1,85 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "platform/OpenGL/OpenGLGpuProfiler.h"
+
+#include <glad/glad.h>
+
+#include "rendering/RenderContext.h"
+
+namespace nebula::rendering {
+
+    OpenGLGpuProfiler::OpenGLGpuProfiler() :
+            GpuProfiler(RenderContext::get().getFramesInFlightNumber()),
+            m_query_objects(RenderContext::get().getFramesInFlightNumber())
+    {
+        for (auto& query_objects : m_query_objects)
+            glGenQueries(cMaxQueriesPerFrame, query_objects.data());
+    }
+
+    OpenGLGpuProfiler::~OpenGLGpuProfiler()
+    {
+        for (auto& query_objects : m_query_objects)
+            glDeleteQueries(cMaxQueriesPerFrame, query_objects.data());
+    }
+
+    void OpenGLGpuProfiler::beginPass(const uint32_t frame_in_flight)
+    {
+        writeTimestamp(frame_in_flight, beginZone(frame_in_flight, false));
+    }
+
+    void OpenGLGpuProfiler::endPass(const uint32_t frame_in_flight)
+    {
+        endStage(frame_in_flight);
+        writeTimestamp(frame_in_flight, endZone(frame_in_flight, false));
+    }
+
+    void OpenGLGpuProfiler::beginStage(const uint32_t frame_in_flight)
+    {
+        endStage(frame_in_flight);
+        writeTimestamp(frame_in_flight, beginZone(frame_in_flight, true));
+    }
+
+    void OpenGLGpuProfiler::endStage(const uint32_t frame_in_flight)
+    {
+        writeTimestamp(frame_in_flight, endZone(frame_in_flight, true));
+    }
+
+    void OpenGLGpuProfiler::onFrameCompleted(const uint32_t frame_in_flight)
+    {
+        const uint32_t used_queries = viewFrameQueries(frame_in_flight).used_queries;
+        if (used_queries == 0)
+            return;
+
+        const auto& query_objects = m_query_objects[frame_in_flight];
+
+        //  Never stall the pipeline, late results are dropped instead
+        bool available = true;
+        for (uint32_t query = 0; query < used_queries && available; ++query)
+        {
+            GLint query_available = GL_FALSE;
+            glGetQueryObjectiv(query_objects[query], GL_QUERY_RESULT_AVAILABLE, &query_available);
+            available = query_available == GL_TRUE;
+        }
+
+        if (available)
+        {
+            for (uint32_t query = 0; query < used_queries; ++query)
+                glGetQueryObjectui64v(query_objects[query], GL_QUERY_RESULT, &m_timestamps[query]);
+
+            //  GL_TIMESTAMP is already in nanoseconds
+            resolveFrame(frame_in_flight, m_timestamps.data(), 1.0);
+        }
+
+        resetFrame(frame_in_flight);
+    }
+
+    void OpenGLGpuProfiler::writeTimestamp(const uint32_t frame_in_flight, const std::optional<uint32_t> query) const
+    {
+        if (query)
+            glQueryCounter(m_query_objects[frame_in_flight][*query], GL_TIMESTAMP);
+    }
+
+}
@@ -33,15 +33,14 @@ namespace nebula {
         ImGui_ImplOpenGL3_Shutdown();
     }
 
-    void OpenGlImGuiBackend::begin()
+    void OpenGlImGuiBackend::newFrame()
     {
         ImGui_ImplOpenGL3_NewFrame();
     }
 
-    void OpenGlImGuiBackend::end(void* command_buffer_handle)
+    void OpenGlImGuiBackend::renderDrawData(ImDrawData& draw_data, void* command_buffer_handle)
     {
-        ImGui::Render();
-        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        ImGui_ImplOpenGL3_RenderDrawData(&draw_data);
     }
 
     void OpenGlImGuiBackend::init()
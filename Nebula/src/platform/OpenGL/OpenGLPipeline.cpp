@@ -0,0 +1,381 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "platform/OpenGL/OpenGLPipeline.h"
+
+#include <format>
+#include <cstring>
+
+#include <boost/functional/hash.hpp>
+
+#include "core/Logging.h"
+#include "utility/Filesystem.h"
+#include "platform/EngineConfiguration.h"
+#include "platform/OpenGL/OpenGLConfiguration.h"
+
+namespace nebula::rendering {
+
+    static constexpr uint32_t cProgramBinaryMagic = 0x4C47424E;    //  "NBGL"
+
+    struct ProgramBinaryHeader
+    {
+        uint32_t magic = cProgramBinaryMagic;
+        uint32_t binary_format = 0;
+    };
+
+    GLenum getOpenGLPrimitiveMode(const GeometryTopology topology)
+    {
+        switch (topology)
+        {
+            case GeometryTopology::cPointList:      return GL_POINTS;
+            case GeometryTopology::cLineList:       return GL_LINES;
+            case GeometryTopology::cLineStrip:      return GL_LINE_STRIP;
+            case GeometryTopology::cTriangleList:   return GL_TRIANGLES;
+            case GeometryTopology::cTriangleStrip:  return GL_TRIANGLE_STRIP;
+            case GeometryTopology::cTriangleFan:    return GL_TRIANGLE_FAN;
+        }
+
+        return GL_NONE;
+    }
+
+    GLenum getOpenGLPolygonMode(const PolygonMode polygon_mode)
+    {
+        switch (polygon_mode)
+        {
+            case PolygonMode::cFill:    return GL_FILL;
+            case PolygonMode::cLine:    return GL_LINE;
+            case PolygonMode::cPoint:   return GL_POINT;
+        }
+
+        return GL_NONE;
+    }
+
+    GLenum getOpenGLCullFace(const CullMode cull_mode)
+    {
+        switch (cull_mode)
+        {
+            case CullMode::cNone:           return GL_BACK;     //  Culling is disabled, keep default
+            case CullMode::cBack:           return GL_BACK;
+            case CullMode::cFront:          return GL_FRONT;
+            case CullMode::cBackAndFront:   return GL_FRONT_AND_BACK;
+        }
+
+        return GL_NONE;
+    }
+
+    GLenum getOpenGLBlendFactor(const BlendFactor blend_factor)
+    {
+        switch (blend_factor)
+        {
+            case BlendFactor::cZero:                    return GL_ZERO;
+            case BlendFactor::cOne:                     return GL_ONE;
+            case BlendFactor::cSrcColor:                return GL_SRC_COLOR;
+            case BlendFactor::cOneMinusSrcColor:        return GL_ONE_MINUS_SRC_COLOR;
+            case BlendFactor::cDstColor:                return GL_DST_COLOR;
+            case BlendFactor::cOneMinusDstColor:        return GL_ONE_MINUS_DST_COLOR;
+            case BlendFactor::cSrcAlpha:                return GL_SRC_ALPHA;
+            case BlendFactor::cOneMinusSrcAlpha:        return GL_ONE_MINUS_SRC_ALPHA;
+            case BlendFactor::cDstAlpha:                return GL_DST_ALPHA;
+            case BlendFactor::cOneMinusDstAlpha:        return GL_ONE_MINUS_DST_ALPHA;
+            case BlendFactor::cConstantColor:           return GL_CONSTANT_COLOR;
+            case BlendFactor::cOneMinusConstantColor:   return GL_ONE_MINUS_CONSTANT_COLOR;
+            case BlendFactor::cConstantAlpha:           return GL_CONSTANT_ALPHA;
+            case BlendFactor::cOneMinusConstantAlpha:   return GL_ONE_MINUS_CONSTANT_ALPHA;
+            case BlendFactor::cSrcAlphaSaturate:        return GL_SRC_ALPHA_SATURATE;
+        }
+
+        return GL_NONE;
+    }
+
+    GLenum getOpenGLBlendEquation(const BlendOperation blend_operation)
+    {
+        switch (blend_operation)
+        {
+            case BlendOperation::cAdd:              return GL_FUNC_ADD;
+            case BlendOperation::cSubtract:         return GL_FUNC_SUBTRACT;
+            case BlendOperation::cReverseSubtract:  return GL_FUNC_REVERSE_SUBTRACT;
+            case BlendOperation::cMin:              return GL_MIN;
+            case BlendOperation::cMax:              return GL_MAX;
+        }
+
+        return GL_NONE;
+    }
+
+    struct OpenGLVertexFormat
+    {
+        GLint components;
+        GLenum type;
+        GLboolean normalized;
+    };
+
+    OpenGLVertexFormat getOpenGLVertexFormat(const VertexFormat format)
+    {
+        switch (format)
+        {
+            case VertexFormat::cFloat:      return {1, GL_FLOAT, GL_FALSE};
+            case VertexFormat::cFloat2:     return {2, GL_FLOAT, GL_FALSE};
+            case VertexFormat::cFloat3:     return {3, GL_FLOAT, GL_FALSE};
+            case VertexFormat::cFloat4:     return {4, GL_FLOAT, GL_FALSE};
+            case VertexFormat::cHalf2:      return {2, GL_HALF_FLOAT, GL_FALSE};
+            case VertexFormat::cHalf4:      return {4, GL_HALF_FLOAT, GL_FALSE};
+            case VertexFormat::cSnorm16x2:  return {2, GL_SHORT, GL_TRUE};
+            case VertexFormat::cSnorm16x4:  return {4, GL_SHORT, GL_TRUE};
+            case VertexFormat::cUnorm16x2:  return {2, GL_UNSIGNED_SHORT, GL_TRUE};
+            case VertexFormat::cSnorm8x4:   return {4, GL_BYTE, GL_TRUE};
+            case VertexFormat::cUnorm8x4:   return {4, GL_UNSIGNED_BYTE, GL_TRUE};
+            case VertexFormat::cUint32:     return {1, GL_UNSIGNED_INT, GL_FALSE};
+        }
+
+        return {0, GL_NONE, GL_FALSE};
+    }
+
+    OpenGLPipeline createOpenGLPipeline(const GraphicsPipelineState& graphics_pipeline_state)
+    {
+        const auto& input_assembly = graphics_pipeline_state.input_assembly;
+        const auto& rasterization = graphics_pipeline_state.rasterization;
+        const auto& depth_stencil = graphics_pipeline_state.depth_stencil;
+        const auto& multisampling = graphics_pipeline_state.multisampling;
+        const auto& color_blending = graphics_pipeline_state.color_blending;
+
+        OpenGLPipeline pipeline;
+        pipeline.program = static_cast<GLuint>(reinterpret_cast<uintptr_t>(graphics_pipeline_state.shader.get()->getStageHandle(ShaderStage::cShaderProgram)));
+        pipeline.primitive_mode = getOpenGLPrimitiveMode(input_assembly.topology);
+
+        auto& state_block = pipeline.state_block;
+        state_block.primitive_restart = input_assembly.strip_restart;
+
+        //  Rasterization
+        state_block.rasterizer_discard = !rasterization.enabled;
+        state_block.cull = rasterization.cull_mode != CullMode::cNone;
+        state_block.cull_face = getOpenGLCullFace(rasterization.cull_mode);
+        state_block.front_face = rasterization.face_clockwise ? GL_CW : GL_CCW;
+        state_block.polygon_mode = getOpenGLPolygonMode(rasterization.polygon_mode);
+        state_block.line_width = rasterization.line_width;
+
+        //  DepthStencil
+        state_block.depth_test = depth_stencil.enabled;
+        state_block.depth_clamp = depth_stencil.depth_clamp;
+        state_block.polygon_offset = depth_stencil.depth_bias_enabled;
+        state_block.polygon_offset_factor = depth_stencil.depth_bias_slope;
+        state_block.polygon_offset_units = depth_stencil.depth_bias_constant;
+        state_block.polygon_offset_clamp = depth_stencil.depth_bias_clamp;
+
+        //  Multisampling
+        state_block.sample_shading = multisampling.enabled;
+        state_block.min_sample_shading = multisampling.min_sample_shading;
+        state_block.alpha_to_coverage = multisampling.alpha_to_coverage_enable;
+        state_block.alpha_to_one = multisampling.alpha_to_one_enable;
+
+        //  ColorBlend
+        state_block.blend = color_blending.enabled;
+        state_block.blend_src_rgb = getOpenGLBlendFactor(color_blending.src_color_factor);
+        state_block.blend_dst_rgb = getOpenGLBlendFactor(color_blending.dst_color_factor);
+        state_block.blend_src_alpha = getOpenGLBlendFactor(color_blending.src_alpha_factor);
+        state_block.blend_dst_alpha = getOpenGLBlendFactor(color_blending.dst_alpha_factor);
+        state_block.blend_equation_rgb = getOpenGLBlendEquation(color_blending.color_operation);
+        state_block.blend_equation_alpha = getOpenGLBlendEquation(color_blending.alpha_operation);
+
+        return pipeline;
+    }
+
+    GLuint createOpenGLVertexArray(const VertexLayout& vertex_layout)
+    {
+        GLuint vertex_array = 0;
+        glCreateVertexArrays(1, &vertex_array);
+
+        for (const auto& [location, binding, format, offset] : vertex_layout.attributes)
+        {
+            const auto [components, type, normalized] = getOpenGLVertexFormat(format);
+
+            glEnableVertexArrayAttrib(vertex_array, location);
+            if (isIntegerVertexFormat(format))
+                glVertexArrayAttribIFormat(vertex_array, location, components, type, offset);
+            else
+                glVertexArrayAttribFormat(vertex_array, location, components, type, normalized, offset);
+            glVertexArrayAttribBinding(vertex_array, location, binding);
+        }
+
+        for (const auto& [binding, stride, input_rate] : vertex_layout.bindings)
+            glVertexArrayBindingDivisor(vertex_array, binding, input_rate == VertexInputRate::cInstance ? 1 : 0);
+
+        return vertex_array;
+    }
+
+    uint64_t hashShaderSource(const std::vector<char>& source, const uint64_t seed)
+    {
+        //  FNV-1a
+        uint64_t hash = 0xcbf29ce484222325ull ^ seed;
+        for (const char byte : source)
+        {
+            hash ^= static_cast<uint8_t>(byte);
+            hash *= 0x100000001b3ull;
+        }
+
+        return hash;
+    }
+
+    ////////////////////////////////////////////////////////////////////
+    //////  OpenGLProgramCache  ////////////////////////////////////////
+    ////////////////////////////////////////////////////////////////////
+
+    OpenGLProgramCache::OpenGLProgramCache(const std::string& cache_root) :
+            m_cache_directory(filesystem::createPath(cache_root, OPENGL_PROGRAM_CACHE_DIRECTORY).string())
+    {
+        GLint binary_formats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binary_formats);
+        m_enabled = binary_formats > 0;
+
+        if (!m_enabled)
+        {
+            if constexpr (NEBULA_INITIALIZATION_VERBOSITY >= NEBULA_INITIALIZATION_VERBOSITY_LOW)
+                NB_CORE_WARN("OpenGL driver does not support program binaries, shaders will be compiled on every launch");
+            return;
+        }
+
+        const std::string driver = std::format(
+            "{}|{}|{}",
+            reinterpret_cast<const char*>(glGetString(GL_VENDOR)),
+            reinterpret_cast<const char*>(glGetString(GL_RENDERER)),
+            reinterpret_cast<const char*>(glGetString(GL_VERSION))
+        );
+        m_driver_hash = hashShaderSource(std::vector(driver.begin(), driver.end()));
+    }
+
+    GLuint OpenGLProgramCache::loadProgram(const uint64_t source_hash) const
+    {
+        const auto path = getProgramPath(source_hash);
+        if (!m_enabled || !filesystem::checkFile(path))
+            return 0;
+
+        const auto data = filesystem::readBinaryFile(path);
+        if (data.size() <= sizeof(ProgramBinaryHeader))
+            return 0;
+
+        ProgramBinaryHeader header;
+        std::memcpy(&header, data.data(), sizeof(header));
+        if (header.magic != cProgramBinaryMagic)
+            return 0;
+
+        const GLuint program = glCreateProgram();
+        glProgramBinary(program, header.binary_format, data.data() + sizeof(header), static_cast<GLsizei>(data.size() - sizeof(header)));
+
+        //  Driver updates may reject binary even with same version string, caller compiles from source then
+        GLint link_status = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &link_status);
+        if (link_status != GL_TRUE)
+        {
+            glDeleteProgram(program);
+            return 0;
+        }
+
+        return program;
+    }
+
+    void OpenGLProgramCache::storeProgram(const uint64_t source_hash, const GLuint program) const
+    {
+        if (!m_enabled)
+            return;
+
+        GLint binary_length = 0;
+        glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binary_length);
+        if (binary_length <= 0)
+            return;
+
+        ProgramBinaryHeader header;
+        std::vector<std::byte> data(sizeof(header) + binary_length);
+        glGetProgramBinary(program, binary_length, nullptr, &header.binary_format, data.data() + sizeof(header));
+        std::memcpy(data.data(), &header, sizeof(header));
+
+        //  Binary cache is only an optimization, shader is usable even if it can't be written
+        try
+        {
+            filesystem::saveBinaryFile(getProgramPath(source_hash), data);
+        }
+        catch (const filesystem::FilesystemError& error)
+        {
+            NB_CORE_WARN("Failed to store OpenGL program binary: {}", error.what());
+        }
+    }
+
+    std::string OpenGLProgramCache::getProgramPath(const uint64_t source_hash) const
+    {
+        return filesystem::createPath(m_cache_directory, std::format("{:016x}_{:016x}.bin", source_hash, m_driver_hash)).string();
+    }
+
+    ////////////////////////////////////////////////////////////////////
+    //////  OpenGLPipelineCache  ///////////////////////////////////////
+    ////////////////////////////////////////////////////////////////////
+
+    OpenGLPipelineCache::~OpenGLPipelineCache()
+    {
+        auto& state_cache = OpenGLStateCache::get();
+        for (const auto& [_, vertex_array] : m_vertex_arrays)
+        {
+            state_cache.onVertexArrayDeleted(vertex_array);
+            glDeleteVertexArrays(1, &vertex_array);
+        }
+    }
+
+    void OpenGLPipelineCache::destroyPipeline(void* renderpass, const uint32_t stage)
+    {
+        //  Pipeline itself stays cached, so recreated RenderPass reuses it
+        m_handle_map.erase({renderpass, stage});
+    }
+
+    OpenGLPipeline* OpenGLPipelineCache::getPipeline(void* renderpass, const uint32_t stage) const
+    {
+        return m_handle_map.at({renderpass, stage});
+    }
+
+    OpenGLPipeline* OpenGLPipelineCache::addPipeline(void* renderpass, const uint32_t stage, const GraphicsPipelineState& graphics_pipeline_state)
+    {
+        auto it = m_pipelines.find(graphics_pipeline_state);
+        if (it == m_pipelines.end())
+        {
+            auto pipeline = createScope<OpenGLPipeline>(createOpenGLPipeline(graphics_pipeline_state));
+
+            //  Pipelines differing only in shader or render state share vertex array
+            const auto& vertex_layout = graphics_pipeline_state.vertex_layout;
+            auto vertex_array = m_vertex_arrays.find(vertex_layout);
+            if (vertex_array == m_vertex_arrays.end())
+                vertex_array = m_vertex_arrays.emplace(vertex_layout, createOpenGLVertexArray(vertex_layout)).first;
+
+            pipeline->vertex_array = vertex_array->second;
+            pipeline->vertex_stride = static_cast<GLsizei>(vertex_layout.getStride(0));
+
+            it = m_pipelines.emplace(graphics_pipeline_state, std::move(pipeline)).first;
+        }
+
+        OpenGLPipeline* pipeline = it->second.get();
+        m_handle_map[{renderpass, stage}] = pipeline;
+
+        return pipeline;
+    }
+
+    void OpenGLPipelineCache::onShaderDestroyed(const Shader& shader)
+    {
+        for (auto it = m_pipelines.begin(); it != m_pipelines.end();)
+        {
+            if (it->first.shader.get() != &shader)
+            {
+                ++it;
+                continue;
+            }
+
+            std::erase_if(m_handle_map, [pipeline = it->second.get()](const auto& entry){ return entry.second == pipeline; });
+            it = m_pipelines.erase(it);
+        }
+    }
+
+    std::size_t OpenGLPipelineCache::RenderStageIDHash::operator() (const RenderStageID& id) const
+    {
+        std::size_t seed = 0;
+        boost::hash_combine(seed, id.renderpass);
+        boost::hash_combine(seed, id.stage);
+
+        return seed;
+    }
+
+}
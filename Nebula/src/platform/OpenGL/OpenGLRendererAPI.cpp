@@ -8,7 +8,10 @@
 #include <glad/glad.h>
 
 #include "core/Core.h"
+#include "core/Config.h"
 #include "core/Logging.h"
+#include "core/Application.h"
+#include "utility/Filesystem.h"
 
 namespace nebula::rendering {
 
@@ -41,6 +44,10 @@ namespace nebula::rendering {
         glDebugMessageCallback(OpenGLMessageCallback, nullptr);
         glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, NULL, GL_FALSE);
         #endif
+
+        auto program_cache_root = Application::getResourcesPath(true) / Config::getEngineSettings().rendering.cache_path;
+        m_program_cache = createScope<OpenGLProgramCache>(program_cache_root.make_preferred().string());
+        m_pipeline_cache = createScope<OpenGLPipelineCache>();
     }
 
     OpenGlRendererApi::~OpenGlRendererApi()
@@ -50,17 +57,21 @@ namespace nebula::rendering {
 
     void OpenGlRendererApi::compilePipelines(RenderPass& renderpass)
     {
+        const auto& render_stages = renderpass.viewRenderPassTemplate()->viewRenderStages();
 
+        //  Programs are linked by OpenGLShader, pipeline only pairs program with baked state block
+        for (uint32_t i = 0; i < render_stages.size(); ++i)
+            m_pipeline_cache->addPipeline(renderpass.getRenderPassHandle(), i, render_stages[i].graphics_pipeline_state);
     }
 
-    void OpenGlRendererApi::destroyPipeline(RenderPass& renderpass, uint32_t stage)
+    void OpenGlRendererApi::destroyPipeline(RenderPass& renderpass, const uint32_t stage)
     {
-
+        m_pipeline_cache->destroyPipeline(renderpass.getRenderPassHandle(), stage);
     }
 
-    void* OpenGlRendererApi::getPipelineHandle(RenderPass& renderpass, uint32_t stage)
+    void* OpenGlRendererApi::getPipelineHandle(RenderPass& renderpass, const uint32_t stage)
     {
-        return nullptr;
+        return m_pipeline_cache->getPipeline(renderpass.getRenderPassHandle(), stage);
     }
 
 }
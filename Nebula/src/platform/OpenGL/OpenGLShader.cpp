@@ -5,40 +5,180 @@
 
 #include "platform/OpenGL/OpenGLShader.h"
 
+#include <format>
+#include <cstring>
+
+#include <spirv_glsl.hpp>
+
+#include "core/Assert.h"
+#include "platform/OpenGL/OpenGLPipeline.h"
+#include "platform/OpenGL/OpenGLStateCache.h"
+#include "platform/OpenGL/OpenGLRendererAPI.h"
+#include "platform/OpenGL/OpenGLConfiguration.h"
+
 namespace nebula::rendering {
 
+    static GLenum getOpenGLShaderType(const ShaderStage stage)
+    {
+        switch (stage)
+        {
+            case ShaderStage::cVertex:      return GL_VERTEX_SHADER;
+            case ShaderStage::cFragment:    return GL_FRAGMENT_SHADER;
+            default:                        return GL_NONE;
+        }
+    }
+
     OpenGLShader::OpenGLShader(
         const std::string& name,
         const ShaderTemplate& shader_template
     ) :
             Shader(name, shader_template)
     {
+        const auto& program_cache = static_cast<OpenGlRendererApi&>(RendererApi::get()).getProgramCache();
 
+        if (std::holds_alternative<VertexShader>(shader_template))
+            buildVertexShader(std::get<VertexShader>(shader_template), program_cache);
     }
 
     OpenGLShader::~OpenGLShader()
     {
+        static_cast<OpenGlRendererApi&>(RendererApi::get()).getPipelineCache().onShaderDestroyed(*this);
 
+        //  Program in use is only flagged for deletion, state cache stays valid
+        if (m_program != 0)
+            glDeleteProgram(m_program);
     }
 
     void OpenGLShader::bind()
     {
-
+        OpenGLStateCache::get().useProgram(m_program);
     }
 
     void OpenGLShader::unbind()
     {
+        OpenGLStateCache::get().useProgram(0);
+    }
+
+    void* OpenGLShader::getStageHandle(const ShaderStage stage)
+    {
+        if (stage != ShaderStage::cShaderProgram)
+            throw std::runtime_error(std::format("OpenGL shader \'{}\' is linked into single program, {} stage has no handle!", getName(), shaderStageToString(stage)));
 
+        return reinterpret_cast<void*>(static_cast<uintptr_t>(m_program));
     }
 
-    void* OpenGLShader::getStageHandle(ShaderStage stage)
+    void OpenGLShader::buildVertexShader(const VertexShader& shader_template, const OpenGLProgramCache& program_cache)
     {
+        NB_CORE_ASSERT(!shader_template.vertex_stage.empty() && !shader_template.fragment_stage.empty(), "Incomplete OpenGL VertexShader template!");
 
+        const auto vertex_code = loadFile(shader_template.vertex_stage);
+        const auto fragment_code = loadFile(shader_template.fragment_stage);
+
+        //  Cached binary skips cross compilation and GLSL compilation entirely
+        const uint64_t source_hash = hashShaderSource(fragment_code, hashShaderSource(vertex_code));
+        m_program = program_cache.loadProgram(source_hash);
+        if (m_program != 0)
+            return;
+
+        const auto vertex_source = translateStage(shader_template.vertex_stage, vertex_code);
+        const auto fragment_source = translateStage(shader_template.fragment_stage, fragment_code);
+
+        //  Stages are compiled one at a time, so vertex stage isn't leaked when fragment stage fails
+        const GLuint vertex_stage = compileStage(ShaderStage::cVertex, vertex_source);
+        GLuint fragment_stage = 0;
+        try
+        {
+            fragment_stage = compileStage(ShaderStage::cFragment, fragment_source);
+        }
+        catch (...)
+        {
+            glDeleteShader(vertex_stage);
+            throw;
+        }
+
+        linkProgram({vertex_stage, fragment_stage});
+        program_cache.storeProgram(source_hash, m_program);
     }
 
-    std::vector<char> OpenGLShader::loadBinaryFile(const std::string& path)
+    std::string OpenGLShader::translateStage(const std::string& path, const std::vector<char>& code) const
     {
-        throw std::runtime_error("OpenGL shader does not support binary files!");
+        if (!checkIfFileIsBinary(path))
+            return {code.begin(), code.end()};
+
+        NB_CORE_ASSERT(code.size() % sizeof(uint32_t) == 0, std::format("Invalid SPIR-V file {}!", path));
+
+        std::vector<uint32_t> spirv(code.size() / sizeof(uint32_t));
+        std::memcpy(spirv.data(), code.data(), code.size());
+
+        spirv_cross::CompilerGLSL compiler(std::move(spirv));
+
+        auto options = compiler.get_common_options();
+        options.version = GLSL_VERSION;
+        options.es = false;
+        options.vulkan_semantics = false;
+        compiler.set_common_options(options);
+
+        return compiler.compile();
+    }
+
+    GLuint OpenGLShader::compileStage(const ShaderStage stage, const std::string& source) const
+    {
+        const GLuint shader = glCreateShader(getOpenGLShaderType(stage));
+
+        const char* source_data = source.c_str();
+        const auto source_length = static_cast<GLint>(source.size());
+        glShaderSource(shader, 1, &source_data, &source_length);
+        glCompileShader(shader);
+
+        GLint compile_status = GL_FALSE;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &compile_status);
+        if (compile_status != GL_TRUE)
+        {
+            GLint log_length = 0;
+            glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &log_length);
+
+            std::string log(log_length, '\0');
+            glGetShaderInfoLog(shader, log_length, nullptr, log.data());
+            glDeleteShader(shader);
+
+            throw std::runtime_error(std::format("Failed to compile {} stage of OpenGL shader \'{}\': {}", shaderStageToString(stage), getName(), log));
+        }
+
+        return shader;
+    }
+
+    void OpenGLShader::linkProgram(const std::vector<GLuint>& stages)
+    {
+        m_program = glCreateProgram();
+        glProgramParameteri(m_program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
+        for (const GLuint stage : stages)
+            glAttachShader(m_program, stage);
+
+        glLinkProgram(m_program);
+
+        //  Linked program keeps compiled code, stage objects are no longer needed
+        for (const GLuint stage : stages)
+        {
+            glDetachShader(m_program, stage);
+            glDeleteShader(stage);
+        }
+
+        GLint link_status = GL_FALSE;
+        glGetProgramiv(m_program, GL_LINK_STATUS, &link_status);
+        if (link_status != GL_TRUE)
+        {
+            GLint log_length = 0;
+            glGetProgramiv(m_program, GL_INFO_LOG_LENGTH, &log_length);
+
+            std::string log(log_length, '\0');
+            glGetProgramInfoLog(m_program, log_length, nullptr, log.data());
+
+            glDeleteProgram(m_program);
+            m_program = 0;
+
+            throw std::runtime_error(std::format("Failed to link OpenGL shader \'{}\': {}", getName(), log));
+        }
     }
 
 }
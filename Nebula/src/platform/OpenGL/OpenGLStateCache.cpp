@@ -0,0 +1,436 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "platform/OpenGL/OpenGLStateCache.h"
+
+#include <format>
+
+#include "core/Assert.h"
+#include "debug/FrameCounters.h"
+
+namespace nebula::rendering {
+
+    static GLint getInteger(const GLenum query)
+    {
+        GLint value = 0;
+        glGetIntegerv(query, &value);
+        return value;
+    }
+
+    static void validateName(const char* name, const GLuint cached, const GLenum query)
+    {
+        const auto actual = static_cast<GLuint>(getInteger(query));
+        NB_CORE_ASSERT(cached == actual, std::format("OpenGL state cache out of sync, {} is {} but cache holds {}!", name, actual, cached));
+    }
+
+    OpenGLStateCache::OpenGLStateCache()
+    {
+        invalidate();
+    }
+
+    OpenGLStateCache& OpenGLStateCache::get()
+    {
+        //  GL context is current on at most one thread, so is its shadow state
+        static thread_local OpenGLStateCache s_state_cache;
+        return s_state_cache;
+    }
+
+    void OpenGLStateCache::invalidate()
+    {
+        m_draw_framebuffer = cUnknown;
+        m_read_framebuffer = cUnknown;
+        m_viewport.known = false;
+        m_scissor.known = false;
+        m_scissor_test = -1;
+        m_clear_color_known = false;
+        m_state_block_known = false;
+
+        m_program = cUnknown;
+        m_vertex_array = cUnknown;
+        m_buffers.fill(cUnknown);
+        m_uniform_buffers.fill(IndexedBinding{});
+        m_storage_buffers.fill(IndexedBinding{});
+    }
+
+    void OpenGLStateCache::validate() const
+    {
+        if (m_draw_framebuffer != cUnknown)
+            validateName("draw framebuffer", m_draw_framebuffer, GL_DRAW_FRAMEBUFFER_BINDING);
+        if (m_read_framebuffer != cUnknown)
+            validateName("read framebuffer", m_read_framebuffer, GL_READ_FRAMEBUFFER_BINDING);
+
+        if (m_viewport.known)
+        {
+            std::array<GLint, 4> viewport{};
+            glGetIntegerv(GL_VIEWPORT, viewport.data());
+            NB_CORE_ASSERT(viewport == m_viewport.values, "OpenGL state cache out of sync, viewport differs!");
+        }
+        if (m_scissor.known)
+        {
+            std::array<GLint, 4> scissor{};
+            glGetIntegerv(GL_SCISSOR_BOX, scissor.data());
+            NB_CORE_ASSERT(scissor == m_scissor.values, "OpenGL state cache out of sync, scissor box differs!");
+        }
+        if (m_scissor_test >= 0)
+            NB_CORE_ASSERT(glIsEnabled(GL_SCISSOR_TEST) == m_scissor_test, "OpenGL state cache out of sync, scissor test differs!");
+
+        if (m_clear_color_known)
+        {
+            std::array<float, 4> clear_color{};
+            glGetFloatv(GL_COLOR_CLEAR_VALUE, clear_color.data());
+            NB_CORE_ASSERT(clear_color == m_clear_color, "OpenGL state cache out of sync, clear color differs!");
+        }
+
+        if (m_state_block_known)
+        {
+            const auto validate_capability = [](const char* name, const GLenum capability, const bool cached)
+            {
+                NB_CORE_ASSERT(static_cast<bool>(glIsEnabled(capability)) == cached, std::format("OpenGL state cache out of sync, {} differs!", name));
+            };
+
+            validate_capability("primitive restart", GL_PRIMITIVE_RESTART_FIXED_INDEX, m_state_block.primitive_restart);
+            validate_capability("rasterizer discard", GL_RASTERIZER_DISCARD, m_state_block.rasterizer_discard);
+            validate_capability("face culling", GL_CULL_FACE, m_state_block.cull);
+            validate_capability("depth test", GL_DEPTH_TEST, m_state_block.depth_test);
+            validate_capability("depth clamp", GL_DEPTH_CLAMP, m_state_block.depth_clamp);
+            validate_capability("polygon offset", GL_POLYGON_OFFSET_FILL, m_state_block.polygon_offset);
+            validate_capability("sample shading", GL_SAMPLE_SHADING, m_state_block.sample_shading);
+            validate_capability("alpha to coverage", GL_SAMPLE_ALPHA_TO_COVERAGE, m_state_block.alpha_to_coverage);
+            validate_capability("alpha to one", GL_SAMPLE_ALPHA_TO_ONE, m_state_block.alpha_to_one);
+            validate_capability("blending", GL_BLEND, m_state_block.blend);
+
+            validateName("cull face", m_state_block.cull_face, GL_CULL_FACE_MODE);
+            validateName("front face", m_state_block.front_face, GL_FRONT_FACE);
+            validateName("blend source rgb", m_state_block.blend_src_rgb, GL_BLEND_SRC_RGB);
+            validateName("blend destination rgb", m_state_block.blend_dst_rgb, GL_BLEND_DST_RGB);
+            validateName("blend source alpha", m_state_block.blend_src_alpha, GL_BLEND_SRC_ALPHA);
+            validateName("blend destination alpha", m_state_block.blend_dst_alpha, GL_BLEND_DST_ALPHA);
+            validateName("blend equation rgb", m_state_block.blend_equation_rgb, GL_BLEND_EQUATION_RGB);
+            validateName("blend equation alpha", m_state_block.blend_equation_alpha, GL_BLEND_EQUATION_ALPHA);
+        }
+
+        if (m_program != cUnknown)
+            validateName("program", m_program, GL_CURRENT_PROGRAM);
+        if (m_vertex_array != cUnknown)
+            validateName("vertex array", m_vertex_array, GL_VERTEX_ARRAY_BINDING);
+
+        for (uint32_t target = 0; target < cBufferTargetCount; ++target)
+            if (m_buffers[target] != cUnknown)
+                validateName("buffer binding", m_buffers[target], getBindingQuery(static_cast<BufferTarget>(target)));
+
+        const auto validate_indexed = [](const auto& bindings, const GLenum binding_query, const GLenum start_query, const GLenum size_query)
+        {
+            for (GLuint index = 0; index < cMaxIndexedBindings; ++index)
+            {
+                const auto& binding = bindings[index];
+                if (binding.buffer == cUnknown)
+                    continue;
+
+                GLint buffer = 0;
+                GLint64 offset = 0;
+                GLint64 size = 0;
+                glGetIntegeri_v(binding_query, index, &buffer);
+                glGetInteger64i_v(start_query, index, &offset);
+                glGetInteger64i_v(size_query, index, &size);
+
+                NB_CORE_ASSERT(
+                    static_cast<GLuint>(buffer) == binding.buffer && offset == binding.offset && size == binding.size,
+                    std::format("OpenGL state cache out of sync, indexed buffer binding {} differs!", index)
+                );
+            }
+        };
+
+        validate_indexed(m_uniform_buffers, GL_UNIFORM_BUFFER_BINDING, GL_UNIFORM_BUFFER_START, GL_UNIFORM_BUFFER_SIZE);
+        validate_indexed(m_storage_buffers, GL_SHADER_STORAGE_BUFFER_BINDING, GL_SHADER_STORAGE_BUFFER_START, GL_SHADER_STORAGE_BUFFER_SIZE);
+    }
+
+    void OpenGLStateCache::bindFramebuffer(const GLenum target, const GLuint framebuffer)
+    {
+        const bool draw = target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER;
+        const bool read = target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER;
+
+        if ((!draw || m_draw_framebuffer == framebuffer) && (!read || m_read_framebuffer == framebuffer))
+            return onSkipped();
+
+        glBindFramebuffer(target, framebuffer);
+
+        if (draw)
+            m_draw_framebuffer = framebuffer;
+        if (read)
+            m_read_framebuffer = framebuffer;
+    }
+
+    void OpenGLStateCache::setViewport(const GLint x, const GLint y, const GLsizei width, const GLsizei height)
+    {
+        const std::array<GLint, 4> viewport = { x, y, width, height };
+        if (m_viewport.known && m_viewport.values == viewport)
+            return onSkipped();
+
+        glViewport(x, y, width, height);
+        m_viewport = { viewport, true };
+    }
+
+    void OpenGLStateCache::setScissor(const GLint x, const GLint y, const GLsizei width, const GLsizei height)
+    {
+        const std::array<GLint, 4> scissor = { x, y, width, height };
+        if (m_scissor.known && m_scissor.values == scissor)
+            return onSkipped();
+
+        glScissor(x, y, width, height);
+        m_scissor = { scissor, true };
+    }
+
+    void OpenGLStateCache::setScissorTest(const bool enabled)
+    {
+        if (m_scissor_test == static_cast<GLint>(enabled))
+            return onSkipped();
+
+        if (enabled)
+            glEnable(GL_SCISSOR_TEST);
+        else
+            glDisable(GL_SCISSOR_TEST);
+
+        m_scissor_test = enabled;
+    }
+
+    void OpenGLStateCache::setClearColor(const float r, const float g, const float b, const float a)
+    {
+        const std::array<float, 4> clear_color = { r, g, b, a };
+        if (m_clear_color_known && m_clear_color == clear_color)
+            return onSkipped();
+
+        glClearColor(r, g, b, a);
+        m_clear_color = clear_color;
+        m_clear_color_known = true;
+    }
+
+    void OpenGLStateCache::applyStateBlock(const OpenGLStateBlock& state_block)
+    {
+        if (m_state_block_known && m_state_block == state_block)
+            return onSkipped();
+
+        //  Unknown state is written completely, known state only where it differs
+        const bool write_all = !m_state_block_known;
+        const auto& current = m_state_block;
+        uint32_t skipped_calls = 0;
+
+        const auto changed = [&](const auto& current_value, const auto& value)
+        {
+            const bool result = write_all || current_value != value;
+            skipped_calls += !result;
+            return result;
+        };
+
+        const auto set_capability = [&](const GLenum capability, const bool current_value, const bool value)
+        {
+            if (!changed(current_value, value))
+                return;
+
+            if (value)
+                glEnable(capability);
+            else
+                glDisable(capability);
+        };
+
+        set_capability(GL_PRIMITIVE_RESTART_FIXED_INDEX, current.primitive_restart, state_block.primitive_restart);
+        set_capability(GL_RASTERIZER_DISCARD, current.rasterizer_discard, state_block.rasterizer_discard);
+        set_capability(GL_CULL_FACE, current.cull, state_block.cull);
+        set_capability(GL_DEPTH_TEST, current.depth_test, state_block.depth_test);
+        set_capability(GL_DEPTH_CLAMP, current.depth_clamp, state_block.depth_clamp);
+        set_capability(GL_POLYGON_OFFSET_FILL, current.polygon_offset, state_block.polygon_offset);
+        set_capability(GL_SAMPLE_SHADING, current.sample_shading, state_block.sample_shading);
+        set_capability(GL_SAMPLE_ALPHA_TO_COVERAGE, current.alpha_to_coverage, state_block.alpha_to_coverage);
+        set_capability(GL_SAMPLE_ALPHA_TO_ONE, current.alpha_to_one, state_block.alpha_to_one);
+        set_capability(GL_BLEND, current.blend, state_block.blend);
+
+        if (changed(current.cull_face, state_block.cull_face))
+            glCullFace(state_block.cull_face);
+        if (changed(current.front_face, state_block.front_face))
+            glFrontFace(state_block.front_face);
+        if (changed(current.polygon_mode, state_block.polygon_mode))
+            glPolygonMode(GL_FRONT_AND_BACK, state_block.polygon_mode);
+        if (changed(current.line_width, state_block.line_width))
+            glLineWidth(state_block.line_width);
+        if (changed(current.min_sample_shading, state_block.min_sample_shading))
+            glMinSampleShading(state_block.min_sample_shading);
+
+        const bool blend_function_changed =
+            current.blend_src_rgb != state_block.blend_src_rgb ||
+            current.blend_dst_rgb != state_block.blend_dst_rgb ||
+            current.blend_src_alpha != state_block.blend_src_alpha ||
+            current.blend_dst_alpha != state_block.blend_dst_alpha;
+        if (changed(blend_function_changed, false))
+            glBlendFuncSeparate(state_block.blend_src_rgb, state_block.blend_dst_rgb, state_block.blend_src_alpha, state_block.blend_dst_alpha);
+
+        const bool blend_equation_changed =
+            current.blend_equation_rgb != state_block.blend_equation_rgb ||
+            current.blend_equation_alpha != state_block.blend_equation_alpha;
+        if (changed(blend_equation_changed, false))
+            glBlendEquationSeparate(state_block.blend_equation_rgb, state_block.blend_equation_alpha);
+
+        const bool offset_changed =
+            current.polygon_offset_factor != state_block.polygon_offset_factor ||
+            current.polygon_offset_units != state_block.polygon_offset_units ||
+            current.polygon_offset_clamp != state_block.polygon_offset_clamp;
+        if (changed(offset_changed, false))
+            glPolygonOffsetClamp(state_block.polygon_offset_factor, state_block.polygon_offset_units, state_block.polygon_offset_clamp);
+
+        m_state_block = state_block;
+        m_state_block_known = true;
+
+        if (skipped_calls > 0)
+            NB_COUNT(cGlStateCallsSkipped, skipped_calls);
+    }
+
+    void OpenGLStateCache::useProgram(const GLuint program)
+    {
+        if (m_program == program)
+            return onSkipped();
+
+        glUseProgram(program);
+        m_program = program;
+    }
+
+    void OpenGLStateCache::bindVertexArray(const GLuint vertex_array)
+    {
+        if (m_vertex_array == vertex_array)
+            return onSkipped();
+
+        glBindVertexArray(vertex_array);
+        m_vertex_array = vertex_array;
+
+        //  Element array binding is part of vertex array object
+        m_buffers[cElementArrayBuffer] = cUnknown;
+    }
+
+    void OpenGLStateCache::bindBuffer(const GLenum target, const GLuint buffer)
+    {
+        auto& bound_buffer = m_buffers[getBufferTarget(target)];
+        if (bound_buffer == buffer)
+            return onSkipped();
+
+        glBindBuffer(target, buffer);
+        bound_buffer = buffer;
+    }
+
+    void OpenGLStateCache::bindBufferRange(const GLenum target, const GLuint index, const GLuint buffer, const GLintptr offset, const GLsizeiptr size)
+    {
+        auto& binding = getIndexedBinding(target, index);
+        if (binding.buffer == buffer && binding.offset == offset && binding.size == size)
+            return onSkipped();
+
+        glBindBufferRange(target, index, buffer, offset, size);
+        binding = { buffer, offset, size };
+
+        //  Indexed binding also replaces generic binding point
+        m_buffers[getBufferTarget(target)] = buffer;
+    }
+
+    void OpenGLStateCache::bindBufferBase(const GLenum target, const GLuint index, const GLuint buffer)
+    {
+        auto& binding = getIndexedBinding(target, index);
+        if (binding.buffer == buffer && binding.offset == 0 && binding.size == 0)
+            return onSkipped();
+
+        glBindBufferBase(target, index, buffer);
+        binding = { buffer, 0, 0 };
+
+        m_buffers[getBufferTarget(target)] = buffer;
+    }
+
+    void OpenGLStateCache::setVertexArrayElementBuffer(const GLuint vertex_array, const GLuint buffer)
+    {
+        glVertexArrayElementBuffer(vertex_array, buffer);
+
+        if (m_vertex_array == vertex_array)
+            m_buffers[cElementArrayBuffer] = buffer;
+    }
+
+    void OpenGLStateCache::onFramebufferDeleted(const GLuint framebuffer)
+    {
+        if (m_draw_framebuffer == framebuffer)
+            m_draw_framebuffer = 0;
+        if (m_read_framebuffer == framebuffer)
+            m_read_framebuffer = 0;
+    }
+
+    void OpenGLStateCache::onVertexArrayDeleted(const GLuint vertex_array)
+    {
+        if (m_vertex_array == vertex_array)
+        {
+            m_vertex_array = 0;
+            m_buffers[cElementArrayBuffer] = cUnknown;
+        }
+    }
+
+    void OpenGLStateCache::onBufferDeleted(const GLuint buffer)
+    {
+        for (auto& bound_buffer : m_buffers)
+            if (bound_buffer == buffer)
+                bound_buffer = 0;
+
+        //  Indexed bindings of deleted buffer are left dangling by some drivers, so they are simply forgotten
+        for (auto& binding : m_uniform_buffers)
+            if (binding.buffer == buffer)
+                binding = IndexedBinding{};
+        for (auto& binding : m_storage_buffers)
+            if (binding.buffer == buffer)
+                binding = IndexedBinding{};
+    }
+
+    void OpenGLStateCache::onSkipped() const
+    {
+        NB_COUNT(cGlStateCallsSkipped, 1);
+
+        #ifdef NB_GL_STATE_VALIDATION
+        validate();
+        #endif
+    }
+
+    OpenGLStateCache::BufferTarget OpenGLStateCache::getBufferTarget(const GLenum target)
+    {
+        switch (target)
+        {
+            case GL_ARRAY_BUFFER: return cArrayBuffer;
+            case GL_ELEMENT_ARRAY_BUFFER: return cElementArrayBuffer;
+            case GL_UNIFORM_BUFFER: return cUniformBuffer;
+            case GL_SHADER_STORAGE_BUFFER: return cShaderStorageBuffer;
+            case GL_COPY_READ_BUFFER: return cCopyReadBuffer;
+            case GL_COPY_WRITE_BUFFER: return cCopyWriteBuffer;
+            case GL_PIXEL_PACK_BUFFER: return cPixelPackBuffer;
+            case GL_PIXEL_UNPACK_BUFFER: return cPixelUnpackBuffer;
+            case GL_DRAW_INDIRECT_BUFFER: return cDrawIndirectBuffer;
+            default: NB_CORE_ASSERT(false, "Unsupported buffer target!");
+        }
+
+        return cBufferTargetCount;
+    }
+
+    GLenum OpenGLStateCache::getBindingQuery(const BufferTarget target)
+    {
+        switch (target)
+        {
+            case cArrayBuffer: return GL_ARRAY_BUFFER_BINDING;
+            case cElementArrayBuffer: return GL_ELEMENT_ARRAY_BUFFER_BINDING;
+            case cUniformBuffer: return GL_UNIFORM_BUFFER_BINDING;
+            case cShaderStorageBuffer: return GL_SHADER_STORAGE_BUFFER_BINDING;
+            case cCopyReadBuffer: return GL_COPY_READ_BUFFER_BINDING;
+            case cCopyWriteBuffer: return GL_COPY_WRITE_BUFFER_BINDING;
+            case cPixelPackBuffer: return GL_PIXEL_PACK_BUFFER_BINDING;
+            case cPixelUnpackBuffer: return GL_PIXEL_UNPACK_BUFFER_BINDING;
+            case cDrawIndirectBuffer: return GL_DRAW_INDIRECT_BUFFER_BINDING;
+            default: return GL_NONE;
+        }
+    }
+
+    OpenGLStateCache::IndexedBinding& OpenGLStateCache::getIndexedBinding(const GLenum target, const GLuint index)
+    {
+        NB_CORE_ASSERT(index < cMaxIndexedBindings, "Indexed buffer binding out of cached range!");
+        NB_CORE_ASSERT(target == GL_UNIFORM_BUFFER || target == GL_SHADER_STORAGE_BUFFER, "Unsupported indexed buffer target!");
+
+        return target == GL_UNIFORM_BUFFER ? m_uniform_buffers[index] : m_storage_buffers[index];
+    }
+
+}
@@ -0,0 +1,112 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "platform/OpenGL/OpenGLStreamBuffer.h"
+
+#include <format>
+#include <algorithm>
+
+#include "core/Assert.h"
+#include "debug/Profiler.h"
+#include "platform/OpenGL/OpenGLStateCache.h"
+
+namespace nebula::rendering {
+
+    static constexpr GLbitfield cStreamBufferFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    static constexpr GLuint64 cFenceTimeout = 1'000'000'000;     //  1s in nanoseconds
+
+    OpenGLStreamBuffer::OpenGLStreamBuffer(const GLsizeiptr frame_size, const uint32_t frames_in_flight) :
+            m_frame_size(frame_size),
+            m_fences(frames_in_flight, nullptr)
+    {
+        NB_CORE_ASSERT(frame_size > 0 && frames_in_flight > 0, "OpenGL stream buffer requires non empty regions!");
+
+        GLint uniform_alignment = 0;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniform_alignment);
+        m_uniform_alignment = std::max<GLsizeiptr>(uniform_alignment, 1);
+
+        //  Regions start at uniform aligned offsets, so any allocation can be bound as uniform buffer range
+        m_frame_size = (frame_size + m_uniform_alignment - 1) / m_uniform_alignment * m_uniform_alignment;
+        const GLsizeiptr buffer_size = m_frame_size * frames_in_flight;
+
+        glCreateBuffers(1, &m_buffer);
+        glNamedBufferStorage(m_buffer, buffer_size, nullptr, cStreamBufferFlags);
+        m_mapped_memory = static_cast<std::byte*>(glMapNamedBufferRange(m_buffer, 0, buffer_size, cStreamBufferFlags));
+
+        NB_CORE_ASSERT(m_mapped_memory, "Failed to persistently map OpenGL stream buffer!");
+    }
+
+    OpenGLStreamBuffer::~OpenGLStreamBuffer()
+    {
+        for (uint32_t frame = 0; frame < m_fences.size(); ++frame)
+            waitForFence(frame);
+
+        glUnmapNamedBuffer(m_buffer);
+
+        OpenGLStateCache::get().onBufferDeleted(m_buffer);
+        glDeleteBuffers(1, &m_buffer);
+    }
+
+    void OpenGLStreamBuffer::beginFrame(const uint32_t frame_in_flight)
+    {
+        NB_CORE_ASSERT(frame_in_flight < m_fences.size(), "Invalid frame in flight!");
+
+        waitForFence(frame_in_flight);
+
+        m_frame_in_flight = frame_in_flight;
+        m_frame_offset = 0;
+    }
+
+    void OpenGLStreamBuffer::endFrame()
+    {
+        //  Region can be written again once everything issued up to here is executed
+        auto& fence = m_fences[m_frame_in_flight];
+        if (fence)
+            glDeleteSync(fence);
+        fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+    OpenGLStreamAllocation OpenGLStreamBuffer::allocate(const GLsizeiptr size, const GLsizeiptr alignment)
+    {
+        const GLsizeiptr offset = (m_frame_offset + alignment - 1) / alignment * alignment;
+        NB_CORE_ASSERT(
+            offset + size <= m_frame_size,
+            std::format("OpenGL stream buffer region overflow, {} of {} bytes requested! Increase memory.stream_buffer_size.", offset + size, m_frame_size)
+        );
+
+        m_frame_offset = offset + size;
+
+        const GLintptr buffer_offset = m_frame_size * m_frame_in_flight + offset;
+        return {m_mapped_memory + buffer_offset, m_buffer, buffer_offset, size};
+    }
+
+    void OpenGLStreamBuffer::waitForFence(const uint32_t frame_in_flight)
+    {
+        auto& fence = m_fences[frame_in_flight];
+        if (!fence)
+            return;
+
+        NB_PROFILE_SCOPE("Stream buffer fence");
+
+        //  Commands behind fence may still be sitting in client queue, first wait flushes them
+        GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+        while (true)
+        {
+            const GLenum result = glClientWaitSync(fence, flags, cFenceTimeout);
+            if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED)
+                break;
+
+            NB_CORE_ASSERT(result != GL_WAIT_FAILED, "Failed to wait for OpenGL stream buffer fence!");
+            if (result == GL_WAIT_FAILED)
+                break;
+
+            flags = 0;
+        }
+
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+
+}
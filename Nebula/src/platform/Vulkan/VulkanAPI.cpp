@@ -11,6 +11,7 @@
 #include <GLFW/glfw3.h>
 
 #include "core/Assert.h"
+#include "core/Config.h"
 #include "core/Logging.h"
 #include "core/Application.h"
 
@@ -21,6 +22,9 @@
 //  Device helpers
 int ratePhysicalDevice(VkPhysicalDevice device);
 bool checkDeviceExtensionSupport(VkPhysicalDevice device, const std::vector<const char*>& required_extensions);
+bool checkDeviceFeatureSupport(VkPhysicalDevice device);
+bool checkBindlessFeatureSupport(VkPhysicalDevice device);
+bool checkDynamicRenderingFeatureSupport(VkPhysicalDevice device);
 
 //  Create helpers
 VkApplicationInfo createApplicationInfo();
@@ -48,6 +52,9 @@ namespace nebula::rendering {
     VkPhysicalDevice VulkanAPI::s_physical_device = VK_NULL_HANDLE;
     VmaAllocator VulkanAPI::s_vma_allocator = VK_NULL_HANDLE;
     QueuesInfo VulkanAPI::s_queues_info;
+    std::mutex VulkanAPI::s_queue_mutex;
+    bool VulkanAPI::s_bindless_support = false;
+    bool VulkanAPI::s_dynamic_rendering = false;
 
     VkInstance VulkanAPI::getInstance() { return s_instance; }
     VkDevice VulkanAPI::getDevice() { return s_device; }
@@ -101,6 +108,8 @@ namespace nebula::rendering {
         s_device = VK_NULL_HANDLE;
         s_physical_device = VK_NULL_HANDLE;
         s_queues_info = {};
+        s_bindless_support = false;
+        s_dynamic_rendering = false;
     }
 
     void VulkanAPI::createVulkanInstance()
@@ -163,16 +172,17 @@ namespace nebula::rendering {
         m_queue_family_indices = findQueueFamilies(s_physical_device);
         s_queues_info.graphics_family_index = *m_queue_family_indices.graphics_family;
         s_queues_info.presentation_family_index = *m_queue_family_indices.presentation_family;
+        s_queues_info.transfer_family_index = m_queue_family_indices.transfer_family.value_or(*m_queue_family_indices.graphics_family);
     }
 
     void VulkanAPI::createLogicalDevice()
     {
         NB_CORE_ASSERT(!s_device, "Can have only one Vulkan device!");
 
-        const auto [graphics_family, presentation_family] = m_queue_family_indices;    //  For shorter typing
+        const auto [graphics_family, presentation_family, transfer_family] = m_queue_family_indices;    //  For shorter typing
 
         std::vector<VkDeviceQueueCreateInfo> queue_create_infos;
-        const std::set unique_queue_indices = {*graphics_family, *presentation_family};
+        const std::set unique_queue_indices = {*graphics_family, *presentation_family, s_queues_info.transfer_family_index};
 
         queue_create_infos.reserve(unique_queue_indices.size());
         for (const auto queue_index : unique_queue_indices)
@@ -180,8 +190,47 @@ namespace nebula::rendering {
 
         VkPhysicalDeviceFeatures device_features{};
 
+        VkPhysicalDeviceVulkan12Features vulkan12_features{};
+        vulkan12_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        vulkan12_features.timelineSemaphore = VK_TRUE;
+
+        s_bindless_support = checkBindlessFeatureSupport(s_physical_device);
+        if (s_bindless_support)
+        {
+            vulkan12_features.runtimeDescriptorArray = VK_TRUE;
+            vulkan12_features.descriptorBindingPartiallyBound = VK_TRUE;
+            vulkan12_features.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+            vulkan12_features.shaderStorageBufferArrayNonUniformIndexing = VK_TRUE;
+            vulkan12_features.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+            vulkan12_features.descriptorBindingStorageBufferUpdateAfterBind = VK_TRUE;
+        }
+        else if constexpr (NEBULA_INITIALIZATION_VERBOSITY >= NEBULA_INITIALIZATION_VERBOSITY_LOW)
+            NB_CORE_WARN("Vulkan descriptor indexing is not supported, bindless resources are disabled");
+
+        VkPhysicalDeviceVulkan13Features vulkan13_features{};
+        vulkan13_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES;
+
+        if (Config::getEngineSettings().rendering.vulkan_dynamic_rendering)
+        {
+            s_dynamic_rendering = checkDynamicRenderingFeatureSupport(s_physical_device);
+
+            //  Vulkan 1.3 feature struct is invalid for older devices, so it's chained only when it's used
+            if (s_dynamic_rendering)
+            {
+                vulkan13_features.dynamicRendering = VK_TRUE;
+                vulkan12_features.pNext = &vulkan13_features;
+            }
+
+            if constexpr (NEBULA_INITIALIZATION_VERBOSITY >= NEBULA_INITIALIZATION_VERBOSITY_LOW)
+            {
+                if (!s_dynamic_rendering)
+                    NB_CORE_WARN("Vulkan dynamic rendering is not supported, falling back to VkRenderPass");
+            }
+        }
+
         VkDeviceCreateInfo create_info{};
         create_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+        create_info.pNext = &vulkan12_features;
         create_info.pQueueCreateInfos = queue_create_infos.data();
         create_info.queueCreateInfoCount = static_cast<uint32_t>(queue_create_infos.size());
         create_info.pEnabledFeatures = &device_features;
@@ -196,6 +245,17 @@ namespace nebula::rendering {
 
         vkGetDeviceQueue(s_device, *presentation_family, 0, &s_queues_info.presentation_queue);
         NB_CORE_ASSERT(s_queues_info.presentation_queue != VK_NULL_HANDLE, "Unable to retrive Vulkan presentation queue handle!");
+
+        vkGetDeviceQueue(s_device, s_queues_info.transfer_family_index, 0, &s_queues_info.transfer_queue);
+        NB_CORE_ASSERT(s_queues_info.transfer_queue != VK_NULL_HANDLE, "Unable to retrive Vulkan transfer queue handle!");
+
+        if constexpr (NEBULA_INITIALIZATION_VERBOSITY >= NEBULA_INITIALIZATION_VERBOSITY_MEDIUM)
+        {
+            if (s_queues_info.checkDedicatedTransfer())
+                NB_CORE_INFO("Using dedicated Vulkan transfer queue family: {}", s_queues_info.transfer_family_index);
+            else
+                NB_CORE_INFO("No dedicated Vulkan transfer queue family, uploads use graphics queue");
+        }
     }
 
     void VulkanAPI::createVmaAllocator()
@@ -218,7 +278,7 @@ namespace nebula::rendering {
 
     bool VulkanAPI::isDeviceSuitable(VkPhysicalDevice device) const
     {
-        if (checkDeviceExtensionSupport(device, m_device_required_extensions))
+        if (checkDeviceExtensionSupport(device, m_device_required_extensions) && checkDeviceFeatureSupport(device))
         {
             const auto queue_indices = findQueueFamilies(device);
             const auto swapchain_details = querySwapchainSupport(device, m_surface);
@@ -237,16 +297,22 @@ namespace nebula::rendering {
         const auto queue_families = getQueueFamilies(device);
         for (int index = 0; index < queue_families.size(); ++index)
         {
+            const VkQueueFlags queue_flags = queue_families[index].queueFlags;
+
+            //  Transfer-only families map to DMA engines, copies there run alongside rendering
+            if (!indices.transfer_family && (queue_flags & VK_QUEUE_TRANSFER_BIT) && !(queue_flags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)))
+                indices.transfer_family = index;
+
+            if (indices.checkMinimalSupport())
+                continue;
+
             vkGetPhysicalDeviceSurfaceSupportKHR(device, index, m_surface, &present_support);
 
-            if (queue_families[index].queueFlags & VK_QUEUE_GRAPHICS_BIT)
+            if (queue_flags & VK_QUEUE_GRAPHICS_BIT)
                 indices.graphics_family = index;
 
             if (present_support)
                 indices.presentation_family = index;
-
-            if (indices.checkMinimalSupport())
-                break;
         }
 
         return indices;
@@ -329,6 +395,56 @@ bool checkDeviceExtensionSupport(VkPhysicalDevice device, const std::vector<cons
     return true;
 }
 
+bool checkDeviceFeatureSupport(VkPhysicalDevice device)
+{
+    VkPhysicalDeviceVulkan12Features vulkan12_features{};
+    vulkan12_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+
+    VkPhysicalDeviceFeatures2 device_features{};
+    device_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    device_features.pNext = &vulkan12_features;
+    vkGetPhysicalDeviceFeatures2(device, &device_features);
+
+    return vulkan12_features.timelineSemaphore == VK_TRUE;
+}
+
+bool checkBindlessFeatureSupport(VkPhysicalDevice device)
+{
+    VkPhysicalDeviceVulkan12Features vulkan12_features{};
+    vulkan12_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+
+    VkPhysicalDeviceFeatures2 device_features{};
+    device_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    device_features.pNext = &vulkan12_features;
+    vkGetPhysicalDeviceFeatures2(device, &device_features);
+
+    return  vulkan12_features.runtimeDescriptorArray &&
+            vulkan12_features.descriptorBindingPartiallyBound &&
+            vulkan12_features.shaderSampledImageArrayNonUniformIndexing &&
+            vulkan12_features.shaderStorageBufferArrayNonUniformIndexing &&
+            vulkan12_features.descriptorBindingSampledImageUpdateAfterBind &&
+            vulkan12_features.descriptorBindingStorageBufferUpdateAfterBind;
+}
+
+bool checkDynamicRenderingFeatureSupport(VkPhysicalDevice device)
+{
+    //  Vulkan 1.3 feature struct is valid only if both instance and device are created for 1.3
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(device, &properties);
+    if (properties.apiVersion < VK_API_VERSION_1_3 || VK_MAKE_API_VERSION(0, VULKAN_MAJOR_VERSION, VULKAN_MINOR_VERSION, 0) < VK_API_VERSION_1_3)
+        return false;
+
+    VkPhysicalDeviceVulkan13Features vulkan13_features{};
+    vulkan13_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES;
+
+    VkPhysicalDeviceFeatures2 device_features{};
+    device_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    device_features.pNext = &vulkan13_features;
+    vkGetPhysicalDeviceFeatures2(device, &device_features);
+
+    return vulkan13_features.dynamicRendering == VK_TRUE;
+}
+
 /////////////////////////////////////////////////////////////////////////////////
 ////  Create helpers  ///////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////
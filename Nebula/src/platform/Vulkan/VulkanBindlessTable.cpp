@@ -0,0 +1,253 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "platform/Vulkan/VulkanBindlessTable.h"
+
+#include <array>
+
+#include "core/Assert.h"
+#include "rendering/RenderContext.h"
+
+namespace nebula::rendering {
+
+    static constexpr uint32_t s_max_bindless_textures = 16384;
+    static constexpr uint32_t s_max_bindless_storage_buffers = 16384;
+
+    VulkanBindlessTable* VulkanBindlessTable::s_instance = nullptr;
+
+    VulkanBindlessTable::VulkanBindlessTable()
+    {
+        NB_CORE_ASSERT(!s_instance, "Can have only one VulkanBindlessTable!");
+        NB_CORE_ASSERT(VulkanAPI::checkBindlessSupport(), "Vulkan device does not support descriptor indexing!");
+        s_instance = this;
+
+        //  Clamp table size to device limits
+        VkPhysicalDeviceVulkan12Properties vulkan12_properties = {};
+        vulkan12_properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES;
+
+        VkPhysicalDeviceProperties2 properties = {};
+        properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+        properties.pNext = &vulkan12_properties;
+        vkGetPhysicalDeviceProperties2(VulkanAPI::getPhysicalDevice(), &properties);
+
+        m_textures.capacity = std::min({
+            s_max_bindless_textures,
+            vulkan12_properties.maxDescriptorSetUpdateAfterBindSampledImages,
+            vulkan12_properties.maxPerStageDescriptorUpdateAfterBindSampledImages
+        });
+        m_storage_buffers.capacity = std::min({
+            s_max_bindless_storage_buffers,
+            vulkan12_properties.maxDescriptorSetUpdateAfterBindStorageBuffers,
+            vulkan12_properties.maxPerStageDescriptorUpdateAfterBindStorageBuffers
+        });
+
+        const uint32_t frames_in_flight = RenderContext::get().getFramesInFlightNumber();
+        m_textures.deferred_slots.resize(frames_in_flight);
+        m_storage_buffers.deferred_slots.resize(frames_in_flight);
+
+        //  DescriptorSetLayout
+        std::array<VkDescriptorSetLayoutBinding, 2> bindings = {};
+        bindings[0].binding = cTexturesBinding;
+        bindings[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        bindings[0].descriptorCount = m_textures.capacity;
+        bindings[0].stageFlags = VK_SHADER_STAGE_ALL;
+
+        bindings[1].binding = cStorageBuffersBinding;
+        bindings[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        bindings[1].descriptorCount = m_storage_buffers.capacity;
+        bindings[1].stageFlags = VK_SHADER_STAGE_ALL;
+
+        constexpr VkDescriptorBindingFlags binding_flags = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT;
+        const std::array<VkDescriptorBindingFlags, 2> bindings_flags = {binding_flags, binding_flags};
+
+        VkDescriptorSetLayoutBindingFlagsCreateInfo binding_flags_info = {};
+        binding_flags_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+        binding_flags_info.bindingCount = static_cast<uint32_t>(bindings_flags.size());
+        binding_flags_info.pBindingFlags = bindings_flags.data();
+
+        VkDescriptorSetLayoutCreateInfo layout_create_info = {};
+        layout_create_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        layout_create_info.pNext = &binding_flags_info;
+        layout_create_info.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+        layout_create_info.bindingCount = static_cast<uint32_t>(bindings.size());
+        layout_create_info.pBindings = bindings.data();
+
+        auto result = vkCreateDescriptorSetLayout(VulkanAPI::getDevice(), &layout_create_info, nullptr, &m_descriptor_set_layout);
+        NB_CORE_ASSERT(result == VK_SUCCESS, "Failed to create Vulkan bindless DescriptorSetLayout!");
+
+        //  DescriptorPool
+        const std::array<VkDescriptorPoolSize, 2> pool_sizes = {{
+            {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, m_textures.capacity},
+            {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, m_storage_buffers.capacity}
+        }};
+
+        VkDescriptorPoolCreateInfo pool_create_info = {};
+        pool_create_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        pool_create_info.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+        pool_create_info.maxSets = 1;
+        pool_create_info.poolSizeCount = static_cast<uint32_t>(pool_sizes.size());
+        pool_create_info.pPoolSizes = pool_sizes.data();
+
+        result = vkCreateDescriptorPool(VulkanAPI::getDevice(), &pool_create_info, nullptr, &m_descriptor_pool);
+        NB_CORE_ASSERT(result == VK_SUCCESS, "Failed to create Vulkan bindless DescriptorPool!");
+
+        //  DescriptorSet
+        VkDescriptorSetAllocateInfo allocate_info = {};
+        allocate_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocate_info.descriptorPool = m_descriptor_pool;
+        allocate_info.descriptorSetCount = 1;
+        allocate_info.pSetLayouts = &m_descriptor_set_layout;
+
+        result = vkAllocateDescriptorSets(VulkanAPI::getDevice(), &allocate_info, &m_descriptor_set);
+        NB_CORE_ASSERT(result == VK_SUCCESS, "Failed to allocate Vulkan bindless DescriptorSet!");
+
+        //  PipelineLayout compatible with set 0 and push constants of every bindless pipeline
+        const VkPushConstantRange push_constant_range = getPushConstantRange();
+
+        VkPipelineLayoutCreateInfo pipeline_layout_create_info = {};
+        pipeline_layout_create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipeline_layout_create_info.setLayoutCount = 1;
+        pipeline_layout_create_info.pSetLayouts = &m_descriptor_set_layout;
+        pipeline_layout_create_info.pushConstantRangeCount = 1;
+        pipeline_layout_create_info.pPushConstantRanges = &push_constant_range;
+
+        result = vkCreatePipelineLayout(VulkanAPI::getDevice(), &pipeline_layout_create_info, nullptr, &m_pipeline_layout);
+        NB_CORE_ASSERT(result == VK_SUCCESS, "Failed to create Vulkan bindless PipelineLayout!");
+    }
+
+    VulkanBindlessTable::~VulkanBindlessTable()
+    {
+        NB_CORE_ASSERT(s_instance);
+
+        vkDestroyPipelineLayout(VulkanAPI::getDevice(), m_pipeline_layout, nullptr);
+        vkDestroyDescriptorPool(VulkanAPI::getDevice(), m_descriptor_pool, nullptr);
+        vkDestroyDescriptorSetLayout(VulkanAPI::getDevice(), m_descriptor_set_layout, nullptr);
+
+        s_instance = nullptr;
+    }
+
+    BindlessHandle VulkanBindlessTable::registerTexture(VkImageView image_view, VkSampler sampler, const VkImageLayout layout)
+    {
+        std::lock_guard lock{m_mutex};
+
+        const uint32_t slot = m_textures.allocate();
+        const VkDescriptorImageInfo image_info = {sampler, image_view, layout};
+        writeDescriptor(cTexturesBinding, slot, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, &image_info, nullptr);
+
+        return {slot};
+    }
+
+    BindlessHandle VulkanBindlessTable::registerStorageBuffer(VkBuffer buffer, const VkDeviceSize offset, const VkDeviceSize range)
+    {
+        std::lock_guard lock{m_mutex};
+
+        const uint32_t slot = m_storage_buffers.allocate();
+        const VkDescriptorBufferInfo buffer_info = {buffer, offset, range};
+        writeDescriptor(cStorageBuffersBinding, slot, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, nullptr, &buffer_info);
+
+        return {slot};
+    }
+
+    void VulkanBindlessTable::releaseTexture(const BindlessHandle handle)
+    {
+        NB_CORE_ASSERT(handle.checkValid());
+
+        std::lock_guard lock{m_mutex};
+        m_textures.release(handle.index);
+    }
+
+    void VulkanBindlessTable::releaseStorageBuffer(const BindlessHandle handle)
+    {
+        NB_CORE_ASSERT(handle.checkValid());
+
+        std::lock_guard lock{m_mutex};
+        m_storage_buffers.release(handle.index);
+    }
+
+    void VulkanBindlessTable::bind(VkCommandBuffer command_buffer, const VkPipelineBindPoint bind_point) const
+    {
+        vkCmdBindDescriptorSets(command_buffer, bind_point, m_pipeline_layout, 0, 1, &m_descriptor_set, 0, nullptr);
+    }
+
+    void VulkanBindlessTable::pushHandles(VkCommandBuffer command_buffer, const uint32_t* handles, const uint32_t count, const uint32_t offset) const
+    {
+        NB_CORE_ASSERT(offset + count * sizeof(uint32_t) <= cPushConstantsSize, "Bindless handles exceed push constants range!");
+        vkCmdPushConstants(command_buffer, m_pipeline_layout, VK_SHADER_STAGE_ALL, offset, count * sizeof(uint32_t), handles);
+    }
+
+    void VulkanBindlessTable::onFrameCompleted(const uint32_t frame_in_flight)
+    {
+        std::lock_guard lock{m_mutex};
+
+        m_textures.reclaim(frame_in_flight);
+        m_storage_buffers.reclaim(frame_in_flight);
+    }
+
+    VkPushConstantRange VulkanBindlessTable::getPushConstantRange()
+    {
+        VkPushConstantRange push_constant_range = {};
+        push_constant_range.stageFlags = VK_SHADER_STAGE_ALL;
+        push_constant_range.offset = 0;
+        push_constant_range.size = cPushConstantsSize;
+
+        return push_constant_range;
+    }
+
+    void VulkanBindlessTable::writeDescriptor(
+        const uint32_t binding,
+        const uint32_t slot,
+        const VkDescriptorType type,
+        const VkDescriptorImageInfo* image_info,
+        const VkDescriptorBufferInfo* buffer_info
+    ) const
+    {
+        VkWriteDescriptorSet write = {};
+        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.dstSet = m_descriptor_set;
+        write.dstBinding = binding;
+        write.dstArrayElement = slot;
+        write.descriptorCount = 1;
+        write.descriptorType = type;
+        write.pImageInfo = image_info;
+        write.pBufferInfo = buffer_info;
+
+        vkUpdateDescriptorSets(VulkanAPI::getDevice(), 1, &write, 0, nullptr);
+    }
+
+    ////////////////////////////////////////////////////////////////////
+    //////  SlotAllocator  /////////////////////////////////////////////
+    ////////////////////////////////////////////////////////////////////
+
+    uint32_t VulkanBindlessTable::SlotAllocator::allocate()
+    {
+        if (!free_slots.empty())
+        {
+            const uint32_t slot = free_slots.back();
+            free_slots.pop_back();
+            return slot;
+        }
+
+        NB_CORE_ASSERT(next_unused < capacity, "Bindless table is full!");
+        return next_unused++;
+    }
+
+    void VulkanBindlessTable::SlotAllocator::release(const uint32_t slot)
+    {
+        NB_CORE_ASSERT(slot < next_unused);
+        released_slots.push_back(slot);
+    }
+
+    void VulkanBindlessTable::SlotAllocator::reclaim(const uint32_t frame_in_flight)
+    {
+        //  Slots released before this fence was last waited on are no longer referenced by any submitted frame
+        auto& deferred = deferred_slots[frame_in_flight];
+        free_slots.insert(free_slots.end(), deferred.begin(), deferred.end());
+
+        //  Slots released since then may still be used by frames in flight, wait until this fence comes around again
+        deferred.swap(released_slots);
+        released_slots.clear();
+    }
+
+}
@@ -8,29 +8,91 @@
 #include <rendering/commands/DrawRenderCommands.h>
 #include <rendering/commands/RenderPassCommands.h>
 
-#include "core/Application.h"
+#include "debug/Profiler.h"
+#include "debug/FrameCounters.h"
 #include "debug/ImGuiLayer.h"
 #include "rendering/renderpass/RenderPass.h"
+#include "platform/Vulkan/VulkanGpuProfiler.h"
+#include "platform/Vulkan/VulkanFramebuffer.h"
+#include "platform/Vulkan/VulkanAttachmentInfo.h"
 #include "platform/Vulkan/VulkanRecordedBuffer.h"
+#include "platform/Vulkan/VulkanUploadManager.h"
+#include "platform/Vulkan/VulkanBindlessTable.h"
 
 namespace nebula::rendering {
 
+    //  Pipeline stages and accesses touching image in given layout, used for dynamic rendering transitions
+    std::pair<VkPipelineStageFlags, VkAccessFlags> getLayoutSynchronization(const VkImageLayout layout, const VkImageAspectFlags aspect_mask)
+    {
+        constexpr VkPipelineStageFlags fragment_tests = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+        const bool color = aspect_mask & VK_IMAGE_ASPECT_COLOR_BIT;
+
+        switch (layout)
+        {
+            //  Has to wait on same stage swapchain image acquire semaphore waits on
+            case VK_IMAGE_LAYOUT_UNDEFINED:
+            case VK_IMAGE_LAYOUT_PRESENT_SRC_KHR:
+                return {color ? VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT : fragment_tests, 0};
+            case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:
+                return {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT};
+            case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:
+                return {fragment_tests, VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT};
+            case VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL:
+                return {fragment_tests | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_SHADER_READ_BIT};
+            case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
+                return {VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT};
+            case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:
+                return {VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_READ_BIT};
+            case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
+                return {VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT};
+            default:
+                return {VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT};
+        }
+    }
+
     ////////////////////////////////////////////////////////////////////
     //////  VulkanRecordCommandsVisitor  ///////////////////////////////
     ////////////////////////////////////////////////////////////////////
 
-    VulkanRecordCommandsVisitor::VulkanRecordCommandsVisitor(VkCommandBuffer command_buffer) : m_command_buffer(command_buffer) {}
+    VulkanRecordCommandsVisitor::VulkanRecordCommandsVisitor(VkCommandBuffer command_buffer, const uint32_t frame_in_flight) :
+            m_command_buffer(command_buffer),
+            m_frame_in_flight(frame_in_flight)
+    {}
+
+    void VulkanRecordCommandsVisitor::setCommandBuffer(VkCommandBuffer command_buffer, const uint32_t frame_in_flight)
+    {
+        m_command_buffer = command_buffer;
+        m_frame_in_flight = frame_in_flight;
+    }
 
-    Scope<RecordedCommandBuffer> VulkanRecordCommandsVisitor::recordCommands(Scope<RenderCommandBuffer>&& commands)
+    void VulkanRecordCommandsVisitor::recordCommands(const RenderCommandBuffer& commands)
     {
         startRecording();
 
-        for (const auto command : commands->viewCommands())
+        for (const auto command : commands.viewCommands())
             command->accept(*this);
 
         endRecording();
+    }
+
+    void VulkanRecordCommandsVisitor::recordCommands(
+        const std::vector<RenderCommand*>& structure_commands,
+        const std::span<const std::span<const VkCommandBuffer>> stage_command_buffers,
+        VulkanCommandPool& command_pool
+    )
+    {
+        m_stage_command_buffers = stage_command_buffers;
+        m_command_pool = &command_pool;
+
+        startRecording();
+
+        for (const auto command : structure_commands)
+            command->accept(*this);
 
-        return createScope<VulkanRecordedBuffer>(m_command_buffer);
+        endRecording();
+
+        m_stage_command_buffers = {};
+        m_command_pool = nullptr;
     }
 
     void VulkanRecordCommandsVisitor::startRecording() const
@@ -58,14 +120,39 @@ namespace nebula::rendering {
     void VulkanRecordCommandsVisitor::visit(BeginRenderPassCommand& command)
     {
         RenderPass& renderpass = command.renderpass;
+
+        if (VulkanAPI::checkDynamicRendering())
+        {
+            const auto& framebuffer_template = renderpass.viewFramebufferTemplate();
+
+            m_rendering_renderpass = &renderpass;
+            m_rendering_area.offset = {command.render_area.x_offset, command.render_area.y_offset};
+            m_rendering_area.extent = {command.render_area.width, command.render_area.height};
+            m_rendering_stage.reset();
+            m_stage_count = 0;
+
+            m_attachment_layouts.clear();
+            for (const auto& attachment_description : framebuffer_template->viewTextureAttachmentsDescriptions())
+                m_attachment_layouts.push_back(getVulkanAttachmentLayout(attachment_description.initial_layout));
+            if (framebuffer_template->hasDepthStencilAttachment())
+                m_attachment_layouts.push_back(getVulkanAttachmentLayout(framebuffer_template->viewDepthStencilAttachmentDescription()->initial_layout));
+            m_attachment_loaded.assign(m_attachment_layouts.size(), false);
+
+            if (VulkanGpuProfiler::checkEnabled())
+                VulkanGpuProfiler::get().beginPass(m_command_buffer, m_frame_in_flight);
+
+            //  Rendering starts with first RenderStage pipeline bind
+            return;
+        }
+
         const ClearColor clear_color = renderpass.getClearColor();
         const auto& framebuffer_template = renderpass.viewFramebufferTemplate();
 
-        std::vector<VkClearValue> clear_values(framebuffer_template->getAttachmentCount());
+        m_clear_values.resize(framebuffer_template->getAttachmentCount());
         for (uint32_t i = 0; i < framebuffer_template->getAttachmentCount(); ++i)
-            clear_values[i].color = {clear_color.color.r, clear_color.color.g, clear_color.color.b, clear_color.color.a};
+            m_clear_values[i].color = {clear_color.color.r, clear_color.color.g, clear_color.color.b, clear_color.color.a};
         if (framebuffer_template->hasDepthStencilAttachment())
-            clear_values.back().depthStencil = {clear_color.depth_stencil.r, static_cast<uint32_t>(clear_color.depth_stencil.g)};
+            m_clear_values.back().depthStencil = {clear_color.depth_stencil.r, static_cast<uint32_t>(clear_color.depth_stencil.g)};
 
         VkRenderPassBeginInfo begin_info = {};
         begin_info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
@@ -78,21 +165,139 @@ namespace nebula::rendering {
         begin_info.framebuffer = static_cast<VkFramebuffer>(renderpass.getFramebufferHandle());
 
         //  Clear values
-        begin_info.clearValueCount = clear_values.size();
-        begin_info.pClearValues = clear_values.data();
+        begin_info.clearValueCount = m_clear_values.size();
+        begin_info.pClearValues = m_clear_values.data();
+
+        if (VulkanGpuProfiler::checkEnabled())
+            VulkanGpuProfiler::get().beginPass(m_command_buffer, m_frame_in_flight);
 
-        vkCmdBeginRenderPass(m_command_buffer, &begin_info, VK_SUBPASS_CONTENTS_INLINE);
+        m_timestamp_inheritance_info = {};
+        m_timestamp_inheritance_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        m_timestamp_inheritance_info.renderPass = begin_info.renderPass;
+        m_timestamp_inheritance_info.framebuffer = begin_info.framebuffer;
+
+        m_stage_count = 0;
+        vkCmdBeginRenderPass(m_command_buffer, &begin_info, getSubpassContents());
     }
 
     void VulkanRecordCommandsVisitor::visit(EndRenderPassCommand& command)
     {
+        if (m_rendering_renderpass)
+        {
+            endRenderingStage();
+
+            //  Same final layouts VkRenderPass would transition to
+            const auto& framebuffer_template = m_rendering_renderpass->viewFramebufferTemplate();
+            const auto& texture_attachments = framebuffer_template->viewTextureAttachmentsDescriptions();
+
+            m_transitions.clear();
+            for (uint32_t i = 0; i < texture_attachments.size(); ++i)
+                m_transitions.emplace_back(i, getVulkanAttachmentLayout(texture_attachments[i].final_layout));
+            if (framebuffer_template->hasDepthStencilAttachment())
+                m_transitions.emplace_back(texture_attachments.size(), getVulkanAttachmentLayout(framebuffer_template->viewDepthStencilAttachmentDescription()->final_layout));
+            transitionAttachments();
+
+            if (VulkanGpuProfiler::checkEnabled())
+                VulkanGpuProfiler::get().endPass(m_command_buffer, m_frame_in_flight);
+
+            m_rendering_renderpass = nullptr;
+            return;
+        }
+
+        if (VulkanGpuProfiler::checkEnabled())
+            VulkanGpuProfiler::get().endStage(m_command_buffer, m_frame_in_flight);
+
         vkCmdEndRenderPass(m_command_buffer);
+
+        if (VulkanGpuProfiler::checkEnabled())
+            VulkanGpuProfiler::get().endPass(m_command_buffer, m_frame_in_flight);
     }
 
     void VulkanRecordCommandsVisitor::visit(BindGraphicsPipelineCommand& command)
+    {
+        //  Every stage of RenderPass binds its pipeline once, so it also opens stage timing zone
+        const uint32_t stage = m_stage_count++;
+        if (m_rendering_renderpass)
+            beginRenderingStage();
+        else
+        {
+            if (stage > 0)
+                vkCmdNextSubpass(m_command_buffer, getSubpassContents());
+
+            //  Only vkCmdExecuteCommands is allowed inside subpass with secondary contents, such stages are timed in executeStageCommands
+            if (VulkanGpuProfiler::checkEnabled() && !checkSecondaryContents())
+                VulkanGpuProfiler::get().beginStage(m_command_buffer, m_frame_in_flight);
+        }
+
+        if (checkSecondaryContents())
+        {
+            executeStageCommands(stage);
+            return;
+        }
+
+        bindPipelineState(command);
+    }
+
+    void VulkanRecordCommandsVisitor::executeStageCommands(const uint32_t stage)
+    {
+        const auto& command_buffers = m_stage_command_buffers[stage];
+
+        //  Dynamic rendering stages are timed outside of vkCmdBeginRendering scope
+        if (!VulkanGpuProfiler::checkEnabled() || m_rendering_renderpass)
+        {
+            if (!command_buffers.empty())
+                vkCmdExecuteCommands(m_command_buffer, static_cast<uint32_t>(command_buffers.size()), command_buffers.data());
+            return;
+        }
+
+        //  Stage zone is closed within its own subpass, before vkCmdNextSubpass
+        m_stage_executions.clear();
+        m_stage_executions.push_back(recordStageTimestamp(stage, true));
+        m_stage_executions.insert(m_stage_executions.end(), command_buffers.begin(), command_buffers.end());
+        m_stage_executions.push_back(recordStageTimestamp(stage, false));
+
+        vkCmdExecuteCommands(m_command_buffer, static_cast<uint32_t>(m_stage_executions.size()), m_stage_executions.data());
+    }
+
+    VkCommandBuffer VulkanRecordCommandsVisitor::recordStageTimestamp(const uint32_t stage, const bool begin)
+    {
+        NB_CORE_ASSERT(m_command_pool, "Secondary contents require command pool!");
+
+        m_timestamp_inheritance_info.subpass = stage;
+
+        VkCommandBufferBeginInfo begin_info = {};
+        begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        begin_info.pNext = nullptr;
+        begin_info.pInheritanceInfo = &m_timestamp_inheritance_info;
+        begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+
+        const auto command_buffer = m_command_pool->getSecondaryCommandBuffer(m_frame_in_flight);
+        auto result = vkBeginCommandBuffer(command_buffer, &begin_info);
+        NB_CORE_ASSERT(result == VK_SUCCESS, "Failed to start recording secondary VulkanCommandBuffer!");
+
+        if (begin)
+            VulkanGpuProfiler::get().beginStage(command_buffer, m_frame_in_flight);
+        else
+            VulkanGpuProfiler::get().endStage(command_buffer, m_frame_in_flight);
+
+        result = vkEndCommandBuffer(command_buffer);
+        NB_CORE_ASSERT(result == VK_SUCCESS, "Failed to finish recording secondary VulkanCommandBuffer!");
+
+        return command_buffer;
+    }
+
+    void VulkanRecordCommandsVisitor::bindPipelineState(const BindGraphicsPipelineCommand& command)
     {
         VkPipeline graphics_pipeline = static_cast<VkPipeline>(command.graphics_pipeline_handle);
         vkCmdBindPipeline(m_command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphics_pipeline);
+        NB_COUNT(cPipelineBinds, 1);
+
+        //  Secondary command buffers start with pipeline bind and don't inherit vertex buffer bindings
+        m_bound_geometry_buffer = VK_NULL_HANDLE;
+
+        //  Bindless set stays bound across pipelines sharing its layout
+        if (command.graphics_pipeline_state.pipeline_layout.bindless)
+            VulkanBindlessTable::get().bind(m_command_buffer);
 
         VkViewport viewport = {};
         viewport.x = static_cast<float>(command.viewport.x_offset);
@@ -115,15 +320,7 @@ namespace nebula::rendering {
 
     void VulkanRecordCommandsVisitor::visit(DrawImGuiCommand& command)
     {
-        if (Application::get().closed())
-            return;
-
-        ImGuiLayer::begin();
-
-        for (const auto& layer : Application::get().m_layer_stack)
-            layer->onImGuiRender();
-
-        ImGuiLayer::end(m_command_buffer);
+        ImGuiLayer::render(m_command_buffer);
     }
 
     //
@@ -133,31 +330,255 @@ namespace nebula::rendering {
     void VulkanRecordCommandsVisitor::visit(DrawDummyIndicesCommand& command)
     {
         vkCmdDraw(m_command_buffer, command.num_indices, 1, 0, 0);
+        NB_COUNT(cDrawCalls, 1);
+    }
+
+    void VulkanRecordCommandsVisitor::visit(DrawMeshCommand& command)
+    {
+        VkBuffer geometry_buffer = static_cast<VkBuffer>(command.geometry_buffer_handle);
+        if (geometry_buffer != m_bound_geometry_buffer)
+        {
+            constexpr VkDeviceSize offset = 0;
+            vkCmdBindVertexBuffers(m_command_buffer, 0, 1, &geometry_buffer, &offset);
+            vkCmdBindIndexBuffer(m_command_buffer, geometry_buffer, 0, VK_INDEX_TYPE_UINT32);
+            m_bound_geometry_buffer = geometry_buffer;
+        }
+
+        vkCmdDrawIndexed(m_command_buffer, command.index_count, command.instance_count, command.first_index, command.vertex_offset, 0);
+        NB_COUNT(cDrawCalls, 1);
+    }
+
+    //
+    //  Dynamic rendering
+    //
+
+    void VulkanRecordCommandsVisitor::beginRenderingStage()
+    {
+        endRenderingStage();
+
+        const uint32_t stage = m_rendering_stage ? *m_rendering_stage + 1 : 0;
+        m_rendering_stage = stage;
+
+        const auto& render_stages = m_rendering_renderpass->viewRenderPassTemplate()->viewRenderStages();
+        const auto& framebuffer_template = m_rendering_renderpass->viewFramebufferTemplate();
+        const auto& texture_attachments = framebuffer_template->viewTextureAttachmentsDescriptions();
+        const auto* attachments = static_cast<VulkanRenderingAttachments*>(m_rendering_renderpass->getFramebufferHandle());
+        const ClearColor clear_color = m_rendering_renderpass->getClearColor();
+
+        //  Attachment content has to be stored only if later stage uses it
+        auto used_later = [&](const uint32_t index)
+        {
+            for (uint32_t i = stage + 1; i < render_stages.size(); ++i)
+                for (const auto& attachment_reference : render_stages[i].attachment_references)
+                    if (attachment_reference.index == index && attachment_reference.type != AttachmentReferenceType::cPreserve)
+                        return true;
+            return false;
+        };
+
+        m_transitions.clear();
+        m_color_attachments.clear();
+        std::optional<VkRenderingAttachmentInfo> depth_attachment{};
+        std::optional<VkRenderingAttachmentInfo> stencil_attachment{};
+
+        for (const auto& [index, layout, type] : render_stages[stage].attachment_references)
+        {
+            if (type == AttachmentReferenceType::cPreserve)
+                continue;
+
+            //  Input attachments are read as textures, they only need layout transition
+            m_transitions.emplace_back(index, getVulkanAttachmentLayout(layout));
+            if (type == AttachmentReferenceType::cInput)
+                continue;
+
+            const bool depth_stencil = index >= texture_attachments.size();
+            const auto& description = depth_stencil ? *framebuffer_template->viewDepthStencilAttachmentDescription() : texture_attachments[index];
+            const bool store = used_later(index);
+
+            VkRenderingAttachmentInfo attachment_info = {};
+            attachment_info.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO;
+            attachment_info.imageView = attachments->image_views[index];
+            attachment_info.imageLayout = getVulkanAttachmentLayout(layout);
+            attachment_info.resolveMode = VK_RESOLVE_MODE_NONE;
+            attachment_info.loadOp = m_attachment_loaded[index] ? VK_ATTACHMENT_LOAD_OP_LOAD : getVulkanAttachmentLoadOp(description.load_op);
+            attachment_info.storeOp = store ? VK_ATTACHMENT_STORE_OP_STORE : getVulkanAttachmentStoreOp(description.store_op);
+
+            if (!depth_stencil)
+            {
+                attachment_info.clearValue.color = {clear_color.color.r, clear_color.color.g, clear_color.color.b, clear_color.color.a};
+                m_color_attachments.push_back(attachment_info);
+            }
+            else
+            {
+                attachment_info.clearValue.depthStencil = {clear_color.depth_stencil.r, static_cast<uint32_t>(clear_color.depth_stencil.g)};
+                if (formatHasDepth(description.format))
+                    depth_attachment = attachment_info;
+
+                if (formatHasStencil(description.format))
+                {
+                    stencil_attachment = attachment_info;
+                    stencil_attachment->loadOp = m_attachment_loaded[index] ? VK_ATTACHMENT_LOAD_OP_LOAD : getVulkanAttachmentLoadOp(description.stencil_load_op);
+                    stencil_attachment->storeOp = store ? VK_ATTACHMENT_STORE_OP_STORE : getVulkanAttachmentStoreOp(description.stencil_store_op);
+                }
+            }
+
+            m_attachment_loaded[index] = true;
+        }
+
+        transitionAttachments();
+
+        if (VulkanGpuProfiler::checkEnabled())
+            VulkanGpuProfiler::get().beginStage(m_command_buffer, m_frame_in_flight);
+
+        VkRenderingInfo rendering_info = {};
+        rendering_info.sType = VK_STRUCTURE_TYPE_RENDERING_INFO;
+        rendering_info.renderArea = m_rendering_area;
+        rendering_info.layerCount = framebuffer_template->getLayers();
+        rendering_info.colorAttachmentCount = static_cast<uint32_t>(m_color_attachments.size());
+        rendering_info.pColorAttachments = m_color_attachments.data();
+        rendering_info.pDepthAttachment = depth_attachment ? &*depth_attachment : nullptr;
+        rendering_info.pStencilAttachment = stencil_attachment ? &*stencil_attachment : nullptr;
+        rendering_info.flags = checkSecondaryContents() ? VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT : 0;
+
+        vkCmdBeginRendering(m_command_buffer, &rendering_info);
+    }
+
+    void VulkanRecordCommandsVisitor::endRenderingStage()
+    {
+        if (!m_rendering_stage)
+            return;
+
+        vkCmdEndRendering(m_command_buffer);
+
+        //  Rendering scope with secondary contents doesn't allow inline commands, so both stage timestamps are written outside of it
+        if (VulkanGpuProfiler::checkEnabled())
+            VulkanGpuProfiler::get().endStage(m_command_buffer, m_frame_in_flight);
+    }
+
+    void VulkanRecordCommandsVisitor::transitionAttachments()
+    {
+        const auto& framebuffer_template = m_rendering_renderpass->viewFramebufferTemplate();
+        const auto& texture_attachments = framebuffer_template->viewTextureAttachmentsDescriptions();
+        const auto* attachments = static_cast<VulkanRenderingAttachments*>(m_rendering_renderpass->getFramebufferHandle());
+
+        m_barriers.clear();
+        VkPipelineStageFlags src_stages = 0;
+        VkPipelineStageFlags dst_stages = 0;
+
+        for (const auto [index, new_layout] : m_transitions)
+        {
+            const VkImageLayout old_layout = m_attachment_layouts[index];
+            if (old_layout == new_layout)
+                continue;
+
+            VkImageAspectFlags aspect_mask = VK_IMAGE_ASPECT_COLOR_BIT;
+            if (index >= texture_attachments.size())
+            {
+                const auto format = framebuffer_template->viewDepthStencilAttachmentDescription()->format;
+                aspect_mask = (formatHasDepth(format) ? VK_IMAGE_ASPECT_DEPTH_BIT : 0) | (formatHasStencil(format) ? VK_IMAGE_ASPECT_STENCIL_BIT : 0);
+            }
+
+            const auto [src_stage, src_access] = getLayoutSynchronization(old_layout, aspect_mask);
+            const auto [dst_stage, dst_access] = getLayoutSynchronization(new_layout, aspect_mask);
+            src_stages |= src_stage;
+            dst_stages |= dst_stage;
+
+            VkImageMemoryBarrier barrier = {};
+            barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            barrier.srcAccessMask = src_access;
+            barrier.dstAccessMask = dst_access;
+            barrier.oldLayout = old_layout;
+            barrier.newLayout = new_layout;
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image = attachments->images[index];
+            barrier.subresourceRange = {aspect_mask, 0, 1, 0, framebuffer_template->getLayers()};
+
+            m_barriers.push_back(barrier);
+            m_attachment_layouts[index] = new_layout;
+        }
+
+        if (!m_barriers.empty())
+            vkCmdPipelineBarrier(m_command_buffer, src_stages, dst_stages, 0, 0, nullptr, 0, nullptr, static_cast<uint32_t>(m_barriers.size()), m_barriers.data());
+    }
+
+    ////////////////////////////////////////////////////////////////////
+    //////  VulkanRecordSecondaryCommandsVisitor  //////////////////////
+    ////////////////////////////////////////////////////////////////////
+
+    VulkanRecordSecondaryCommandsVisitor::VulkanRecordSecondaryCommandsVisitor(
+        VkCommandBuffer command_buffer,
+        const uint32_t frame_in_flight,
+        const VkCommandBufferInheritanceInfo& inheritance_info
+    ) :
+            VulkanRecordCommandsVisitor(command_buffer, frame_in_flight),
+            m_inheritance_info(inheritance_info)
+    {}
+
+    void VulkanRecordSecondaryCommandsVisitor::recordChunk(BindGraphicsPipelineCommand& bind_command, const std::span<RenderCommand* const> commands)
+    {
+        VkCommandBufferBeginInfo begin_info = {};
+        begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        begin_info.pNext = nullptr;
+        begin_info.pInheritanceInfo = &m_inheritance_info;
+        begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+
+        const auto result = vkBeginCommandBuffer(m_command_buffer, &begin_info);
+        NB_CORE_ASSERT(result == VK_SUCCESS, "Failed to start recording secondary VulkanCommandBuffer!");
+
+        bind_command.accept(*this);
+        for (const auto command : commands)
+            command->accept(*this);
+
+        endRecording();
+    }
+
+    void VulkanRecordSecondaryCommandsVisitor::visit(BindGraphicsPipelineCommand& command)
+    {
+        bindPipelineState(command);
     }
 
     ////////////////////////////////////////////////////////////////////
     //////  VulkanExecuteCommandsVisitor  //////////////////////////////
     ////////////////////////////////////////////////////////////////////
 
-    VulkanExecuteCommandsVisitor::VulkanExecuteCommandsVisitor(VulkanFrameSynchronization& frame_synchronization) :
-            m_frame_synchronization(frame_synchronization)
+    VulkanExecuteCommandsVisitor::VulkanExecuteCommandsVisitor(VulkanFrameSynchronization& frame_synchronization, const uint32_t frame_in_flight) :
+            m_frame_synchronization(frame_synchronization),
+            m_frame_in_flight(frame_in_flight)
     {}
 
-    void VulkanExecuteCommandsVisitor::executeCommands(Scope<RecordedCommandBuffer>&& commands)
+    void VulkanExecuteCommandsVisitor::executeCommands(RecordedCommandBuffer& commands)
     {
-        m_vulkan_commands.push_back(static_cast<VkCommandBuffer>(commands->getBufferHandle()));
+        m_vulkan_commands.push_back(static_cast<VkCommandBuffer>(commands.getBufferHandle()));
     }
 
     void VulkanExecuteCommandsVisitor::submitCommands()
     {
+        NB_PROFILE_FUNCTION();
+
+        //  Ownership of finished uploads is acquired before any frame commands execute
+        auto& upload_manager = VulkanUploadManager::get();
+        const auto [acquire_commands, upload_wait_value] = upload_manager.acquireUploads(m_frame_in_flight);
+        if (acquire_commands != VK_NULL_HANDLE)
+            m_vulkan_commands.insert(m_vulkan_commands.begin(), acquire_commands);
+
+        const VkSemaphore wait_semaphores[] = {m_frame_synchronization.image_available, upload_manager.getTimelineSemaphore()};
+        const uint64_t wait_values[] = {0, upload_wait_value};
+        constexpr VkPipelineStageFlags wait_stages[] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT};
+        const uint32_t wait_count = upload_wait_value > 0 ? 2 : 1;
+
+        //  Upload batch has already completed, wait only orders ownership transfer
+        VkTimelineSemaphoreSubmitInfo timeline_info = {};
+        timeline_info.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        timeline_info.waitSemaphoreValueCount = wait_count;
+        timeline_info.pWaitSemaphoreValues = wait_values;
+
         VkSubmitInfo submit_info = {};
-        constexpr VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
 
         submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-        submit_info.pNext = nullptr;
-        submit_info.pWaitDstStageMask = &wait_stage;
-        submit_info.waitSemaphoreCount = 1;
-        submit_info.pWaitSemaphores = &m_frame_synchronization.image_available;
+        submit_info.pNext = upload_wait_value > 0 ? &timeline_info : nullptr;
+        submit_info.pWaitDstStageMask = wait_stages;
+        submit_info.waitSemaphoreCount = wait_count;
+        submit_info.pWaitSemaphores = wait_semaphores;
         submit_info.signalSemaphoreCount = 1;
         submit_info.pSignalSemaphores = &m_frame_synchronization.render_finished;
         submit_info.commandBufferCount = m_vulkan_commands.size();
@@ -166,8 +587,12 @@ namespace nebula::rendering {
         vkResetFences(VulkanAPI::getDevice(), 1, &m_frame_synchronization.frame_resources_free);
 
         const auto queues_info = VulkanAPI::getQueuesInfo();
+        std::lock_guard queue_lock{VulkanAPI::getQueueMutex()};
         const auto result = vkQueueSubmit(queues_info.graphics_queue, 1, &submit_info, m_frame_synchronization.frame_resources_free);
         NB_CORE_ASSERT(result == VK_SUCCESS, "Failed submitting render commands!");
+
+        //  Executor is reused by next frame with same frame in flight
+        m_vulkan_commands.clear();
     }
 
 }
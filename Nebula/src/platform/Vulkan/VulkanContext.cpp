@@ -9,11 +9,17 @@
 #include <platform/Vulkan/VulkanCommandsVisitor.h>
 
 #include "core/Assert.h"
+#include "core/Config.h"
 #include "core/Logging.h"
+#include "debug/Profiler.h"
 
 #include "platform/EngineConfiguration.h"
 #include "platform/Vulkan/VulkanAPI.h"
 #include "platform/Vulkan/VulkanSwapchain.h"
+#include "platform/Vulkan/VulkanDescriptors.h"
+#include "platform/Vulkan/VulkanGpuProfiler.h"
+#include "platform/Vulkan/VulkanBindlessTable.h"
+#include "platform/Vulkan/VulkanUploadManager.h"
 
 namespace nebula::rendering {
 
@@ -53,6 +59,24 @@ namespace nebula::rendering {
         reload();
 
         m_frame_synchronizations = std::vector<VulkanFrameSynchronization>(getFramesInFlightNumber());
+        for (uint32_t frame = 0; frame < getFramesInFlightNumber(); ++frame)
+            m_command_executors.push_back(createScope<VulkanExecuteCommandsVisitor>(m_frame_synchronizations[frame], frame));
+
+        m_upload_manager = createScope<VulkanUploadManager>(Config::getEngineSettings().memory.staging_buffer_size);
+
+        m_descriptor_layout_cache = createScope<VulkanDescriptorLayoutCache>();
+        m_descriptor_allocator = createScope<VulkanDescriptorAllocator>();
+
+        if (VulkanAPI::checkBindlessSupport())
+            m_bindless_table = createScope<VulkanBindlessTable>();
+
+        if (Config::getEngineSettings().rendering.gpu_profiler)
+        {
+            if (VulkanGpuProfiler::checkSupport())
+                m_gpu_profiler = createScope<VulkanGpuProfiler>();
+            else if constexpr (NEBULA_INITIALIZATION_VERBOSITY >= NEBULA_INITIALIZATION_VERBOSITY_LOW)
+                NB_CORE_WARN("Vulkan timestamp queries are not supported, GPU profiler is disabled");
+        }
 
         if constexpr (NEBULA_INITIALIZATION_VERBOSITY >= NEBULA_INITIALIZATION_VERBOSITY_LOW)
         {
@@ -67,6 +91,12 @@ namespace nebula::rendering {
 
     VulkanContext::~VulkanContext()
     {
+        m_gpu_profiler.reset();
+        m_bindless_table.reset();
+        m_descriptor_allocator.reset();
+        m_descriptor_layout_cache.reset();
+        m_upload_manager.reset();
+        m_command_executors.clear();
         m_frame_synchronizations.clear();
         m_swapchain.reset();
         m_vulkan_api.reset();
@@ -92,6 +122,8 @@ namespace nebula::rendering {
 
     void VulkanContext::presentImage()
     {
+        NB_PROFILE_FUNCTION();
+
         m_swapchain->presentImage(m_frame_synchronizations[getCurrentRenderFrame()].render_finished);
         m_current_render_frame = (m_current_render_frame + 1) % m_frames_in_flight_number;
     }
@@ -101,9 +133,9 @@ namespace nebula::rendering {
         return m_swapchain->getNextImage(m_frame_synchronizations[getCurrentRenderFrame()].image_available);
     }
 
-    Scope<ExecuteCommandVisitor> VulkanContext::getCommandExecutor()
+    ExecuteCommandVisitor& VulkanContext::getCommandExecutor()
     {
-        return createScope<VulkanExecuteCommandsVisitor>(m_frame_synchronizations[getCurrentRenderFrame()]);
+        return *m_command_executors[getCurrentRenderFrame()];
     }
 
     void VulkanContext::waitForFrameResources(const uint32_t frame)
@@ -111,6 +143,13 @@ namespace nebula::rendering {
         auto& frame_synchronization = m_frame_synchronizations[frame];
         std::lock_guard lock{frame_synchronization.mutex};  //  TODO: Check for deadlocks
         vkWaitForFences(VulkanAPI::getDevice(), 1, &frame_synchronization.frame_resources_free, VK_TRUE, UINT64_MAX);
+
+        //  Descriptor sets of this frame are no longer used by GPU
+        m_descriptor_allocator->reset(frame);
+        if (m_bindless_table)
+            m_bindless_table->onFrameCompleted(frame);
+        if (m_gpu_profiler)
+            m_gpu_profiler->onFrameCompleted(frame);
     }
 
     ApiInfo VulkanContext::getApiInfo() const
@@ -0,0 +1,311 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "platform/Vulkan/VulkanDescriptors.h"
+
+#include <format>
+#include <stdexcept>
+
+#include <boost/functional/hash.hpp>
+
+#include "core/Assert.h"
+#include "rendering/RenderContext.h"
+
+namespace nebula::rendering {
+
+    static constexpr uint32_t s_max_sets_per_pool = 4096;
+
+    //  Descriptors per set used to size new pools
+    static constexpr std::pair<VkDescriptorType, float> s_pool_ratios[] = {
+        {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 2.0f},
+        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1.0f},
+        {VK_DESCRIPTOR_TYPE_SAMPLER, 0.5f},
+        {VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 2.0f},
+        {VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 0.5f},
+        {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 4.0f},
+    };
+
+    VkDescriptorType getVulkanDescriptorType(const DescriptorType type)
+    {
+        switch (type)
+        {
+            case DescriptorType::cUniformBuffer:        return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            case DescriptorType::cStorageBuffer:        return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            case DescriptorType::cSampler:              return VK_DESCRIPTOR_TYPE_SAMPLER;
+            case DescriptorType::cSampledImage:         return VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+            case DescriptorType::cStorageImage:         return VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+            case DescriptorType::cCombinedImageSampler: return VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        }
+
+        return VK_DESCRIPTOR_TYPE_MAX_ENUM;
+    }
+
+    VkShaderStageFlags getVulkanDescriptorStages(const DescriptorStage stages)
+    {
+        VkShaderStageFlags vulkan_stages = 0;
+        if (stages & cVertexStage)
+            vulkan_stages |= VK_SHADER_STAGE_VERTEX_BIT;
+        if (stages & cFragmentStage)
+            vulkan_stages |= VK_SHADER_STAGE_FRAGMENT_BIT;
+
+        return vulkan_stages;
+    }
+
+    ////////////////////////////////////////////////////////////////////
+    //////  VulkanDescriptorLayoutCache  ///////////////////////////////
+    ////////////////////////////////////////////////////////////////////
+
+    VulkanDescriptorLayoutCache* VulkanDescriptorLayoutCache::s_instance = nullptr;
+
+    VulkanDescriptorLayoutCache::VulkanDescriptorLayoutCache()
+    {
+        NB_CORE_ASSERT(!s_instance, "Can have only one VulkanDescriptorLayoutCache!");
+        s_instance = this;
+    }
+
+    VulkanDescriptorLayoutCache::~VulkanDescriptorLayoutCache()
+    {
+        for (const auto& [_, layout] : m_layouts)
+            vkDestroyDescriptorSetLayout(VulkanAPI::getDevice(), layout, nullptr);
+
+        s_instance = nullptr;
+    }
+
+    VkDescriptorSetLayout VulkanDescriptorLayoutCache::getLayout(const DescriptorSetLayout& layout)
+    {
+        std::lock_guard lock{m_mutex};
+
+        if (const auto it = m_layouts.find(layout); it != m_layouts.end())
+            return it->second;
+
+        std::vector<VkDescriptorSetLayoutBinding> bindings;
+        bindings.reserve(layout.bindings.size());
+
+        for (const auto& [binding, count, type, stages] : layout.bindings)
+        {
+            VkDescriptorSetLayoutBinding layout_binding = {};
+            layout_binding.binding = binding;
+            layout_binding.descriptorCount = count;
+            layout_binding.descriptorType = getVulkanDescriptorType(type);
+            layout_binding.stageFlags = getVulkanDescriptorStages(stages);
+            layout_binding.pImmutableSamplers = nullptr;
+
+            bindings.push_back(layout_binding);
+        }
+
+        VkDescriptorSetLayoutCreateInfo create_info = {};
+        create_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        create_info.bindingCount = static_cast<uint32_t>(bindings.size());
+        create_info.pBindings = bindings.data();
+
+        VkDescriptorSetLayout descriptor_set_layout;
+        const auto result = vkCreateDescriptorSetLayout(VulkanAPI::getDevice(), &create_info, nullptr, &descriptor_set_layout);
+        NB_CORE_ASSERT(result == VK_SUCCESS, "Failed to create Vulkan DescriptorSetLayout!");
+
+        m_layouts.emplace(layout, descriptor_set_layout);
+        return descriptor_set_layout;
+    }
+
+    ////////////////////////////////////////////////////////////////////
+    //////  VulkanDescriptorBindings  //////////////////////////////////
+    ////////////////////////////////////////////////////////////////////
+
+    bool operator == (const VulkanDescriptorResource& lhs, const VulkanDescriptorResource& rhs)
+    {
+        return  lhs.binding == rhs.binding &&
+                lhs.type == rhs.type &&
+                lhs.buffer_info.buffer == rhs.buffer_info.buffer &&
+                lhs.buffer_info.offset == rhs.buffer_info.offset &&
+                lhs.buffer_info.range == rhs.buffer_info.range &&
+                lhs.image_info.imageView == rhs.image_info.imageView &&
+                lhs.image_info.sampler == rhs.image_info.sampler &&
+                lhs.image_info.imageLayout == rhs.image_info.imageLayout;
+    }
+
+    VulkanDescriptorBindings& VulkanDescriptorBindings::bindBuffer(
+        const uint32_t binding,
+        const VkDescriptorType type,
+        VkBuffer buffer,
+        const VkDeviceSize offset,
+        const VkDeviceSize range
+    )
+    {
+        auto& resource = m_resources.emplace_back();
+        resource.binding = binding;
+        resource.type = type;
+        resource.buffer_info = {buffer, offset, range};
+
+        boost::hash_combine(m_hash, binding);
+        boost::hash_combine(m_hash, buffer);
+        boost::hash_combine(m_hash, offset);
+        boost::hash_combine(m_hash, range);
+
+        return *this;
+    }
+
+    VulkanDescriptorBindings& VulkanDescriptorBindings::bindImage(
+        const uint32_t binding,
+        const VkDescriptorType type,
+        VkImageView image_view,
+        VkSampler sampler,
+        const VkImageLayout layout
+    )
+    {
+        auto& resource = m_resources.emplace_back();
+        resource.binding = binding;
+        resource.type = type;
+        resource.image_info = {sampler, image_view, layout};
+
+        boost::hash_combine(m_hash, binding);
+        boost::hash_combine(m_hash, image_view);
+        boost::hash_combine(m_hash, sampler);
+        boost::hash_combine(m_hash, layout);
+
+        return *this;
+    }
+
+    ////////////////////////////////////////////////////////////////////
+    //////  VulkanDescriptorAllocator  /////////////////////////////////
+    ////////////////////////////////////////////////////////////////////
+
+    VulkanDescriptorAllocator* VulkanDescriptorAllocator::s_instance = nullptr;
+
+    VulkanDescriptorAllocator::VulkanDescriptorAllocator()
+    {
+        NB_CORE_ASSERT(!s_instance, "Can have only one VulkanDescriptorAllocator!");
+        s_instance = this;
+
+        m_frame_pools.resize(RenderContext::get().getFramesInFlightNumber());
+    }
+
+    VulkanDescriptorAllocator::~VulkanDescriptorAllocator()
+    {
+        for (const auto& frame_pools : m_frame_pools)
+            for (const auto pool : frame_pools.pools)
+                vkDestroyDescriptorPool(VulkanAPI::getDevice(), pool, nullptr);
+
+        s_instance = nullptr;
+    }
+
+    VkDescriptorSet VulkanDescriptorAllocator::getDescriptorSet(
+        const uint32_t frame_in_flight,
+        VkDescriptorSetLayout layout,
+        const VulkanDescriptorBindings& bindings
+    )
+    {
+        NB_CORE_ASSERT(frame_in_flight < m_frame_pools.size());
+        auto& set_cache = m_frame_pools[frame_in_flight].set_cache;
+
+        std::size_t key = bindings.getHash();
+        boost::hash_combine(key, layout);
+
+        const auto it = set_cache.find(key);
+        if (it != set_cache.end() && it->second.layout == layout && it->second.resources == bindings.viewResources())
+            return it->second.descriptor_set;
+
+        VkDescriptorSet descriptor_set = allocate(frame_in_flight, layout);
+
+        const auto& resources = bindings.viewResources();
+        std::vector<VkWriteDescriptorSet> writes(resources.size());
+        for (uint32_t i = 0; i < resources.size(); ++i)
+        {
+            const auto& resource = resources[i];
+            const bool image_resource = resource.image_info.imageView != VK_NULL_HANDLE || resource.image_info.sampler != VK_NULL_HANDLE;
+
+            writes[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writes[i].dstSet = descriptor_set;
+            writes[i].dstBinding = resource.binding;
+            writes[i].dstArrayElement = 0;
+            writes[i].descriptorCount = 1;
+            writes[i].descriptorType = resource.type;
+            writes[i].pBufferInfo = image_resource ? nullptr : &resource.buffer_info;
+            writes[i].pImageInfo = image_resource ? &resource.image_info : nullptr;
+        }
+
+        vkUpdateDescriptorSets(VulkanAPI::getDevice(), static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+
+        //  On hash collision keep the older entry, new set is still valid for this draw
+        if (it == set_cache.end())
+            set_cache.emplace(key, CachedSet{layout, resources, descriptor_set});
+
+        return descriptor_set;
+    }
+
+    VkDescriptorSet VulkanDescriptorAllocator::allocate(const uint32_t frame_in_flight, VkDescriptorSetLayout layout)
+    {
+        NB_CORE_ASSERT(frame_in_flight < m_frame_pools.size());
+        auto& frame_pools = m_frame_pools[frame_in_flight];
+
+        VkDescriptorSetAllocateInfo allocate_info = {};
+        allocate_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocate_info.descriptorSetCount = 1;
+        allocate_info.pSetLayouts = &layout;
+
+        VkDescriptorSet descriptor_set = VK_NULL_HANDLE;
+        allocate_info.descriptorPool = getPool(frame_pools);
+        auto result = vkAllocateDescriptorSets(VulkanAPI::getDevice(), &allocate_info, &descriptor_set);
+
+        //  Current pool is exhausted, next one is empty, so retry fails only if layout doesn't fit any pool
+        if (result == VK_ERROR_OUT_OF_POOL_MEMORY || result == VK_ERROR_FRAGMENTED_POOL)
+        {
+            ++frame_pools.current_pool;
+            allocate_info.descriptorPool = getPool(frame_pools);
+            result = vkAllocateDescriptorSets(VulkanAPI::getDevice(), &allocate_info, &descriptor_set);
+        }
+
+        if (result != VK_SUCCESS)
+            throw std::runtime_error(std::format("Failed to allocate Vulkan DescriptorSet, VkResult {}!", static_cast<int32_t>(result)));
+
+        return descriptor_set;
+    }
+
+    void VulkanDescriptorAllocator::reset(const uint32_t frame_in_flight)
+    {
+        NB_CORE_ASSERT(frame_in_flight < m_frame_pools.size());
+        auto& frame_pools = m_frame_pools[frame_in_flight];
+
+        //  Only pools touched during the frame need resetting
+        const uint32_t used_pools = std::min<uint32_t>(frame_pools.current_pool + 1, frame_pools.pools.size());
+        for (uint32_t i = 0; i < used_pools; ++i)
+            vkResetDescriptorPool(VulkanAPI::getDevice(), frame_pools.pools[i], 0);
+
+        frame_pools.current_pool = 0;
+        frame_pools.set_cache.clear();
+    }
+
+    VkDescriptorPool VulkanDescriptorAllocator::getPool(FramePools& frame_pools)
+    {
+        if (frame_pools.current_pool < frame_pools.pools.size())
+            return frame_pools.pools[frame_pools.current_pool];
+
+        //  Pools grow geometrically so heavy frames settle on few pools
+        frame_pools.pools.push_back(createPool(m_sets_per_pool));
+        m_sets_per_pool = std::min(m_sets_per_pool * 2, s_max_sets_per_pool);
+
+        return frame_pools.pools.back();
+    }
+
+    VkDescriptorPool VulkanDescriptorAllocator::createPool(const uint32_t max_sets) const
+    {
+        std::vector<VkDescriptorPoolSize> pool_sizes;
+        pool_sizes.reserve(std::size(s_pool_ratios));
+        for (const auto& [type, ratio] : s_pool_ratios)
+            pool_sizes.push_back({type, static_cast<uint32_t>(ratio * static_cast<float>(max_sets))});
+
+        VkDescriptorPoolCreateInfo create_info = {};
+        create_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        create_info.flags = 0;
+        create_info.maxSets = max_sets;
+        create_info.poolSizeCount = static_cast<uint32_t>(pool_sizes.size());
+        create_info.pPoolSizes = pool_sizes.data();
+
+        VkDescriptorPool descriptor_pool;
+        const auto result = vkCreateDescriptorPool(VulkanAPI::getDevice(), &create_info, nullptr, &descriptor_pool);
+        NB_CORE_ASSERT(result == VK_SUCCESS, "Failed to create Vulkan DescriptorPool!");
+
+        return descriptor_pool;
+    }
+
+}
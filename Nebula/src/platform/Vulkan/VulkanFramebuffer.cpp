@@ -17,6 +17,10 @@ namespace nebula::rendering {
 
         if (framebuffer_template->viewDepthStencilAttachmentDescription())
             createAttachment(*framebuffer_template->viewDepthStencilAttachmentDescription(), true);
+
+        m_rendering_attachments.image_views = m_image_views;
+        for (const auto& image_buffer : m_image_buffers)
+            m_rendering_attachments.images.push_back(image_buffer.image);
     }
 
     VulkanFramebuffer::~VulkanFramebuffer()
@@ -43,12 +47,15 @@ namespace nebula::rendering {
 
     bool VulkanFramebuffer::attached() const
     {
-        return m_framebuffer != VK_NULL_HANDLE;
+        return VulkanAPI::checkDynamicRendering() || m_framebuffer != VK_NULL_HANDLE;
     }
 
     void VulkanFramebuffer::attachTo(void* renderpass_handle)
     {
         NB_ASSERT(renderpass_handle, "Recieved null renderpass handle!");
+        if (VulkanAPI::checkDynamicRendering())
+            return;
+
         VkFramebufferCreateInfo create_info{};
 
         create_info.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
@@ -65,6 +72,8 @@ namespace nebula::rendering {
 
     void* VulkanFramebuffer::getFramebufferHandle()
     {
+        if (VulkanAPI::checkDynamicRendering())
+            return &m_rendering_attachments;
         return m_framebuffer;
     }
 
@@ -136,11 +145,15 @@ namespace nebula::rendering {
     ///////////////////////////////////////////////////////////////////////////////////
 
     VulkanSwapchainFramebuffer::VulkanSwapchainFramebuffer(
+        VkImage image,
         VkImageView image_view,
         const Reference<FramebufferTemplate>& swapchain_framebuffer_template
     ) :
             m_image_view(image_view), m_framebuffer_template(swapchain_framebuffer_template)
-    {}
+    {
+        m_rendering_attachments.images = {image};
+        m_rendering_attachments.image_views = {image_view};
+    }
 
     VulkanSwapchainFramebuffer::~VulkanSwapchainFramebuffer()
     {
@@ -157,12 +170,14 @@ namespace nebula::rendering {
 
     bool VulkanSwapchainFramebuffer::attached() const
     {
-        return m_framebuffer != VK_NULL_HANDLE;
+        return VulkanAPI::checkDynamicRendering() || m_framebuffer != VK_NULL_HANDLE;
     }
 
     void VulkanSwapchainFramebuffer::attachTo(void* renderpass_handle)
     {
         NB_ASSERT(renderpass_handle);
+        if (VulkanAPI::checkDynamicRendering())
+            return;
 
         VkFramebufferCreateInfo create_info{};
         const VkImageView attachments[] = {m_image_view};
@@ -181,6 +196,8 @@ namespace nebula::rendering {
 
     void* VulkanSwapchainFramebuffer::getFramebufferHandle()
     {
+        if (VulkanAPI::checkDynamicRendering())
+            return &m_rendering_attachments;
         return m_framebuffer;
     }
 
@@ -0,0 +1,48 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "platform/Vulkan/VulkanGeometryBuffer.h"
+
+#include "core/Assert.h"
+
+namespace nebula::rendering {
+
+    VulkanGeometryBuffer::VulkanGeometryBuffer(const uint64_t size) : GeometryBuffer(size)
+    {
+        VkBufferCreateInfo buffer_create_info = {};
+        buffer_create_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        buffer_create_info.size = size;
+        buffer_create_info.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        buffer_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        VmaAllocationCreateInfo allocation_create_info = {};
+        allocation_create_info.usage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE;
+
+        const auto result = vmaCreateBuffer(VulkanAPI::getVmaAllocator(), &buffer_create_info, &allocation_create_info, &m_buffer.buffer, &m_buffer.allocation, nullptr);
+        NB_CORE_ASSERT(result == VK_SUCCESS, "Failed to create Vulkan geometry buffer!");
+    }
+
+    VulkanGeometryBuffer::~VulkanGeometryBuffer()
+    {
+        //  Pending copies still write into buffer
+        auto& upload_manager = VulkanUploadManager::get();
+        if (!upload_manager.checkCompleted(m_upload_ticket))
+            upload_manager.waitForTicket(m_upload_ticket);
+
+        vmaDestroyBuffer(VulkanAPI::getVmaAllocator(), m_buffer.buffer, m_buffer.allocation);
+    }
+
+    bool VulkanGeometryBuffer::checkUploaded(const MeshAllocation& mesh) const
+    {
+        return VulkanUploadManager::get().checkAvailable(UploadTicket{mesh.upload_ticket});
+    }
+
+    uint64_t VulkanGeometryBuffer::writeData(const uint64_t offset, const void* data, const uint64_t size)
+    {
+        m_upload_ticket = VulkanUploadManager::get().uploadBuffer(m_buffer.buffer, offset, data, size);
+        return m_upload_ticket.value;
+    }
+
+}
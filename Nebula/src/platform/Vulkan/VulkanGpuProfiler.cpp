@@ -0,0 +1,115 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "platform/Vulkan/VulkanGpuProfiler.h"
+
+#include "core/Assert.h"
+#include "rendering/RenderContext.h"
+
+namespace nebula::rendering {
+
+    VulkanGpuProfiler::VulkanGpuProfiler() : GpuProfiler(RenderContext::get().getFramesInFlightNumber())
+    {
+        NB_CORE_ASSERT(checkSupport(), "Vulkan graphics queue does not support timestamps!");
+
+        VkPhysicalDeviceProperties properties = {};
+        vkGetPhysicalDeviceProperties(VulkanAPI::getPhysicalDevice(), &properties);
+        m_nanoseconds_per_tick = properties.limits.timestampPeriod;
+
+        uint32_t queue_family_count = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(VulkanAPI::getPhysicalDevice(), &queue_family_count, nullptr);
+        std::vector<VkQueueFamilyProperties> queue_families(queue_family_count);
+        vkGetPhysicalDeviceQueueFamilyProperties(VulkanAPI::getPhysicalDevice(), &queue_family_count, queue_families.data());
+
+        const uint32_t valid_bits = queue_families[VulkanAPI::getQueuesInfo().graphics_family_index].timestampValidBits;
+        m_valid_bits_mask = valid_bits >= 64 ? UINT64_MAX : (1ull << valid_bits) - 1;
+
+        VkQueryPoolCreateInfo create_info = {};
+        create_info.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        create_info.queryType = VK_QUERY_TYPE_TIMESTAMP;
+        create_info.queryCount = cMaxQueriesPerFrame;
+
+        m_query_pools.resize(RenderContext::get().getFramesInFlightNumber());
+        for (auto& query_pool : m_query_pools)
+        {
+            const auto result = vkCreateQueryPool(VulkanAPI::getDevice(), &create_info, nullptr, &query_pool);
+            NB_CORE_ASSERT(result == VK_SUCCESS, "Failed to create Vulkan timestamp QueryPool!");
+        }
+    }
+
+    VulkanGpuProfiler::~VulkanGpuProfiler()
+    {
+        for (const auto query_pool : m_query_pools)
+            vkDestroyQueryPool(VulkanAPI::getDevice(), query_pool, nullptr);
+    }
+
+    bool VulkanGpuProfiler::checkSupport()
+    {
+        VkPhysicalDeviceProperties properties = {};
+        vkGetPhysicalDeviceProperties(VulkanAPI::getPhysicalDevice(), &properties);
+
+        uint32_t queue_family_count = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(VulkanAPI::getPhysicalDevice(), &queue_family_count, nullptr);
+        std::vector<VkQueueFamilyProperties> queue_families(queue_family_count);
+        vkGetPhysicalDeviceQueueFamilyProperties(VulkanAPI::getPhysicalDevice(), &queue_family_count, queue_families.data());
+
+        const auto& graphics_family = queue_families[VulkanAPI::getQueuesInfo().graphics_family_index];
+        return properties.limits.timestampPeriod > 0.0f && graphics_family.timestampValidBits > 0;
+    }
+
+    void VulkanGpuProfiler::beginPass(VkCommandBuffer command_buffer, const uint32_t frame_in_flight)
+    {
+        //  First pass of the frame resets whole pool, reset is not allowed inside VkRenderPass
+        if (viewFrameQueries(frame_in_flight).used_queries == 0)
+            vkCmdResetQueryPool(command_buffer, m_query_pools[frame_in_flight], 0, cMaxQueriesPerFrame);
+
+        if (const auto query = beginZone(frame_in_flight, false))
+            vkCmdWriteTimestamp(command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, m_query_pools[frame_in_flight], *query);
+    }
+
+    void VulkanGpuProfiler::endPass(VkCommandBuffer command_buffer, const uint32_t frame_in_flight)
+    {
+        endStage(command_buffer, frame_in_flight);
+
+        if (const auto query = endZone(frame_in_flight, false))
+            vkCmdWriteTimestamp(command_buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_query_pools[frame_in_flight], *query);
+    }
+
+    void VulkanGpuProfiler::beginStage(VkCommandBuffer command_buffer, const uint32_t frame_in_flight)
+    {
+        endStage(command_buffer, frame_in_flight);
+
+        if (const auto query = beginZone(frame_in_flight, true))
+            vkCmdWriteTimestamp(command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, m_query_pools[frame_in_flight], *query);
+    }
+
+    void VulkanGpuProfiler::endStage(VkCommandBuffer command_buffer, const uint32_t frame_in_flight)
+    {
+        if (const auto query = endZone(frame_in_flight, true))
+            vkCmdWriteTimestamp(command_buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_query_pools[frame_in_flight], *query);
+    }
+
+    void VulkanGpuProfiler::onFrameCompleted(const uint32_t frame_in_flight)
+    {
+        const uint32_t used_queries = viewFrameQueries(frame_in_flight).used_queries;
+        if (used_queries == 0)
+            return;
+
+        //  Fence is already signaled, VK_NOT_READY only happens when frame was never submitted
+        const auto result = vkGetQueryPoolResults(
+            VulkanAPI::getDevice(),
+            m_query_pools[frame_in_flight],
+            0, used_queries,
+            used_queries * sizeof(uint64_t), m_timestamps.data(), sizeof(uint64_t),
+            VK_QUERY_RESULT_64_BIT
+        );
+
+        if (result == VK_SUCCESS)
+            resolveFrame(frame_in_flight, m_timestamps.data(), m_nanoseconds_per_tick, m_valid_bits_mask);
+
+        resetFrame(frame_in_flight);
+    }
+
+}
@@ -11,6 +11,7 @@
 
 #include "core/Application.h"
 #include "rendering/RenderContext.h"
+#include "platform/Vulkan/VulkanTextureFormats.h"
 
 using namespace nebula::rendering;
 
@@ -44,7 +45,17 @@ namespace nebula {
         init_info.Allocator = nullptr;
         init_info.CheckVkResultFn = nullptr;
 
-        ImGui_ImplVulkan_Init(&init_info, static_cast<VkRenderPass>(m_renderpass.getRenderPassHandle()));
+        //  ImGui draws into first color attachment of its RenderStage
+        if (VulkanAPI::checkDynamicRendering())
+        {
+            const auto& texture_attachments = m_renderpass.viewFramebufferTemplate()->viewTextureAttachmentsDescriptions();
+
+            init_info.UseDynamicRendering = true;
+            init_info.ColorAttachmentFormat = getVulkanTextureFormat(texture_attachments.front().format);
+            ImGui_ImplVulkan_Init(&init_info, VK_NULL_HANDLE);
+        }
+        else
+            ImGui_ImplVulkan_Init(&init_info, static_cast<VkRenderPass>(m_renderpass.getRenderPassHandle()));
     }
 
     void VulkanImGuiBackend::onDetach()
@@ -52,17 +63,14 @@ namespace nebula {
         ImGui_ImplVulkan_Shutdown();
     }
 
-    void VulkanImGuiBackend::begin()
+    void VulkanImGuiBackend::newFrame()
     {
         ImGui_ImplVulkan_NewFrame();
     }
 
-    void VulkanImGuiBackend::end(void* command_buffer_handle)
+    void VulkanImGuiBackend::renderDrawData(ImDrawData& draw_data, void* command_buffer_handle)
     {
-        VkCommandBuffer vulkan_command_buffer = static_cast<VkCommandBuffer>(command_buffer_handle);
-
-        ImGui::Render();
-        ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), vulkan_command_buffer);
+        ImGui_ImplVulkan_RenderDrawData(&draw_data, static_cast<VkCommandBuffer>(command_buffer_handle));
     }
 
     void VulkanImGuiBackend::init()
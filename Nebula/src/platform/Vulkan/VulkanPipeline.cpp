@@ -5,36 +5,43 @@
 
 #include "platform/Vulkan/VulkanPipeline.h"
 
+#include <boost/functional/hash.hpp>
+
 #include "core/Logging.h"
 #include "utility/Filesystem.h"
 #include "platform/EngineConfiguration.h"
+#include "platform/Vulkan/VulkanDescriptors.h"
+#include "platform/Vulkan/VulkanBindlessTable.h"
 #include "platform/Vulkan/VulkanConfiguration.h"
 #include "platform/Vulkan/VulkanTextureFormats.h"
 
 namespace nebula::rendering {
 
-    std::vector<VkDynamicState> getVulkanDynamicState(const DynamicState dynamic_state_flags)
+    uint32_t getVulkanDynamicState(const DynamicState dynamic_state_flags, std::array<VkDynamicState, VulkanGraphicsPipelineInfo::cMaxDynamicStates>& dynamic_state)
     {
-        static std::vector s_dynamic_state_flags = {cViewport, cScissor, cLineWidth, cDepthBias, cStencilMask, cBlendConstant};
-        std::vector<VkDynamicState> dynamic_state;
+        static constexpr std::array s_dynamic_state_flags = {cViewport, cScissor, cLineWidth, cDepthBias, cStencilMask, cBlendConstant};
+
+        uint32_t count = 0;
         for (const DynamicState flag : s_dynamic_state_flags)
         {
             if (dynamic_state_flags & flag)
             {
                 switch (flag)
                 {
-                    case cViewport:         dynamic_state.push_back(VK_DYNAMIC_STATE_VIEWPORT);         break;
-                    case cScissor:          dynamic_state.push_back(VK_DYNAMIC_STATE_SCISSOR);          break;
-                    case cLineWidth:        dynamic_state.push_back(VK_DYNAMIC_STATE_LINE_WIDTH);       break;
-                    case cDepthBias:        dynamic_state.push_back(VK_DYNAMIC_STATE_DEPTH_BIAS);       break;
-                    case cBlendConstant:    dynamic_state.push_back(VK_DYNAMIC_STATE_BLEND_CONSTANTS);  break;
+                    case cViewport:         dynamic_state[count++] = VK_DYNAMIC_STATE_VIEWPORT;         break;
+                    case cScissor:          dynamic_state[count++] = VK_DYNAMIC_STATE_SCISSOR;          break;
+                    case cLineWidth:        dynamic_state[count++] = VK_DYNAMIC_STATE_LINE_WIDTH;       break;
+                    case cDepthBias:        dynamic_state[count++] = VK_DYNAMIC_STATE_DEPTH_BIAS;       break;
+                    case cBlendConstant:    dynamic_state[count++] = VK_DYNAMIC_STATE_BLEND_CONSTANTS;  break;
                     case cStencilMask:
-                        dynamic_state.insert(dynamic_state.end(), {VK_DYNAMIC_STATE_STENCIL_WRITE_MASK, VK_DYNAMIC_STATE_STENCIL_COMPARE_MASK});    break;
+                        dynamic_state[count++] = VK_DYNAMIC_STATE_STENCIL_WRITE_MASK;
+                        dynamic_state[count++] = VK_DYNAMIC_STATE_STENCIL_COMPARE_MASK;
+                        break;
                 }
             }
         }
 
-        return dynamic_state;
+        return count;
     }
 
     VkPrimitiveTopology getVulkanTopology(const GeometryTopology topology)
@@ -84,20 +91,91 @@ namespace nebula::rendering {
         return VK_FRONT_FACE_COUNTER_CLOCKWISE;
     }
 
+    VkBlendFactor getVulkanBlendFactor(const BlendFactor blend_factor)
+    {
+        switch (blend_factor)
+        {
+            case BlendFactor::cZero:                    return VK_BLEND_FACTOR_ZERO;
+            case BlendFactor::cOne:                     return VK_BLEND_FACTOR_ONE;
+            case BlendFactor::cSrcColor:                return VK_BLEND_FACTOR_SRC_COLOR;
+            case BlendFactor::cOneMinusSrcColor:        return VK_BLEND_FACTOR_ONE_MINUS_SRC_COLOR;
+            case BlendFactor::cDstColor:                return VK_BLEND_FACTOR_DST_COLOR;
+            case BlendFactor::cOneMinusDstColor:        return VK_BLEND_FACTOR_ONE_MINUS_DST_COLOR;
+            case BlendFactor::cSrcAlpha:                return VK_BLEND_FACTOR_SRC_ALPHA;
+            case BlendFactor::cOneMinusSrcAlpha:        return VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+            case BlendFactor::cDstAlpha:                return VK_BLEND_FACTOR_DST_ALPHA;
+            case BlendFactor::cOneMinusDstAlpha:        return VK_BLEND_FACTOR_ONE_MINUS_DST_ALPHA;
+            case BlendFactor::cConstantColor:           return VK_BLEND_FACTOR_CONSTANT_COLOR;
+            case BlendFactor::cOneMinusConstantColor:   return VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_COLOR;
+            case BlendFactor::cConstantAlpha:           return VK_BLEND_FACTOR_CONSTANT_ALPHA;
+            case BlendFactor::cOneMinusConstantAlpha:   return VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_ALPHA;
+            case BlendFactor::cSrcAlphaSaturate:        return VK_BLEND_FACTOR_SRC_ALPHA_SATURATE;
+        }
+
+        return VK_BLEND_FACTOR_MAX_ENUM;
+    }
+
+    VkBlendOp getVulkanBlendOperation(const BlendOperation blend_operation)
+    {
+        switch (blend_operation)
+        {
+            case BlendOperation::cAdd:              return VK_BLEND_OP_ADD;
+            case BlendOperation::cSubtract:         return VK_BLEND_OP_SUBTRACT;
+            case BlendOperation::cReverseSubtract:  return VK_BLEND_OP_REVERSE_SUBTRACT;
+            case BlendOperation::cMin:              return VK_BLEND_OP_MIN;
+            case BlendOperation::cMax:              return VK_BLEND_OP_MAX;
+        }
+
+        return VK_BLEND_OP_MAX_ENUM;
+    }
+
+    VkFormat getVulkanVertexFormat(const VertexFormat format)
+    {
+        switch (format)
+        {
+            case VertexFormat::cFloat:      return VK_FORMAT_R32_SFLOAT;
+            case VertexFormat::cFloat2:     return VK_FORMAT_R32G32_SFLOAT;
+            case VertexFormat::cFloat3:     return VK_FORMAT_R32G32B32_SFLOAT;
+            case VertexFormat::cFloat4:     return VK_FORMAT_R32G32B32A32_SFLOAT;
+            case VertexFormat::cHalf2:      return VK_FORMAT_R16G16_SFLOAT;
+            case VertexFormat::cHalf4:      return VK_FORMAT_R16G16B16A16_SFLOAT;
+            case VertexFormat::cSnorm16x2:  return VK_FORMAT_R16G16_SNORM;
+            case VertexFormat::cSnorm16x4:  return VK_FORMAT_R16G16B16A16_SNORM;
+            case VertexFormat::cUnorm16x2:  return VK_FORMAT_R16G16_UNORM;
+            case VertexFormat::cSnorm8x4:   return VK_FORMAT_R8G8B8A8_SNORM;
+            case VertexFormat::cUnorm8x4:   return VK_FORMAT_R8G8B8A8_UNORM;
+            case VertexFormat::cUint32:     return VK_FORMAT_R32_UINT;
+        }
+
+        return VK_FORMAT_UNDEFINED;
+    }
+
+    VkVertexInputRate getVulkanVertexInputRate(const VertexInputRate input_rate)
+    {
+        if (input_rate == VertexInputRate::cInstance)
+            return VK_VERTEX_INPUT_RATE_INSTANCE;
+        return VK_VERTEX_INPUT_RATE_VERTEX;
+    }
+
     VulkanGraphicsPipelineInfo::VulkanGraphicsPipelineInfo(const GraphicsPipelineState& graphics_pipeline_state)
     {
         //  DynamicState
-        m_dynamic_states = getVulkanDynamicState(graphics_pipeline_state.dynamic_state_flags);
         m_dynamic_state_create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
-        m_dynamic_state_create_info.dynamicStateCount = static_cast<uint32_t>(m_dynamic_states.size());
+        m_dynamic_state_create_info.dynamicStateCount = getVulkanDynamicState(graphics_pipeline_state.dynamic_state_flags, m_dynamic_states);
         m_dynamic_state_create_info.pDynamicStates = m_dynamic_states.data();
 
         //  VertexInput
+        const auto& vertex_layout = graphics_pipeline_state.vertex_layout;
+        for (const auto& [binding, stride, input_rate] : vertex_layout.bindings)
+            m_vertex_bindings.push_back({binding, stride, getVulkanVertexInputRate(input_rate)});
+        for (const auto& [location, binding, format, offset] : vertex_layout.attributes)
+            m_vertex_attributes.push_back({location, binding, getVulkanVertexFormat(format), offset});
+
         m_vertex_create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-        m_vertex_create_info.vertexBindingDescriptionCount = 0;
-        m_vertex_create_info.pVertexBindingDescriptions = nullptr; // Optional
-        m_vertex_create_info.vertexAttributeDescriptionCount = 0;
-        m_vertex_create_info.pVertexAttributeDescriptions = nullptr; // Optional
+        m_vertex_create_info.vertexBindingDescriptionCount = static_cast<uint32_t>(m_vertex_bindings.size());
+        m_vertex_create_info.pVertexBindingDescriptions = m_vertex_bindings.empty() ? nullptr : m_vertex_bindings.data();
+        m_vertex_create_info.vertexAttributeDescriptionCount = static_cast<uint32_t>(m_vertex_attributes.size());
+        m_vertex_create_info.pVertexAttributeDescriptions = m_vertex_attributes.empty() ? nullptr : m_vertex_attributes.data();
 
         //  InputAssembly
         m_assembly_create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
@@ -134,15 +212,16 @@ namespace nebula::rendering {
 
         //  DepthStencil    TODO: Implement!!!
 
-        //  ColorBlend      TODO: Implement!!!
+        //  ColorBlend
+        const auto& color_blending = graphics_pipeline_state.color_blending;
         m_color_blend_attachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
-        m_color_blend_attachment.blendEnable = graphics_pipeline_state.color_blending.enabled;
-        m_color_blend_attachment.srcColorBlendFactor = VK_BLEND_FACTOR_ONE; // Optional
-        m_color_blend_attachment.dstColorBlendFactor = VK_BLEND_FACTOR_ZERO; // Optional
-        m_color_blend_attachment.colorBlendOp = VK_BLEND_OP_ADD; // Optional
-        m_color_blend_attachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE; // Optional
-        m_color_blend_attachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO; // Optional
-        m_color_blend_attachment.alphaBlendOp = VK_BLEND_OP_ADD; // Optional
+        m_color_blend_attachment.blendEnable = color_blending.enabled;
+        m_color_blend_attachment.srcColorBlendFactor = getVulkanBlendFactor(color_blending.src_color_factor);
+        m_color_blend_attachment.dstColorBlendFactor = getVulkanBlendFactor(color_blending.dst_color_factor);
+        m_color_blend_attachment.colorBlendOp = getVulkanBlendOperation(color_blending.color_operation);
+        m_color_blend_attachment.srcAlphaBlendFactor = getVulkanBlendFactor(color_blending.src_alpha_factor);
+        m_color_blend_attachment.dstAlphaBlendFactor = getVulkanBlendFactor(color_blending.dst_alpha_factor);
+        m_color_blend_attachment.alphaBlendOp = getVulkanBlendOperation(color_blending.alpha_operation);
 
         m_color_blend_create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
         m_color_blend_create_info.logicOpEnable = VK_FALSE;
@@ -159,12 +238,24 @@ namespace nebula::rendering {
         if (std::holds_alternative<VertexShader>(shader_template))
             loadVertexShader(graphics_pipeline_state.shader, std::get<VertexShader>(shader_template));
 
-        //  PipelineLayout  TODO: Implement!!!
+        //  PipelineLayout
+        const auto& pipeline_layout = graphics_pipeline_state.pipeline_layout;
+        if (pipeline_layout.bindless)
+        {
+            NB_CORE_ASSERT(VulkanBindlessTable::checkEnabled(), "Bindless pipeline requires Vulkan descriptor indexing!");
+            m_descriptor_set_layouts.push_back(VulkanBindlessTable::get().getDescriptorSetLayout());
+            m_push_constant_range = VulkanBindlessTable::getPushConstantRange();
+        }
+
+        auto& layout_cache = VulkanDescriptorLayoutCache::get();
+        for (const auto& descriptor_set : pipeline_layout.descriptor_sets)
+            m_descriptor_set_layouts.push_back(layout_cache.getLayout(descriptor_set));
+
         m_pipeline_layout_create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-        m_pipeline_layout_create_info.setLayoutCount = 0; // Optional
-        m_pipeline_layout_create_info.pSetLayouts = nullptr; // Optional
-        m_pipeline_layout_create_info.pushConstantRangeCount = 0; // Optional
-        m_pipeline_layout_create_info.pPushConstantRanges = nullptr; // Optional
+        m_pipeline_layout_create_info.setLayoutCount = static_cast<uint32_t>(m_descriptor_set_layouts.size());
+        m_pipeline_layout_create_info.pSetLayouts = m_descriptor_set_layouts.data();
+        m_pipeline_layout_create_info.pushConstantRangeCount = pipeline_layout.bindless ? 1 : 0;
+        m_pipeline_layout_create_info.pPushConstantRanges = pipeline_layout.bindless ? &m_push_constant_range : nullptr;
 
         const auto result = vkCreatePipelineLayout(VulkanAPI::getDevice(), &m_pipeline_layout_create_info, nullptr, &m_pipeline_layout);
         NB_CORE_ASSERT(result == VK_SUCCESS, "Failed to create Vulkan PipelineLayout!");
@@ -204,6 +295,26 @@ namespace nebula::rendering {
         return pipeline_create_info;
     }
 
+    VkGraphicsPipelineCreateInfo VulkanGraphicsPipelineInfo::buildRenderingPipelineCreateInfo(const VulkanRenderingPipelineKey& key)
+    {
+        m_color_attachment_formats = key.color_formats;
+        m_color_blend_attachments.assign(m_color_attachment_formats.size(), m_color_blend_attachment);
+
+        m_color_blend_create_info.attachmentCount = static_cast<uint32_t>(m_color_blend_attachments.size());
+        m_color_blend_create_info.pAttachments = m_color_blend_attachments.data();
+
+        m_rendering_create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO;
+        m_rendering_create_info.colorAttachmentCount = static_cast<uint32_t>(m_color_attachment_formats.size());
+        m_rendering_create_info.pColorAttachmentFormats = m_color_attachment_formats.data();
+        m_rendering_create_info.depthAttachmentFormat = key.depth_format;
+        m_rendering_create_info.stencilAttachmentFormat = key.stencil_format;
+
+        auto pipeline_create_info = buildPipelineCreateInfo(VK_NULL_HANDLE, 0);
+        pipeline_create_info.pNext = &m_rendering_create_info;
+
+        return pipeline_create_info;
+    }
+
     void VulkanGraphicsPipelineInfo::loadVertexShader(View<Shader> shader, const VertexShader& shader_template)
     {
         VkPipelineShaderStageCreateInfo vertex_stage_info = {};
@@ -225,6 +336,53 @@ namespace nebula::rendering {
         m_shader_stages.emplace_back(fragment_stage_info);
     }
 
+    std::size_t VulkanRenderingPipelineKeyHash::operator() (const VulkanRenderingPipelineKey& key) const
+    {
+        std::size_t seed = GraphicsPipelineHash{}(key.graphics_pipeline_state);
+        for (const auto format : key.color_formats)
+            boost::hash_combine(seed, format);
+        boost::hash_combine(seed, key.depth_format);
+        boost::hash_combine(seed, key.stencil_format);
+
+        return seed;
+    }
+
+    VulkanRenderingPipelineKey createRenderingPipelineKey(const FramebufferTemplate& framebuffer_template, const RenderStage& render_stage)
+    {
+        VulkanRenderingPipelineKey key{render_stage.graphics_pipeline_state};
+        writeRenderingFormats(framebuffer_template, render_stage, key.color_formats, key.depth_format, key.stencil_format);
+
+        return key;
+    }
+
+    void writeRenderingFormats(
+        const FramebufferTemplate& framebuffer_template,
+        const RenderStage& render_stage,
+        std::vector<VkFormat>& color_formats,
+        VkFormat& depth_format,
+        VkFormat& stencil_format
+    )
+    {
+        color_formats.clear();
+        depth_format = VK_FORMAT_UNDEFINED;
+        stencil_format = VK_FORMAT_UNDEFINED;
+
+        const auto& texture_attachments = framebuffer_template.viewTextureAttachmentsDescriptions();
+        for (const auto& [index, layout, type] : render_stage.attachment_references)
+        {
+            if (type == AttachmentReferenceType::cColor)
+                color_formats.push_back(getVulkanTextureFormat(texture_attachments[index].format));
+            else if (type == AttachmentReferenceType::cDepthStencil)
+            {
+                const auto depth_stencil_format = framebuffer_template.viewDepthStencilAttachmentDescription()->format;
+                if (formatHasDepth(depth_stencil_format))
+                    depth_format = getVulkanTextureFormat(depth_stencil_format);
+                if (formatHasStencil(depth_stencil_format))
+                    stencil_format = getVulkanTextureFormat(depth_stencil_format);
+            }
+        }
+    }
+
     VulkanPipelineCache::VulkanPipelineCache(const std::string& cache_root) :
             m_cache_path(filesystem::createPath(cache_root, VULKAN_PIPELINE_CACHE_FILE).string())
     {
@@ -246,6 +404,8 @@ namespace nebula::rendering {
     {
         for (auto& [_, pipeline] : m_handle_map)
             vkDestroyPipeline(VulkanAPI::getDevice(), pipeline, nullptr);
+        for (auto& [_, pipeline] : m_rendering_pipelines)
+            vkDestroyPipeline(VulkanAPI::getDevice(), pipeline, nullptr);
 
         std::size_t cache_size;
         vkGetPipelineCacheData(VulkanAPI::getDevice(), m_pipeline_cache, &cache_size, nullptr);
@@ -262,6 +422,11 @@ namespace nebula::rendering {
     void VulkanPipelineCache::destroyPipeline(VkRenderPass renderpass, uint32_t subpass)
     {
         const auto key = std::make_pair(renderpass, subpass);
+
+        //  Dynamic rendering pipeline stays cached, so recreated RenderPass reuses it
+        if (m_rendering_handle_map.erase(key) > 0)
+            return;
+
         const auto pipeline = m_handle_map.at(key);
         vkDestroyPipeline(VulkanAPI::getDevice(), pipeline, nullptr);
         m_handle_map.erase(key);
@@ -269,7 +434,10 @@ namespace nebula::rendering {
 
     VkPipeline VulkanPipelineCache::getPipeline(VkRenderPass renderpass, uint32_t subpass) const
     {
-        return m_handle_map.at(std::make_pair(renderpass, subpass));
+        const auto key = std::make_pair(renderpass, subpass);
+        if (const auto it = m_rendering_handle_map.find(key); it != m_rendering_handle_map.end())
+            return it->second;
+        return m_handle_map.at(key);
     }
 
     void VulkanPipelineCache::addPipelines(VkRenderPass renderpass, std::vector<VkPipeline>&& pipelines)
@@ -282,4 +450,16 @@ namespace nebula::rendering {
         }
     }
 
+    VkPipeline VulkanPipelineCache::findRenderingPipeline(const VulkanRenderingPipelineKey& key) const
+    {
+        const auto it = m_rendering_pipelines.find(key);
+        return it != m_rendering_pipelines.end() ? it->second : VK_NULL_HANDLE;
+    }
+
+    void VulkanPipelineCache::addRenderingPipeline(VkRenderPass renderpass, const uint32_t subpass, const VulkanRenderingPipelineKey& key, VkPipeline pipeline)
+    {
+        m_rendering_pipelines.try_emplace(key, pipeline);
+        m_rendering_handle_map[std::make_pair(renderpass, subpass)] = pipeline;
+    }
+
 }
@@ -14,8 +14,10 @@ namespace nebula::rendering {
         const uint32_t frames_in_flight = RenderContext::get().getFramesInFlightNumber();
 
         m_cache_indices.resize(frames_in_flight, 0);
+        m_secondary_cache_indices.resize(frames_in_flight, 0);
         m_command_pools.resize(frames_in_flight, nullptr);
         m_cached_buffers.resize(frames_in_flight);
+        m_cached_secondary_buffers.resize(frames_in_flight);
 
         createPools();
     }
@@ -51,27 +53,43 @@ namespace nebula::rendering {
         NB_CORE_ASSERT(result == VK_SUCCESS, "Failed to reset VulkanCommandPool!");
 
         m_cache_indices[frame_in_flight] = 0;
+        m_secondary_cache_indices[frame_in_flight] = 0;
     }
 
     VkCommandBuffer VulkanCommandPool::getCommandBuffer(const uint32_t frame_in_flight)
     {
         NB_CORE_ASSERT(frame_in_flight < RenderContext::get().getFramesInFlightNumber());
+        return getCachedBuffer(frame_in_flight, VK_COMMAND_BUFFER_LEVEL_PRIMARY, m_cached_buffers[frame_in_flight], m_cache_indices[frame_in_flight]);
+    }
+
+    VkCommandBuffer VulkanCommandPool::getSecondaryCommandBuffer(const uint32_t frame_in_flight)
+    {
+        NB_CORE_ASSERT(frame_in_flight < RenderContext::get().getFramesInFlightNumber());
+        return getCachedBuffer(frame_in_flight, VK_COMMAND_BUFFER_LEVEL_SECONDARY, m_cached_secondary_buffers[frame_in_flight], m_secondary_cache_indices[frame_in_flight]);
+    }
 
-        if (m_cache_indices[frame_in_flight] == m_cached_buffers[frame_in_flight].size())
+    VkCommandBuffer VulkanCommandPool::getCachedBuffer(
+        const uint32_t frame_in_flight,
+        const VkCommandBufferLevel level,
+        CachedBuffers& cached_buffers,
+        uint32_t& cache_index
+    ) const
+    {
+        if (cache_index == cached_buffers.size())
         {
             VkCommandBufferAllocateInfo allocate_info = {};
             allocate_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
             allocate_info.pNext = nullptr;
             allocate_info.commandPool = m_command_pools[frame_in_flight];
             allocate_info.commandBufferCount = 1;
-            allocate_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            allocate_info.level = level;
 
-            m_cached_buffers[frame_in_flight].push_back(VK_NULL_HANDLE);
-            const auto result = vkAllocateCommandBuffers(VulkanAPI::getDevice(), &allocate_info, &m_cached_buffers[frame_in_flight].back());
+            cached_buffers.push_back(VK_NULL_HANDLE);
+            const auto result = vkAllocateCommandBuffers(VulkanAPI::getDevice(), &allocate_info, &cached_buffers.back());
             NB_CORE_ASSERT(result == VK_SUCCESS, "Failed to allocate VulkanCommandBuffer!");
         }
 
-        return m_cached_buffers[frame_in_flight][m_cache_indices[frame_in_flight]++];
+        return cached_buffers[cache_index++];
     }
 
 }
@@ -92,6 +92,10 @@ namespace nebula::rendering {
     VulkanRenderPass::VulkanRenderPass(const Reference<RenderPassTemplate>& renderpass_template, const bool create_framebuffer) :
         RenderPass(renderpass_template, create_framebuffer)
     {
+        //  Attachments are described at record time by vkCmdBeginRendering
+        if (VulkanAPI::checkDynamicRendering())
+            return;
+
         const auto& framebuffer_template = renderpass_template->viewFramebufferTemplate();
 
         const size_t n_subpasses = renderpass_template->viewRenderStages().size();
@@ -141,11 +145,15 @@ namespace nebula::rendering {
 
     VulkanRenderPass::~VulkanRenderPass()
     {
-        vkDestroyRenderPass(VulkanAPI::getDevice(), m_renderpass, nullptr);
+        if (m_renderpass)
+            vkDestroyRenderPass(VulkanAPI::getDevice(), m_renderpass, nullptr);
     }
 
     void* VulkanRenderPass::getRenderPassHandle()
     {
+        //  Without VkRenderPass object RenderPass itself identifies pipelines compiled for it
+        if (VulkanAPI::checkDynamicRendering())
+            return this;
         return m_renderpass;
     }
 
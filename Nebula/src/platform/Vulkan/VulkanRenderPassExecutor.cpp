@@ -5,33 +5,275 @@
 
 #include "platform/Vulkan/VulkanRenderPassExecutor.h"
 
+#include <span>
+
+#include "core/Config.h"
+#include "debug/Profiler.h"
+#include "threads/JobSystem.h"
+#include "rendering/commands/RenderPassCommands.h"
+
+#include "platform/Vulkan/VulkanPipeline.h"
 #include "platform/Vulkan/VulkanCommandsVisitor.h"
+#include "platform/Vulkan/VulkanTextureFormats.h"
 
 namespace nebula::rendering {
 
+    struct VulkanStageRecording
+    {
+        BindGraphicsPipelineCommand* bind_command = nullptr;
+        std::vector<RenderCommand*> commands{};
+        bool serial = false;    //  Has to be recorded on render thread
+
+        uint32_t first_chunk = 0;
+        uint32_t chunk_count = 0;
+
+        std::vector<VkFormat> color_formats{};
+        VkCommandBufferInheritanceRenderingInfo rendering_inheritance_info = {};
+        VkCommandBufferInheritanceInfo inheritance_info = {};
+    };
+
+    //  Splits commands into RenderPass structure recorded in primary buffer and contents of every RenderStage
+    class VulkanRenderStageSplitter final : public RenderCommandVisitor
+    {
+    public:
+        void split(const std::vector<RenderCommand*>& commands)
+        {
+            renderpass = nullptr;
+            renderpass_count = 0;
+            m_stage_count = 0;
+            structure_commands.clear();
+
+            for (const auto command : commands)
+            {
+                m_structure_command = false;
+                command->accept(*this);
+
+                if (m_structure_command)
+                    structure_commands.push_back(command);
+                else
+                {
+                    NB_CORE_ASSERT(m_stage_count > 0, "Render command recorded outside of RenderStage!");
+                    m_stages[m_stage_count - 1].commands.push_back(command);
+                }
+            }
+        }
+
+        void visit(BeginRenderPassCommand& command) override
+        {
+            renderpass = &command.renderpass;
+            ++renderpass_count;
+            m_structure_command = true;
+        }
+
+        void visit(EndRenderPassCommand& command) override
+        {
+            m_structure_command = true;
+        }
+
+        void visit(BindGraphicsPipelineCommand& command) override
+        {
+            //  Stage slots are recycled between frames, so their vectors keep capacity
+            if (m_stage_count == m_stages.size())
+                m_stages.emplace_back();
+
+            auto& stage = m_stages[m_stage_count++];
+            stage.bind_command = &command;
+            stage.commands.clear();
+            stage.serial = false;
+
+            m_structure_command = true;
+        }
+
+        //  ImGui backend render buffers are not thread safe
+        void visit(DrawImGuiCommand& command) override
+        {
+            m_stages[m_stage_count - 1].serial = true;
+        }
+
+        [[nodiscard]] std::span<VulkanStageRecording> viewStages() { return {m_stages.data(), m_stage_count}; }
+
+        RenderPass* renderpass = nullptr;
+        uint32_t renderpass_count = 0;
+
+        std::vector<RenderCommand*> structure_commands{};
+
+        //  Chunk scratch storage
+        std::vector<VkCommandBuffer> chunk_command_buffers{};
+        std::vector<std::pair<const VulkanStageRecording*, uint32_t>> parallel_chunks{};
+        std::vector<std::span<const VkCommandBuffer>> stage_command_buffers{};
+
+    private:
+        bool m_structure_command = false;
+
+        uint32_t m_stage_count = 0;
+        std::vector<VulkanStageRecording> m_stages{};
+    };
+
     VulkanRenderPassExecutor::VulkanRenderPassExecutor(Scope<Renderer>&& renderer) : RenderPassExecutor(std::move(renderer))
     {
-        m_command_pool = createScope<VulkanCommandPool>();
+        initRecording();
     }
 
     VulkanRenderPassExecutor::VulkanRenderPassExecutor(Scope<RenderPass>&& renderpass) : RenderPassExecutor(std::move(renderpass))
+    {
+        initRecording();
+    }
+
+    VulkanRenderPassExecutor::~VulkanRenderPassExecutor() = default;
+
+    void VulkanRenderPassExecutor::initRecording()
     {
         m_command_pool = createScope<VulkanCommandPool>();
+        m_command_recorder = createScope<VulkanRecordCommandsVisitor>(VK_NULL_HANDLE, 0);
+
+        const auto& rendering_settings = Config::getEngineSettings().rendering;
+        m_parallel_recording = rendering_settings.parallel_recording && threads::JobSystem::checkEnabled();
+        m_recording_chunk_size = std::max(rendering_settings.recording_chunk_size, 1u);
+
+        if (!m_parallel_recording)
+            return;
+
+        m_stage_splitter = createScope<VulkanRenderStageSplitter>();
+        for (uint32_t i = 0; i < threads::JobSystem::get().getThreadCount(); ++i)
+            m_thread_command_pools.push_back(createScope<VulkanCommandPool>());
     }
 
     void VulkanRenderPassExecutor::resetResources(uint32_t frame_in_flight)
     {
         m_command_pool->reset(frame_in_flight);
+        for (const auto& command_pool : m_thread_command_pools)
+            command_pool->reset(frame_in_flight);
     }
 
-    Scope<RecordedCommandBuffer> VulkanRenderPassExecutor::recordCommands(Scope<RenderCommandBuffer>&& commands, std::optional<uint32_t> frame_in_flight) const
+    RecordedCommandBuffer& VulkanRenderPassExecutor::recordCommands(Scope<RenderCommandBuffer>&& commands, std::optional<uint32_t> frame_in_flight)
     {
+        NB_PROFILE_FUNCTION();
+
         NB_ASSERT(frame_in_flight.has_value());
 
+        if (m_parallel_recording)
+            return recordCommandsParallel(std::move(commands), *frame_in_flight);
+
         const auto vulkan_command_buffer = m_command_pool->getCommandBuffer(*frame_in_flight);
-        const auto command_recorder = createScope<VulkanRecordCommandsVisitor>(vulkan_command_buffer);
+        m_command_recorder->setCommandBuffer(vulkan_command_buffer, *frame_in_flight);
+        m_command_recorder->recordCommands(*commands);
+
+        recycleCommandBuffer(std::move(commands));
+
+        m_recorded_buffer.setBufferHandle(vulkan_command_buffer);
+        return m_recorded_buffer;
+    }
+
+    RecordedCommandBuffer& VulkanRenderPassExecutor::recordCommandsParallel(Scope<RenderCommandBuffer>&& commands, const uint32_t frame_in_flight)
+    {
+        auto& splitter = *m_stage_splitter;
+        splitter.split(commands->viewCommands());
+
+        const auto stages = splitter.viewStages();
+
+        //  Split stages into chunks, serial stages are recorded as single chunk
+        uint32_t chunk_count = 0;
+        uint32_t parallel_chunk_count = 0;
+        for (auto& stage : stages)
+        {
+            const auto command_count = static_cast<uint32_t>(stage.commands.size());
+
+            stage.first_chunk = chunk_count;
+            stage.chunk_count = stage.serial ? 1 : (command_count + m_recording_chunk_size - 1) / m_recording_chunk_size;
+            chunk_count += stage.chunk_count;
+
+            if (!stage.serial)
+                parallel_chunk_count += stage.chunk_count;
+        }
+
+        const auto vulkan_command_buffer = m_command_pool->getCommandBuffer(frame_in_flight);
+        m_command_recorder->setCommandBuffer(vulkan_command_buffer, frame_in_flight);
+        m_recorded_buffer.setBufferHandle(vulkan_command_buffer);
+
+        //  Secondary command buffers only pay off when there is work to distribute
+        if (splitter.renderpass_count != 1 || parallel_chunk_count < 2)
+        {
+            m_command_recorder->recordCommands(*commands);
+            recycleCommandBuffer(std::move(commands));
+
+            return m_recorded_buffer;
+        }
+
+        RenderPass& renderpass = *splitter.renderpass;
+        const auto& framebuffer_template = renderpass.viewFramebufferTemplate();
+        const auto& render_stages = renderpass.viewRenderPassTemplate()->viewRenderStages();
+        const bool dynamic_rendering = VulkanAPI::checkDynamicRendering();
+
+        for (uint32_t i = 0; i < stages.size(); ++i)
+        {
+            auto& stage = stages[i];
+
+            stage.inheritance_info = {};
+            stage.inheritance_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+            if (dynamic_rendering)
+            {
+                auto& rendering_info = stage.rendering_inheritance_info;
+                rendering_info = {};
+                rendering_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO;
+
+                writeRenderingFormats(*framebuffer_template, render_stages[i], stage.color_formats, rendering_info.depthAttachmentFormat, rendering_info.stencilAttachmentFormat);
+                rendering_info.colorAttachmentCount = static_cast<uint32_t>(stage.color_formats.size());
+                rendering_info.pColorAttachmentFormats = stage.color_formats.data();
+                rendering_info.rasterizationSamples = getVulkanTextureSampling(stage.bind_command->graphics_pipeline_state.multisampling.samples);
+
+                stage.inheritance_info.pNext = &rendering_info;
+            }
+            else
+            {
+                stage.inheritance_info.renderPass = static_cast<VkRenderPass>(renderpass.getRenderPassHandle());
+                stage.inheritance_info.subpass = i;
+                stage.inheritance_info.framebuffer = static_cast<VkFramebuffer>(renderpass.getFramebufferHandle());
+            }
+        }
+
+        splitter.chunk_command_buffers.assign(chunk_count, VK_NULL_HANDLE);
+        auto record_chunk = [&](const VulkanStageRecording& stage, const uint32_t chunk, const uint32_t thread_index)
+        {
+            NB_PROFILE_SCOPE("RecordStageChunk");
+
+            const auto first_command = stage.commands.begin() + (stage.serial ? 0 : chunk * m_recording_chunk_size);
+            const auto last_command = stage.serial ? stage.commands.end() : first_command + std::min<std::size_t>(m_recording_chunk_size, stage.commands.end() - first_command);
+
+            const auto command_buffer = m_thread_command_pools[thread_index]->getSecondaryCommandBuffer(frame_in_flight);
+            VulkanRecordSecondaryCommandsVisitor command_recorder(command_buffer, frame_in_flight, stage.inheritance_info);
+            command_recorder.recordChunk(*stage.bind_command, {first_command, last_command});
+
+            splitter.chunk_command_buffers[stage.first_chunk + chunk] = command_buffer;
+        };
+
+        //  Render thread uses last JobSystem thread slot, it is never used concurrently with workers
+        auto& job_system = threads::JobSystem::get();
+        for (const auto& stage : stages)
+            if (stage.serial)
+                record_chunk(stage, 0, job_system.getThreadCount() - 1);
+
+        splitter.parallel_chunks.clear();
+        for (const auto& stage : stages)
+            if (!stage.serial)
+                for (uint32_t chunk = 0; chunk < stage.chunk_count; ++chunk)
+                    splitter.parallel_chunks.emplace_back(&stage, chunk);
+
+        //  Two references fit into std::function small buffer, so dispatch does not allocate
+        job_system.parallelFor(parallel_chunk_count, [&splitter, &record_chunk](const uint32_t job_index, const uint32_t thread_index)
+        {
+            const auto [stage, chunk] = splitter.parallel_chunks[job_index];
+            record_chunk(*stage, chunk, thread_index);
+        });
+
+        //  Stitch secondary command buffers into primary in submission order
+        splitter.stage_command_buffers.clear();
+        for (const auto& stage : stages)
+            splitter.stage_command_buffers.emplace_back(splitter.chunk_command_buffers.data() + stage.first_chunk, stage.chunk_count);
+
+        m_command_recorder->recordCommands(splitter.structure_commands, splitter.stage_command_buffers, *m_command_pool);
+        recycleCommandBuffer(std::move(commands));
 
-        return command_recorder->recordCommands(std::move(commands));
+        return m_recorded_buffer;
     }
 
 }
@@ -14,15 +14,18 @@ namespace nebula::rendering {
 
     VulkanRendererApi::VulkanRendererApi()
     {
-        auto& engine_config = Config::getEngineConfig();
-        const auto rendering_cache_path = engine_config["rendering"]["cache_path"].as<std::string>();
-
-        auto pipeline_cache_root = Application::getResourcesPath(true) / rendering_cache_path;
+        auto pipeline_cache_root = Application::getResourcesPath(true) / Config::getEngineSettings().rendering.cache_path;
         m_pipeline_cache = createScope<VulkanPipelineCache>(pipeline_cache_root.make_preferred().string());
     }
 
     void VulkanRendererApi::compilePipelines(RenderPass& renderpass)
     {
+        if (VulkanAPI::checkDynamicRendering())
+        {
+            compileRenderingPipelines(renderpass);
+            return;
+        }
+
         const auto& render_stages = renderpass.viewRenderPassTemplate()->viewRenderStages();
         const auto renderpass_handle = static_cast<VkRenderPass>(renderpass.getRenderPassHandle());
 
@@ -55,6 +58,31 @@ namespace nebula::rendering {
         m_pipeline_cache->addPipelines(renderpass_handle, std::move(graphic_pipelines));
     }
 
+    void VulkanRendererApi::compileRenderingPipelines(RenderPass& renderpass)
+    {
+        const auto& render_stages = renderpass.viewRenderPassTemplate()->viewRenderStages();
+        const auto& framebuffer_template = *renderpass.viewFramebufferTemplate();
+        const auto renderpass_handle = static_cast<VkRenderPass>(renderpass.getRenderPassHandle());
+
+        for (uint32_t i = 0; i < render_stages.size(); ++i)
+        {
+            const auto key = createRenderingPipelineKey(framebuffer_template, render_stages[i]);
+
+            //  Pipelines don't depend on framebuffer size, recreated RenderPass reuses them
+            VkPipeline graphics_pipeline = m_pipeline_cache->findRenderingPipeline(key);
+            if (graphics_pipeline == VK_NULL_HANDLE)
+            {
+                VulkanGraphicsPipelineInfo pipeline_info(key.graphics_pipeline_state);
+                const auto create_info = pipeline_info.buildRenderingPipelineCreateInfo(key);
+
+                const auto result = vkCreateGraphicsPipelines(VulkanAPI::getDevice(), m_pipeline_cache->getCache(), 1, &create_info, nullptr, &graphics_pipeline);
+                NB_CORE_ASSERT(result == VK_SUCCESS, "Failed to create Vulkan GraphicsPipeline for dynamic rendering!");
+            }
+
+            m_pipeline_cache->addRenderingPipeline(renderpass_handle, i, key, graphics_pipeline);
+        }
+    }
+
     void VulkanRendererApi::destroyPipeline(RenderPass& renderpass, uint32_t stage)
     {
         m_pipeline_cache->destroyPipeline(static_cast<VkRenderPass>(renderpass.getRenderPassHandle()), stage);
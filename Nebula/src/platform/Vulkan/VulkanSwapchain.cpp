@@ -55,6 +55,11 @@ namespace nebula::rendering {
         return m_swapchain_images.size();
     }
 
+    const std::vector<VkImage>& VulkanSwapchainImages::viewImages() const
+    {
+        return m_swapchain_images;
+    }
+
     const std::vector<VkImageView>& VulkanSwapchainImages::viewImageViews() const
     {
         return m_swapchain_image_views;
@@ -86,6 +91,7 @@ namespace nebula::rendering {
         present_info.pResults = nullptr;
 
         const auto queue_info = VulkanAPI::getQueuesInfo();
+        std::lock_guard queue_lock{VulkanAPI::getQueueMutex()};
         const auto result = vkQueuePresentKHR(queue_info.presentation_queue, &present_info);
 
         NB_CORE_ASSERT(result == VK_SUCCESS || result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR);
@@ -173,8 +179,10 @@ namespace nebula::rendering {
         m_swapchain_images = createScope<VulkanSwapchainImages>(m_swapchain, m_surface_format, m_extent.width, m_extent.height);
         m_swapchain_framebuffer_template = createReference<SwapchainFramebufferTemplate>(m_extent.width, m_extent.height);
 
-        for (auto image_view : m_swapchain_images->viewImageViews())
-            m_framebuffers.emplace_back(createScope<VulkanSwapchainFramebuffer>(image_view, m_swapchain_framebuffer_template));
+        const auto& images = m_swapchain_images->viewImages();
+        const auto& image_views = m_swapchain_images->viewImageViews();
+        for (uint32_t i = 0; i < images.size(); ++i)
+            m_framebuffers.emplace_back(createScope<VulkanSwapchainFramebuffer>(images[i], image_views[i], m_swapchain_framebuffer_template));
     }
 
     bool VulkanSwapchain::checkVSync() const
@@ -0,0 +1,453 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "platform/Vulkan/VulkanUploadManager.h"
+
+#include <cstring>
+
+#include "core/Assert.h"
+#include "platform/Vulkan/VulkanRecordedBuffer.h"
+
+namespace nebula::rendering {
+
+    VulkanUploadManager* VulkanUploadManager::s_instance = nullptr;
+
+    static VkDeviceSize alignOffset(const VkDeviceSize offset, const VkDeviceSize alignment)
+    {
+        return (offset + alignment - 1) & ~(alignment - 1);
+    }
+
+    VulkanUploadManager::VulkanUploadManager(const VkDeviceSize staging_buffer_size) : m_staging_size(staging_buffer_size)
+    {
+        NB_CORE_ASSERT(!s_instance, "Can have only one VulkanUploadManager!");
+        s_instance = this;
+
+        const auto queues_info = VulkanAPI::getQueuesInfo();
+
+        //  Timeline semaphore
+        VkSemaphoreTypeCreateInfo semaphore_type_info = {};
+        semaphore_type_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+        semaphore_type_info.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+        semaphore_type_info.initialValue = 0;
+
+        VkSemaphoreCreateInfo semaphore_info = {};
+        semaphore_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semaphore_info.pNext = &semaphore_type_info;
+
+        auto result = vkCreateSemaphore(VulkanAPI::getDevice(), &semaphore_info, nullptr, &m_timeline_semaphore);
+        NB_CORE_ASSERT(result == VK_SUCCESS, "Failed to create Vulkan upload timeline semaphore!");
+
+        //  Staging ring buffer
+        VkPhysicalDeviceProperties properties;
+        vkGetPhysicalDeviceProperties(VulkanAPI::getPhysicalDevice(), &properties);
+        m_staging_alignment = std::max<VkDeviceSize>(m_staging_alignment, properties.limits.optimalBufferCopyOffsetAlignment);
+
+        VkBufferCreateInfo buffer_create_info = {};
+        buffer_create_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        buffer_create_info.size = m_staging_size;
+        buffer_create_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        buffer_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        VmaAllocationCreateInfo allocation_create_info = {};
+        allocation_create_info.usage = VMA_MEMORY_USAGE_AUTO_PREFER_HOST;
+        allocation_create_info.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+
+        VmaAllocationInfo allocation_info = {};
+        result = vmaCreateBuffer(VulkanAPI::getVmaAllocator(), &buffer_create_info, &allocation_create_info, &m_staging_buffer.buffer, &m_staging_buffer.allocation, &allocation_info);
+        NB_CORE_ASSERT(result == VK_SUCCESS, "Failed to create Vulkan staging buffer!");
+        m_staging_memory = static_cast<std::byte*>(allocation_info.pMappedData);
+
+        //  Transfer command pool
+        VkCommandPoolCreateInfo command_pool_create_info = {};
+        command_pool_create_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        command_pool_create_info.queueFamilyIndex = queues_info.transfer_family_index;
+        command_pool_create_info.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+
+        result = vkCreateCommandPool(VulkanAPI::getDevice(), &command_pool_create_info, nullptr, &m_transfer_pool);
+        NB_CORE_ASSERT(result == VK_SUCCESS, "Failed to create Vulkan transfer command pool!");
+
+        if (queues_info.checkDedicatedTransfer())
+            m_acquire_pool = createScope<VulkanCommandPool>();
+    }
+
+    VulkanUploadManager::~VulkanUploadManager()
+    {
+        NB_CORE_ASSERT(s_instance);
+
+        waitForTicket(flush());
+
+        m_acquire_pool.reset();
+        vkDestroyCommandPool(VulkanAPI::getDevice(), m_transfer_pool, nullptr);
+        vmaDestroyBuffer(VulkanAPI::getVmaAllocator(), m_staging_buffer.buffer, m_staging_buffer.allocation);
+        vkDestroySemaphore(VulkanAPI::getDevice(), m_timeline_semaphore, nullptr);
+
+        s_instance = nullptr;
+    }
+
+    UploadTicket VulkanUploadManager::uploadBuffer(VkBuffer buffer, const VkDeviceSize offset, const void* data, const VkDeviceSize size)
+    {
+        NB_CORE_ASSERT(buffer != VK_NULL_HANDLE && data && size > 0);
+
+        std::lock_guard lock{m_mutex};
+
+        const VkDeviceSize staging_offset = reserveStaging(size);
+        std::memcpy(m_staging_memory + staging_offset, data, size);
+
+        VkCommandBuffer command_buffer = beginRecording();
+
+        VkBufferCopy copy_region = {};
+        copy_region.srcOffset = staging_offset;
+        copy_region.dstOffset = offset;
+        copy_region.size = size;
+        vkCmdCopyBuffer(command_buffer, m_staging_buffer.buffer, buffer, 1, &copy_region);
+
+        const auto queues_info = VulkanAPI::getQueuesInfo();
+
+        VkBufferMemoryBarrier release_barrier = {};
+        release_barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        release_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        release_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        release_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        release_barrier.buffer = buffer;
+        release_barrier.offset = offset;
+        release_barrier.size = size;
+
+        if (queues_info.checkDedicatedTransfer())
+        {
+            release_barrier.dstAccessMask = 0;
+            release_barrier.srcQueueFamilyIndex = queues_info.transfer_family_index;
+            release_barrier.dstQueueFamilyIndex = queues_info.graphics_family_index;
+            vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 1, &release_barrier, 0, nullptr);
+
+            VkBufferMemoryBarrier acquire_barrier = release_barrier;
+            acquire_barrier.srcAccessMask = 0;
+            acquire_barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
+            m_recording_batch.buffer_acquires.push_back(acquire_barrier);
+        }
+        else
+        {
+            release_barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
+            vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0, nullptr, 1, &release_barrier, 0, nullptr);
+        }
+
+        return {m_recording_batch.ticket};
+    }
+
+    UploadTicket VulkanUploadManager::uploadImage(VkImage image, const VulkanImageUploadInfo& upload_info, const void* data, const VkDeviceSize size)
+    {
+        NB_CORE_ASSERT(image != VK_NULL_HANDLE && data && size > 0);
+
+        std::lock_guard lock{m_mutex};
+
+        const VkDeviceSize staging_offset = reserveStaging(size);
+        std::memcpy(m_staging_memory + staging_offset, data, size);
+
+        VkCommandBuffer command_buffer = beginRecording();
+
+        const auto& subresource = upload_info.subresource;
+
+        VkImageMemoryBarrier layout_barrier = {};
+        layout_barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        layout_barrier.srcAccessMask = 0;
+        layout_barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        layout_barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        layout_barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        layout_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        layout_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        layout_barrier.image = image;
+        layout_barrier.subresourceRange.aspectMask = subresource.aspectMask;
+        layout_barrier.subresourceRange.baseMipLevel = subresource.mipLevel;
+        layout_barrier.subresourceRange.levelCount = 1;
+        layout_barrier.subresourceRange.baseArrayLayer = subresource.baseArrayLayer;
+        layout_barrier.subresourceRange.layerCount = subresource.layerCount;
+        vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &layout_barrier);
+
+        VkBufferImageCopy copy_region = {};
+        copy_region.bufferOffset = staging_offset;
+        copy_region.bufferRowLength = 0;
+        copy_region.bufferImageHeight = 0;
+        copy_region.imageSubresource = subresource;
+        copy_region.imageOffset = upload_info.offset;
+        copy_region.imageExtent = upload_info.extent;
+        vkCmdCopyBufferToImage(command_buffer, m_staging_buffer.buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copy_region);
+
+        const auto queues_info = VulkanAPI::getQueuesInfo();
+
+        //  Layout transition is part of ownership transfer, both halves must specify the same layouts
+        VkImageMemoryBarrier release_barrier = layout_barrier;
+        release_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        release_barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        release_barrier.newLayout = upload_info.final_layout;
+
+        if (queues_info.checkDedicatedTransfer())
+        {
+            release_barrier.dstAccessMask = 0;
+            release_barrier.srcQueueFamilyIndex = queues_info.transfer_family_index;
+            release_barrier.dstQueueFamilyIndex = queues_info.graphics_family_index;
+            vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1, &release_barrier);
+
+            VkImageMemoryBarrier acquire_barrier = release_barrier;
+            acquire_barrier.srcAccessMask = 0;
+            acquire_barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
+            m_recording_batch.image_acquires.push_back(acquire_barrier);
+        }
+        else
+        {
+            release_barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
+            vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0, nullptr, 0, nullptr, 1, &release_barrier);
+        }
+
+        return {m_recording_batch.ticket};
+    }
+
+    UploadTicket VulkanUploadManager::flush()
+    {
+        std::lock_guard lock{m_mutex};
+
+        if (m_recording_batch.command_buffer)
+            submitBatch();
+
+        return {m_submitted_ticket};
+    }
+
+    bool VulkanUploadManager::checkCompleted(const UploadTicket ticket) const
+    {
+        return ticket.value <= getCompletedTicket();
+    }
+
+    bool VulkanUploadManager::checkAvailable(const UploadTicket ticket) const
+    {
+        return ticket.value <= m_acquired_ticket.load();
+    }
+
+    void VulkanUploadManager::waitForTicket(const UploadTicket ticket)
+    {
+        {
+            std::lock_guard lock{m_mutex};
+            if (ticket.value > m_submitted_ticket && m_recording_batch.command_buffer)
+                submitBatch();
+        }
+
+        VkSemaphoreWaitInfo wait_info = {};
+        wait_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+        wait_info.semaphoreCount = 1;
+        wait_info.pSemaphores = &m_timeline_semaphore;
+        wait_info.pValues = &ticket.value;
+
+        const auto result = vkWaitSemaphores(VulkanAPI::getDevice(), &wait_info, UINT64_MAX);
+        NB_CORE_ASSERT(result == VK_SUCCESS, "Failed waiting for Vulkan upload!");
+    }
+
+    std::optional<VkDeviceSize> VulkanUploadManager::allocateStaging(const VkDeviceSize size)
+    {
+        //  Head never catches up with tail from behind, so head == tail always means empty ring
+        const VkDeviceSize offset = alignOffset(m_staging_head, m_staging_alignment);
+
+        if (m_staging_head >= m_staging_tail)
+        {
+            if (offset + size <= m_staging_size)
+            {
+                m_staging_head = offset + size;
+                return offset;
+            }
+            if (size < m_staging_tail)
+            {
+                m_staging_head = size;
+                return 0;
+            }
+        }
+        else if (offset + size < m_staging_tail)
+        {
+            m_staging_head = offset + size;
+            return offset;
+        }
+
+        return std::nullopt;
+    }
+
+    VkDeviceSize VulkanUploadManager::reserveStaging(const VkDeviceSize size)
+    {
+        NB_CORE_ASSERT(size + m_staging_alignment < m_staging_size, "Upload does not fit into Vulkan staging buffer!");
+
+        reclaimCompletedBatches();
+        auto offset = allocateStaging(size);
+
+        //  Ring is full, only the uploading thread waits here
+        while (!offset)
+        {
+            if (m_recording_batch.command_buffer)
+                submitBatch();
+
+            NB_CORE_ASSERT(!m_submitted_batches.empty());
+            const uint64_t oldest_ticket = m_submitted_batches.front().ticket;
+
+            VkSemaphoreWaitInfo wait_info = {};
+            wait_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+            wait_info.semaphoreCount = 1;
+            wait_info.pSemaphores = &m_timeline_semaphore;
+            wait_info.pValues = &oldest_ticket;
+            vkWaitSemaphores(VulkanAPI::getDevice(), &wait_info, UINT64_MAX);
+
+            reclaimCompletedBatches();
+            offset = allocateStaging(size);
+        }
+
+        return *offset;
+    }
+
+    VkCommandBuffer VulkanUploadManager::beginRecording()
+    {
+        if (m_recording_batch.command_buffer)
+            return m_recording_batch.command_buffer;
+
+        VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+        if (m_free_command_buffers.empty())
+        {
+            VkCommandBufferAllocateInfo allocate_info = {};
+            allocate_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocate_info.commandPool = m_transfer_pool;
+            allocate_info.commandBufferCount = 1;
+            allocate_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+
+            const auto result = vkAllocateCommandBuffers(VulkanAPI::getDevice(), &allocate_info, &command_buffer);
+            NB_CORE_ASSERT(result == VK_SUCCESS, "Failed to allocate Vulkan transfer command buffer!");
+        }
+        else
+        {
+            command_buffer = m_free_command_buffers.back();
+            m_free_command_buffers.pop_back();
+        }
+
+        VkCommandBufferBeginInfo begin_info = {};
+        begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+        const auto result = vkBeginCommandBuffer(command_buffer, &begin_info);
+        NB_CORE_ASSERT(result == VK_SUCCESS, "Failed to start recording Vulkan transfer commands!");
+
+        m_recording_batch.command_buffer = command_buffer;
+        m_recording_batch.ticket = m_next_ticket;
+
+        return command_buffer;
+    }
+
+    void VulkanUploadManager::submitBatch()
+    {
+        NB_CORE_ASSERT(m_recording_batch.command_buffer);
+
+        auto result = vkEndCommandBuffer(m_recording_batch.command_buffer);
+        NB_CORE_ASSERT(result == VK_SUCCESS, "Failed to finish recording Vulkan transfer commands!");
+
+        VkTimelineSemaphoreSubmitInfo timeline_info = {};
+        timeline_info.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        timeline_info.signalSemaphoreValueCount = 1;
+        timeline_info.pSignalSemaphoreValues = &m_recording_batch.ticket;
+
+        VkSubmitInfo submit_info = {};
+        submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submit_info.pNext = &timeline_info;
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = &m_recording_batch.command_buffer;
+        submit_info.signalSemaphoreCount = 1;
+        submit_info.pSignalSemaphores = &m_timeline_semaphore;
+
+        {
+            std::lock_guard queue_lock{VulkanAPI::getQueueMutex()};
+            result = vkQueueSubmit(VulkanAPI::getQueuesInfo().transfer_queue, 1, &submit_info, VK_NULL_HANDLE);
+        }
+        NB_CORE_ASSERT(result == VK_SUCCESS, "Failed submitting Vulkan transfer commands!");
+
+        m_recording_batch.staging_end = m_staging_head;
+        m_submitted_ticket = m_recording_batch.ticket;
+        m_next_ticket = m_submitted_ticket + 1;
+
+        m_submitted_batches.push_back(std::move(m_recording_batch));
+        m_recording_batch = {};
+    }
+
+    void VulkanUploadManager::reclaimCompletedBatches()
+    {
+        const uint64_t completed_ticket = getCompletedTicket();
+
+        while (!m_submitted_batches.empty() && m_submitted_batches.front().ticket <= completed_ticket)
+        {
+            auto& batch = m_submitted_batches.front();
+
+            m_staging_tail = batch.staging_end;
+            m_free_command_buffers.push_back(batch.command_buffer);
+
+            m_pending_buffer_acquires.insert(m_pending_buffer_acquires.end(), batch.buffer_acquires.begin(), batch.buffer_acquires.end());
+            m_pending_image_acquires.insert(m_pending_image_acquires.end(), batch.image_acquires.begin(), batch.image_acquires.end());
+            m_pending_acquire_ticket = batch.ticket;
+
+            m_submitted_batches.pop_front();
+        }
+
+        //  Nothing in flight, rewind ring to avoid needless wrap arounds
+        if (m_submitted_batches.empty() && !m_recording_batch.command_buffer)
+            m_staging_head = m_staging_tail = 0;
+    }
+
+    uint64_t VulkanUploadManager::getCompletedTicket() const
+    {
+        uint64_t value = 0;
+        vkGetSemaphoreCounterValue(VulkanAPI::getDevice(), m_timeline_semaphore, &value);
+        return value;
+    }
+
+    VulkanUploadManager::AcquireInfo VulkanUploadManager::acquireUploads(const uint32_t frame_in_flight)
+    {
+        //  Uploading thread holds the lock, pick up finished uploads next frame
+        std::unique_lock lock{m_mutex, std::try_to_lock};
+        if (!lock.owns_lock())
+            return {};
+
+        //  Uploads made since last frame are batched into a single submission
+        if (m_recording_batch.command_buffer)
+            submitBatch();
+
+        reclaimCompletedBatches();
+
+        if (m_pending_acquire_ticket <= m_acquired_ticket.load())
+            return {};
+
+        AcquireInfo acquire_info;
+        acquire_info.wait_value = m_pending_acquire_ticket;
+
+        if (!m_pending_buffer_acquires.empty() || !m_pending_image_acquires.empty())
+        {
+            NB_CORE_ASSERT(m_acquire_pool);
+
+            m_acquire_pool->reset(frame_in_flight);
+            acquire_info.command_buffer = m_acquire_pool->getCommandBuffer(frame_in_flight);
+
+            VkCommandBufferBeginInfo begin_info = {};
+            begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+            begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            vkBeginCommandBuffer(acquire_info.command_buffer, &begin_info);
+
+            vkCmdPipelineBarrier(
+                acquire_info.command_buffer,
+                VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                0,
+                0, nullptr,
+                static_cast<uint32_t>(m_pending_buffer_acquires.size()), m_pending_buffer_acquires.data(),
+                static_cast<uint32_t>(m_pending_image_acquires.size()), m_pending_image_acquires.data()
+            );
+
+            const auto result = vkEndCommandBuffer(acquire_info.command_buffer);
+            NB_CORE_ASSERT(result == VK_SUCCESS, "Failed to record Vulkan upload acquire barriers!");
+
+            m_pending_buffer_acquires.clear();
+            m_pending_image_acquires.clear();
+        }
+
+        m_acquired_ticket.store(m_pending_acquire_ticket);
+
+        return acquire_info;
+    }
+
+}
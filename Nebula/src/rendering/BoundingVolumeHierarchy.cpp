@@ -0,0 +1,970 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "rendering/culling/BoundingVolumeHierarchy.h"
+
+#include <bit>
+#include <cmath>
+#include <numeric>
+#include <algorithm>
+
+#include "core/Timer.h"
+#include "core/Assert.h"
+#include "debug/Profiler.h"
+#include "utility/SimdMath.h"
+
+namespace nebula::rendering {
+
+    static constexpr float cEmptyMin = 1e30f;
+    static constexpr float cEmptyMax = -1e30f;
+    static constexpr uint32_t cFreedSlot = std::numeric_limits<uint32_t>::max();
+
+    static constexpr uint32_t cSahBins = 12;
+    static constexpr float cFatMarginScale = 0.1f;     //  Dynamic bounds are enlarged by this fraction of their extent
+    static constexpr float cDisplacementScale = 4.0f;  //  Reinserted fat bounds are extended by this many last displacements
+    static constexpr float cShrinkRatio = 2.0f;        //  Fat bounds larger than this many times new fat bounds are tightened
+
+    static constexpr uint32_t cChildMask = (1u << BvhNode::cWidth) - 1;
+
+    ////////  Bounds helpers  ////////
+
+    static BoundingBox mergeBounds(const BoundingBox& lhs, const BoundingBox& rhs)
+    {
+        return {glm::min(lhs.min, rhs.min), glm::max(lhs.max, rhs.max)};
+    }
+
+    static float surfaceArea(const BoundingBox& bounds)
+    {
+        const glm::vec3 size = glm::max(bounds.max - bounds.min, glm::vec3{0.0f});
+        return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+    }
+
+    static bool containsBounds(const BoundingBox& outer, const BoundingBox& inner)
+    {
+        return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+               outer.max.x >= inner.max.x && outer.max.y >= inner.max.y && outer.max.z >= inner.max.z;
+    }
+
+    static bool overlapsBounds(const BoundingBox& lhs, const BoundingBox& rhs)
+    {
+        return lhs.min.x <= rhs.max.x && lhs.min.y <= rhs.max.y && lhs.min.z <= rhs.max.z &&
+               lhs.max.x >= rhs.min.x && lhs.max.y >= rhs.min.y && lhs.max.z >= rhs.min.z;
+    }
+
+    static bool equalBounds(const BoundingBox& lhs, const BoundingBox& rhs)
+    {
+        return lhs.min.x == rhs.min.x && lhs.min.y == rhs.min.y && lhs.min.z == rhs.min.z &&
+               lhs.max.x == rhs.max.x && lhs.max.y == rhs.max.y && lhs.max.z == rhs.max.z;
+    }
+
+    static BoundingBox emptyBounds()
+    {
+        return {glm::vec3{cEmptyMin}, glm::vec3{cEmptyMax}};
+    }
+
+    static glm::vec3 getCentroid(const BoundingBox& bounds)
+    {
+        return (bounds.min + bounds.max) * 0.5f;
+    }
+
+    static BoundingBox fattenBounds(const BoundingBox& bounds)
+    {
+        const glm::vec3 margin = (bounds.max - bounds.min) * cFatMarginScale;
+        return {bounds.min - margin, bounds.max + margin};
+    }
+
+    static uint32_t getValidMask(const BvhNode& node)
+    {
+        uint32_t mask = 0;
+        for (uint32_t slot = 0; slot < BvhNode::cWidth; ++slot)
+            mask |= (node.children[slot] != BvhNode::cEmptyChild) << slot;
+
+        return mask;
+    }
+
+    ////////  Node tests, return bit per child  ////////
+
+    struct FrustumTestPlanes
+    {
+        Frustum frustum;
+        bool positive_x[Frustum::cPlaneCount]{};
+        bool positive_y[Frustum::cPlaneCount]{};
+        bool positive_z[Frustum::cPlaneCount]{};
+    };
+
+    struct RayTestData
+    {
+        glm::vec3 origin;
+        glm::vec3 inverse_direction;
+        bool parallel[3];   //  Direction component is zero, slab test would compute 0 * inf for origin on slab plane
+
+        explicit RayTestData(const Ray& ray) : origin(ray.origin), inverse_direction(1.0f / ray.direction)
+        {
+            for (int axis = 0; axis < 3; ++axis)
+                parallel[axis] = std::isinf(inverse_direction[axis]);
+        }
+    };
+
+    static bool testFrustumBounds(const BoundingBox& bounds, const FrustumTestPlanes& planes)
+    {
+        for (uint32_t i = 0; i < Frustum::cPlaneCount; ++i)
+        {
+            const auto& plane = planes.frustum.planes[i];
+            const float far_distance = plane.x * (planes.positive_x[i] ? bounds.max.x : bounds.min.x) +
+                                       plane.y * (planes.positive_y[i] ? bounds.max.y : bounds.min.y) +
+                                       plane.z * (planes.positive_z[i] ? bounds.max.z : bounds.min.z) + plane.w;
+            if (far_distance < 0.0f)
+                return false;
+        }
+
+        return true;
+    }
+
+    //  Ray parallel to slab is either inside it for whole length or misses it
+    static bool testRayBounds(const BoundingBox& bounds, const RayTestData& ray, const float max_distance, float& entry_distance)
+    {
+        float entry = 0.0f;
+        float exit = max_distance;
+
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            if (ray.parallel[axis])
+            {
+                if (ray.origin[axis] < bounds.min[axis] || ray.origin[axis] > bounds.max[axis])
+                    return false;
+                continue;
+            }
+
+            const float t0 = (bounds.min[axis] - ray.origin[axis]) * ray.inverse_direction[axis];
+            const float t1 = (bounds.max[axis] - ray.origin[axis]) * ray.inverse_direction[axis];
+            entry = std::max(entry, std::min(t0, t1));
+            exit = std::min(exit, std::max(t0, t1));
+        }
+
+        entry_distance = entry;
+        return entry <= exit;
+    }
+
+    #ifdef NB_SIMD_SSE
+    static void testRaySlab(const __m128 min, const __m128 max, const RayTestData& ray, const int axis, __m128& entry, __m128& exit)
+    {
+        const __m128 origin = _mm_set1_ps(ray.origin[axis]);
+        if (ray.parallel[axis])
+        {
+            //  Children outside of slab get infinite entry, so they fail entry <= exit
+            const __m128 inside = _mm_and_ps(_mm_cmple_ps(min, origin), _mm_cmpge_ps(max, origin));
+            entry = _mm_max_ps(entry, _mm_andnot_ps(inside, _mm_set1_ps(std::numeric_limits<float>::infinity())));
+            return;
+        }
+
+        const __m128 inverse = _mm_set1_ps(ray.inverse_direction[axis]);
+        const __m128 t0 = _mm_mul_ps(_mm_sub_ps(min, origin), inverse);
+        const __m128 t1 = _mm_mul_ps(_mm_sub_ps(max, origin), inverse);
+        entry = _mm_max_ps(entry, _mm_min_ps(t0, t1));
+        exit = _mm_min_ps(exit, _mm_max_ps(t0, t1));
+    }
+    #endif
+
+    //  Intersect mask tests corner furthest along plane normal, inside mask the nearest one
+    static uint32_t testFrustum(const BvhNode& node, const FrustumTestPlanes& planes, uint32_t& inside_mask)
+    {
+        #ifdef NB_SIMD_SSE
+        const __m128 zero = _mm_setzero_ps();
+        __m128 outside = _mm_setzero_ps();
+        __m128 partial = _mm_setzero_ps();
+
+        const __m128 min_x = _mm_load_ps(node.min_x), max_x = _mm_load_ps(node.max_x);
+        const __m128 min_y = _mm_load_ps(node.min_y), max_y = _mm_load_ps(node.max_y);
+        const __m128 min_z = _mm_load_ps(node.min_z), max_z = _mm_load_ps(node.max_z);
+
+        for (uint32_t i = 0; i < Frustum::cPlaneCount; ++i)
+        {
+            const auto& plane = planes.frustum.planes[i];
+            const __m128 normal_x = _mm_set1_ps(plane.x);
+            const __m128 normal_y = _mm_set1_ps(plane.y);
+            const __m128 normal_z = _mm_set1_ps(plane.z);
+            const __m128 distance = _mm_set1_ps(plane.w);
+
+            __m128 far_distance = _mm_add_ps(_mm_mul_ps(normal_x, planes.positive_x[i] ? max_x : min_x), distance);
+            far_distance = _mm_add_ps(far_distance, _mm_mul_ps(normal_y, planes.positive_y[i] ? max_y : min_y));
+            far_distance = _mm_add_ps(far_distance, _mm_mul_ps(normal_z, planes.positive_z[i] ? max_z : min_z));
+
+            __m128 near_distance = _mm_add_ps(_mm_mul_ps(normal_x, planes.positive_x[i] ? min_x : max_x), distance);
+            near_distance = _mm_add_ps(near_distance, _mm_mul_ps(normal_y, planes.positive_y[i] ? min_y : max_y));
+            near_distance = _mm_add_ps(near_distance, _mm_mul_ps(normal_z, planes.positive_z[i] ? min_z : max_z));
+
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(far_distance, zero));
+            partial = _mm_or_ps(partial, _mm_cmplt_ps(near_distance, zero));
+        }
+
+        const auto outside_mask = static_cast<uint32_t>(_mm_movemask_ps(outside));
+        inside_mask = ~static_cast<uint32_t>(_mm_movemask_ps(partial)) & cChildMask;
+
+        return ~outside_mask & cChildMask;
+        #else
+        uint32_t intersect_mask = 0;
+        inside_mask = 0;
+
+        for (uint32_t slot = 0; slot < BvhNode::cWidth; ++slot)
+        {
+            bool outside = false;
+            bool partial = false;
+
+            for (uint32_t i = 0; i < Frustum::cPlaneCount; ++i)
+            {
+                const auto& plane = planes.frustum.planes[i];
+
+                const float far_distance = plane.x * (planes.positive_x[i] ? node.max_x[slot] : node.min_x[slot]) +
+                                           plane.y * (planes.positive_y[i] ? node.max_y[slot] : node.min_y[slot]) +
+                                           plane.z * (planes.positive_z[i] ? node.max_z[slot] : node.min_z[slot]) + plane.w;
+                const float near_distance = plane.x * (planes.positive_x[i] ? node.min_x[slot] : node.max_x[slot]) +
+                                            plane.y * (planes.positive_y[i] ? node.min_y[slot] : node.max_y[slot]) +
+                                            plane.z * (planes.positive_z[i] ? node.min_z[slot] : node.max_z[slot]) + plane.w;
+
+                outside |= far_distance < 0.0f;
+                partial |= near_distance < 0.0f;
+            }
+
+            intersect_mask |= !outside << slot;
+            inside_mask |= !partial << slot;
+        }
+
+        return intersect_mask;
+        #endif
+    }
+
+    //  Slab test, entry distances are written for every child
+    static uint32_t testRay(const BvhNode& node, const RayTestData& ray, const float max_distance, float* entry_distances)
+    {
+        #ifdef NB_SIMD_SSE
+        __m128 entry = _mm_setzero_ps();
+        __m128 exit = _mm_set1_ps(max_distance);
+
+        testRaySlab(_mm_load_ps(node.min_x), _mm_load_ps(node.max_x), ray, 0, entry, exit);
+        testRaySlab(_mm_load_ps(node.min_y), _mm_load_ps(node.max_y), ray, 1, entry, exit);
+        testRaySlab(_mm_load_ps(node.min_z), _mm_load_ps(node.max_z), ray, 2, entry, exit);
+
+        _mm_storeu_ps(entry_distances, entry);
+        return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(entry, exit)));
+        #else
+        uint32_t hit_mask = 0;
+        for (uint32_t slot = 0; slot < BvhNode::cWidth; ++slot)
+        {
+            const BoundingBox bounds{
+                {node.min_x[slot], node.min_y[slot], node.min_z[slot]},
+                {node.max_x[slot], node.max_y[slot], node.max_z[slot]}
+            };
+
+            entry_distances[slot] = 0.0f;
+            hit_mask |= testRayBounds(bounds, ray, max_distance, entry_distances[slot]) << slot;
+        }
+
+        return hit_mask;
+        #endif
+    }
+
+    static uint32_t testOverlap(const BvhNode& node, const BoundingBox& bounds)
+    {
+        #ifdef NB_SIMD_SSE
+        __m128 overlap = _mm_cmple_ps(_mm_load_ps(node.min_x), _mm_set1_ps(bounds.max.x));
+        overlap = _mm_and_ps(overlap, _mm_cmple_ps(_mm_load_ps(node.min_y), _mm_set1_ps(bounds.max.y)));
+        overlap = _mm_and_ps(overlap, _mm_cmple_ps(_mm_load_ps(node.min_z), _mm_set1_ps(bounds.max.z)));
+        overlap = _mm_and_ps(overlap, _mm_cmpge_ps(_mm_load_ps(node.max_x), _mm_set1_ps(bounds.min.x)));
+        overlap = _mm_and_ps(overlap, _mm_cmpge_ps(_mm_load_ps(node.max_y), _mm_set1_ps(bounds.min.y)));
+        overlap = _mm_and_ps(overlap, _mm_cmpge_ps(_mm_load_ps(node.max_z), _mm_set1_ps(bounds.min.z)));
+
+        return static_cast<uint32_t>(_mm_movemask_ps(overlap));
+        #else
+        uint32_t overlap_mask = 0;
+        for (uint32_t slot = 0; slot < BvhNode::cWidth; ++slot)
+        {
+            const bool overlap = node.min_x[slot] <= bounds.max.x && node.min_y[slot] <= bounds.max.y && node.min_z[slot] <= bounds.max.z &&
+                                 node.max_x[slot] >= bounds.min.x && node.max_y[slot] >= bounds.min.y && node.max_z[slot] >= bounds.min.z;
+            overlap_mask |= overlap << slot;
+        }
+
+        return overlap_mask;
+        #endif
+    }
+
+    static uint32_t resolveObject(const uint32_t item, const uint32_t* item_objects)
+    {
+        return item_objects ? item_objects[item] : item;
+    }
+
+    ////////  SAH build  ////////
+
+    //  Items are partitioned in place, so bounds and centroids are copied next to ids instead of gathered per pass
+    struct BvhTree::BuildItem
+    {
+        BoundingBox bounds;
+        glm::vec3 centroid;
+        uint32_t item;
+    };
+
+    struct BuildSplit
+    {
+        std::size_t left_size;
+        BoundingBox left_bounds;
+        BoundingBox right_bounds;
+    };
+
+    static BoundingBox computeBounds(const std::span<const BvhTree::BuildItem> items)
+    {
+        BoundingBox result = emptyBounds();
+        for (const auto& item : items)
+            result = mergeBounds(result, item.bounds);
+
+        return result;
+    }
+
+    //  Binned SAH along largest centroid axis, falls back to median split when bins can't separate items
+    static BuildSplit splitItems(const std::span<BvhTree::BuildItem> items)
+    {
+        BoundingBox centroid_bounds = emptyBounds();
+        for (const auto& item : items)
+            centroid_bounds = mergeBounds(centroid_bounds, {item.centroid, item.centroid});
+
+        const glm::vec3 extent = centroid_bounds.max - centroid_bounds.min;
+        const int axis = extent.x >= extent.y && extent.x >= extent.z ? 0 : extent.y >= extent.z ? 1 : 2;
+
+        const auto median_split = [&]
+        {
+            const std::size_t middle = items.size() / 2;
+            std::ranges::nth_element(items, items.begin() + static_cast<std::ptrdiff_t>(middle), {}, [axis](const auto& item) { return item.centroid[axis]; });
+            return BuildSplit{middle, computeBounds(items.first(middle)), computeBounds(items.subspan(middle))};
+        };
+
+        if (extent[axis] <= 0.0f)
+            return median_split();
+
+        const float bin_scale = static_cast<float>(cSahBins) / extent[axis];
+        const auto getBin = [&](const BvhTree::BuildItem& item)
+        {
+            const float offset = item.centroid[axis] - centroid_bounds.min[axis];
+            return std::min(static_cast<uint32_t>(offset * bin_scale), cSahBins - 1);
+        };
+
+        uint32_t bin_counts[cSahBins]{};
+        BoundingBox bin_bounds[cSahBins];
+        std::fill(std::begin(bin_bounds), std::end(bin_bounds), emptyBounds());
+
+        for (const auto& item : items)
+        {
+            const uint32_t bin = getBin(item);
+            ++bin_counts[bin];
+            bin_bounds[bin] = mergeBounds(bin_bounds[bin], item.bounds);
+        }
+
+        //  Cost of split after bin i is area(left) * count(left) + area(right) * count(right)
+        float right_costs[cSahBins]{};
+        BoundingBox right_bounds[cSahBins];
+        BoundingBox accumulated_bounds = emptyBounds();
+        uint32_t right_count = 0;
+        for (uint32_t bin = cSahBins - 1; bin > 0; --bin)
+        {
+            accumulated_bounds = mergeBounds(accumulated_bounds, bin_bounds[bin]);
+            right_count += bin_counts[bin];
+            right_bounds[bin - 1] = accumulated_bounds;
+            right_costs[bin - 1] = surfaceArea(accumulated_bounds) * static_cast<float>(right_count);
+        }
+
+        BuildSplit best_split{};
+        float best_cost = std::numeric_limits<float>::max();
+        uint32_t best_bin = 0;
+
+        accumulated_bounds = emptyBounds();
+        uint32_t left_count = 0;
+        for (uint32_t bin = 0; bin < cSahBins - 1; ++bin)
+        {
+            accumulated_bounds = mergeBounds(accumulated_bounds, bin_bounds[bin]);
+            left_count += bin_counts[bin];
+
+            const float cost = surfaceArea(accumulated_bounds) * static_cast<float>(left_count) + right_costs[bin];
+            if (left_count > 0 && left_count < items.size() && cost < best_cost)
+            {
+                best_cost = cost;
+                best_bin = bin;
+                best_split = {left_count, accumulated_bounds, right_bounds[bin]};
+            }
+        }
+
+        if (best_split.left_size == 0)
+            return median_split();
+
+        std::partition(items.begin(), items.end(), [&](const auto& item) { return getBin(item) <= best_bin; });
+        return best_split;
+    }
+
+    ////////////////////////////////////////////////////////////////////
+    //////  BvhTree  ///////////////////////////////////////////////////
+    ////////////////////////////////////////////////////////////////////
+
+    void BvhTree::build(const std::span<const BoundingBox> bounds)
+    {
+        NB_PROFILE_SCOPE("BVH build");
+
+        clear();
+        if (bounds.empty())
+            return;
+
+        NB_CORE_ASSERT(bounds.size() < BvhNode::cLeafFlag, "Too many BVH items!");
+
+        //  Single item leaves, 4-wide tree has about one node per three items
+        m_nodes.reserve(bounds.size() / 2 + 1);
+        m_item_locations.resize(bounds.size());
+
+        std::vector<BuildItem> items(bounds.size());
+        for (uint32_t item = 0; item < bounds.size(); ++item)
+            items[item] = {bounds[item], getCentroid(bounds[item]), item};
+
+        m_root = buildNode(items, computeBounds(items), cInvalidNode, 0);
+    }
+
+    void BvhTree::clear()
+    {
+        m_nodes.clear();
+        m_free_nodes.clear();
+        m_item_locations.clear();
+        m_dirty_nodes.clear();
+        m_root = cInvalidNode;
+    }
+
+    void BvhTree::insert(const uint32_t item, const BoundingBox& bounds)
+    {
+        NB_CORE_ASSERT(item < BvhNode::cLeafFlag, "BVH item id out of range!");
+
+        if (item >= m_item_locations.size())
+            m_item_locations.resize(item + 1);
+
+        const uint32_t leaf = item | BvhNode::cLeafFlag;
+        if (m_root == cInvalidNode)
+        {
+            m_root = allocateNode(cInvalidNode, 0);
+            setChild(m_root, 0, leaf, bounds);
+            return;
+        }
+
+        uint32_t node = m_root;
+        while (true)
+        {
+            const uint32_t free_slot = std::countr_zero(~getValidMask(m_nodes[node]) & cChildMask);
+            if (free_slot < BvhNode::cWidth)
+            {
+                setChild(node, free_slot, leaf, bounds);
+                refitUpwards(node);
+                return;
+            }
+
+            //  Descend into child with smallest SAH cost increase
+            uint32_t best_slot = 0;
+            float best_cost = std::numeric_limits<float>::max();
+            for (uint32_t slot = 0; slot < BvhNode::cWidth; ++slot)
+            {
+                const BoundingBox child_bounds = getChildBounds(node, slot);
+                const float cost = surfaceArea(mergeBounds(child_bounds, bounds)) - surfaceArea(child_bounds);
+                if (cost < best_cost)
+                {
+                    best_cost = cost;
+                    best_slot = slot;
+                }
+            }
+
+            const uint32_t child = m_nodes[node].children[best_slot];
+            if (!(child & BvhNode::cLeafFlag))
+            {
+                node = child;
+                continue;
+            }
+
+            //  Leaf is pushed down into new node together with inserted item
+            const BoundingBox child_bounds = getChildBounds(node, best_slot);
+            const uint32_t new_node = allocateNode(node, best_slot);
+            setChild(new_node, 0, child, child_bounds);
+            setChild(new_node, 1, leaf, bounds);
+            setChild(node, best_slot, new_node, mergeBounds(child_bounds, bounds));
+
+            refitUpwards(node);
+            return;
+        }
+    }
+
+    void BvhTree::remove(const uint32_t item)
+    {
+        NB_CORE_ASSERT(item < m_item_locations.size() && m_item_locations[item].node != cInvalidNode, "Item is not in BVH!");
+
+        const ItemLocation location = m_item_locations[item];
+        clearChild(location.node, location.slot);
+        m_item_locations[item] = {};
+
+        //  Empty nodes are removed and nodes with single child are collapsed into parent
+        uint32_t node = location.node;
+        while (true)
+        {
+            const uint32_t valid_mask = getValidMask(m_nodes[node]);
+            const uint32_t child_count = std::popcount(valid_mask);
+
+            if (node == m_root)
+            {
+                const uint32_t child = child_count == 1 ? m_nodes[node].children[std::countr_zero(valid_mask)] : BvhNode::cEmptyChild;
+                if (child_count == 0)
+                {
+                    freeNode(node);
+                    m_root = cInvalidNode;
+                }
+                else if (child_count == 1 && !(child & BvhNode::cLeafFlag))
+                {
+                    freeNode(node);
+                    m_root = child;
+                    m_nodes[child].parent = cInvalidNode;
+                    m_nodes[child].parent_slot = 0;
+                }
+                return;
+            }
+
+            const uint32_t parent = m_nodes[node].parent;
+            const uint32_t parent_slot = m_nodes[node].parent_slot;
+
+            if (child_count == 0)
+            {
+                clearChild(parent, parent_slot);
+                freeNode(node);
+                node = parent;
+                continue;
+            }
+
+            if (child_count == 1)
+            {
+                const uint32_t slot = std::countr_zero(valid_mask);
+                setChild(parent, parent_slot, m_nodes[node].children[slot], getChildBounds(node, slot));
+                freeNode(node);
+                node = parent;
+            }
+
+            break;
+        }
+
+        refitUpwards(node);
+    }
+
+    void BvhTree::setBounds(const uint32_t item, const BoundingBox& bounds)
+    {
+        const ItemLocation location = m_item_locations[item];
+        NB_CORE_ASSERT(location.node != cInvalidNode, "Item is not in BVH!");
+
+        setChild(location.node, location.slot, item | BvhNode::cLeafFlag, bounds);
+        m_dirty_nodes.push_back(location.node);
+    }
+
+    void BvhTree::refit()
+    {
+        for (const uint32_t node : m_dirty_nodes)
+            if (m_nodes[node].parent_slot != cFreedSlot)
+                refitUpwards(node);
+
+        m_dirty_nodes.clear();
+    }
+
+    BoundingBox BvhTree::getBounds(const uint32_t item) const
+    {
+        const ItemLocation location = m_item_locations[item];
+        NB_CORE_ASSERT(location.node != cInvalidNode, "Item is not in BVH!");
+
+        return getChildBounds(location.node, location.slot);
+    }
+
+    void BvhTree::cullFrustum(const Frustum& frustum, std::vector<uint32_t>& objects, const uint32_t* item_objects, const BoundingBox* item_bounds) const
+    {
+        if (m_root == cInvalidNode)
+            return;
+
+        FrustumTestPlanes planes{frustum};
+        for (uint32_t i = 0; i < Frustum::cPlaneCount; ++i)
+        {
+            planes.positive_x[i] = frustum.planes[i].x >= 0.0f;
+            planes.positive_y[i] = frustum.planes[i].y >= 0.0f;
+            planes.positive_z[i] = frustum.planes[i].z >= 0.0f;
+        }
+
+        //  Subtrees fully inside frustum are flagged on stack and collected without further tests
+        static thread_local std::vector<uint32_t> s_stack;
+        s_stack.clear();
+        s_stack.push_back(m_root);
+
+        while (!s_stack.empty())
+        {
+            const uint32_t entry = s_stack.back();
+            s_stack.pop_back();
+
+            const BvhNode& node = m_nodes[entry & ~BvhNode::cLeafFlag];
+            const bool inside = entry & BvhNode::cLeafFlag;
+
+            uint32_t inside_mask = cChildMask;
+            uint32_t mask = getValidMask(node);
+            if (!inside)
+                mask &= testFrustum(node, planes, inside_mask);
+
+            for (; mask; mask &= mask - 1)
+            {
+                const uint32_t slot = std::countr_zero(mask);
+                const uint32_t child = node.children[slot];
+
+                if (child & BvhNode::cLeafFlag)
+                {
+                    //  Exact bounds lie within leaf bounds, so only partially visible leaves are refined
+                    const uint32_t item = child & ~BvhNode::cLeafFlag;
+                    if (!item_bounds || inside || (inside_mask & 1u << slot) || testFrustumBounds(item_bounds[item], planes))
+                        objects.push_back(resolveObject(item, item_objects));
+                }
+                else
+                    s_stack.push_back(child | (inside_mask & 1u << slot ? BvhNode::cLeafFlag : 0));
+            }
+        }
+    }
+
+    void BvhTree::queryOverlap(const BoundingBox& bounds, std::vector<uint32_t>& objects, const uint32_t* item_objects, const BoundingBox* item_bounds) const
+    {
+        if (m_root == cInvalidNode)
+            return;
+
+        static thread_local std::vector<uint32_t> s_stack;
+        s_stack.clear();
+        s_stack.push_back(m_root);
+
+        while (!s_stack.empty())
+        {
+            const BvhNode& node = m_nodes[s_stack.back()];
+            s_stack.pop_back();
+
+            for (uint32_t mask = getValidMask(node) & testOverlap(node, bounds); mask; mask &= mask - 1)
+            {
+                const uint32_t child = node.children[std::countr_zero(mask)];
+
+                if (child & BvhNode::cLeafFlag)
+                {
+                    const uint32_t item = child & ~BvhNode::cLeafFlag;
+                    if (!item_bounds || overlapsBounds(item_bounds[item], bounds))
+                        objects.push_back(resolveObject(item, item_objects));
+                }
+                else
+                    s_stack.push_back(child);
+            }
+        }
+    }
+
+    std::optional<RayHit> BvhTree::rayCast(const Ray& ray, const float max_distance, const uint32_t* item_objects, const BoundingBox* item_bounds) const
+    {
+        if (m_root == cInvalidNode)
+            return {};
+
+        const RayTestData ray_data{ray};
+
+        struct StackEntry
+        {
+            uint32_t node;
+            float distance;
+        };
+
+        static thread_local std::vector<StackEntry> s_stack;
+        s_stack.clear();
+        s_stack.push_back({m_root, 0.0f});
+
+        std::optional<RayHit> closest_hit;
+        float closest_distance = max_distance;
+
+        while (!s_stack.empty())
+        {
+            const StackEntry entry = s_stack.back();
+            s_stack.pop_back();
+
+            //  Node was pushed before closer hit was found
+            if (entry.distance > closest_distance)
+                continue;
+
+            const BvhNode& node = m_nodes[entry.node];
+
+            float entry_distances[BvhNode::cWidth];
+            uint32_t mask = getValidMask(node) & testRay(node, ray_data, closest_distance, entry_distances);
+
+            //  Farther children are pushed first, so nearest is traversed next
+            StackEntry inner[BvhNode::cWidth];
+            uint32_t inner_count = 0;
+
+            for (; mask; mask &= mask - 1)
+            {
+                const uint32_t slot = std::countr_zero(mask);
+                const uint32_t child = node.children[slot];
+
+                if (child & BvhNode::cLeafFlag)
+                {
+                    //  Distance is measured to exact bounds, leaf bounds may be enlarged
+                    const uint32_t item = child & ~BvhNode::cLeafFlag;
+                    float distance = entry_distances[slot];
+                    if (item_bounds && !testRayBounds(item_bounds[item], ray_data, closest_distance, distance))
+                        continue;
+
+                    if (distance <= closest_distance)
+                    {
+                        closest_distance = distance;
+                        closest_hit = RayHit{resolveObject(item, item_objects), closest_distance};
+                    }
+                }
+                else
+                    inner[inner_count++] = {child, entry_distances[slot]};
+            }
+
+            for (uint32_t i = 1; i < inner_count; ++i)
+                for (uint32_t j = i; j > 0 && inner[j - 1].distance < inner[j].distance; --j)
+                    std::swap(inner[j - 1], inner[j]);
+
+            s_stack.insert(s_stack.end(), inner, inner + inner_count);
+        }
+
+        return closest_hit;
+    }
+
+    uint32_t BvhTree::allocateNode(const uint32_t parent, const uint32_t parent_slot)
+    {
+        uint32_t node;
+        if (!m_free_nodes.empty())
+        {
+            node = m_free_nodes.back();
+            m_free_nodes.pop_back();
+        }
+        else
+        {
+            node = static_cast<uint32_t>(m_nodes.size());
+            m_nodes.emplace_back();
+        }
+
+        m_nodes[node].parent = parent;
+        m_nodes[node].parent_slot = parent_slot;
+        for (uint32_t slot = 0; slot < BvhNode::cWidth; ++slot)
+            clearChild(node, slot);
+
+        return node;
+    }
+
+    void BvhTree::freeNode(const uint32_t node)
+    {
+        m_nodes[node].parent = cInvalidNode;
+        m_nodes[node].parent_slot = cFreedSlot;
+        m_free_nodes.push_back(node);
+    }
+
+    void BvhTree::setChild(const uint32_t node, const uint32_t slot, const uint32_t child, const BoundingBox& bounds)
+    {
+        auto& target = m_nodes[node];
+        target.children[slot] = child;
+        target.min_x[slot] = bounds.min.x;
+        target.min_y[slot] = bounds.min.y;
+        target.min_z[slot] = bounds.min.z;
+        target.max_x[slot] = bounds.max.x;
+        target.max_y[slot] = bounds.max.y;
+        target.max_z[slot] = bounds.max.z;
+
+        if (child & BvhNode::cLeafFlag)
+            m_item_locations[child & ~BvhNode::cLeafFlag] = {node, slot};
+        else
+        {
+            m_nodes[child].parent = node;
+            m_nodes[child].parent_slot = slot;
+        }
+    }
+
+    void BvhTree::clearChild(const uint32_t node, const uint32_t slot)
+    {
+        auto& target = m_nodes[node];
+        target.children[slot] = BvhNode::cEmptyChild;
+        target.min_x[slot] = target.min_y[slot] = target.min_z[slot] = cEmptyMin;
+        target.max_x[slot] = target.max_y[slot] = target.max_z[slot] = cEmptyMax;
+    }
+
+    BoundingBox BvhTree::getNodeBounds(const uint32_t node) const
+    {
+        BoundingBox bounds = emptyBounds();
+        for (uint32_t mask = getValidMask(m_nodes[node]); mask; mask &= mask - 1)
+            bounds = mergeBounds(bounds, getChildBounds(node, std::countr_zero(mask)));
+
+        return bounds;
+    }
+
+    BoundingBox BvhTree::getChildBounds(const uint32_t node, const uint32_t slot) const
+    {
+        const auto& source = m_nodes[node];
+        return {
+            {source.min_x[slot], source.min_y[slot], source.min_z[slot]},
+            {source.max_x[slot], source.max_y[slot], source.max_z[slot]}
+        };
+    }
+
+    void BvhTree::refitUpwards(uint32_t node)
+    {
+        while (node != m_root)
+        {
+            const uint32_t parent = m_nodes[node].parent;
+            const uint32_t parent_slot = m_nodes[node].parent_slot;
+
+            const BoundingBox bounds = getNodeBounds(node);
+            if (equalBounds(bounds, getChildBounds(parent, parent_slot)))
+                return;
+
+            setChild(parent, parent_slot, node, bounds);
+            node = parent;
+        }
+    }
+
+    uint32_t BvhTree::buildNode(const std::span<BuildItem> items, const BoundingBox& bounds, const uint32_t parent, const uint32_t parent_slot)
+    {
+        struct Part
+        {
+            std::span<BuildItem> items;
+            BoundingBox bounds;
+        };
+
+        //  Part with largest area is split until node is full, which collapses binary SAH splits into 4-wide node
+        Part parts[BvhNode::cWidth];
+        parts[0] = {items, bounds};
+        uint32_t part_count = 1;
+
+        while (part_count < BvhNode::cWidth)
+        {
+            uint32_t split_part = BvhNode::cWidth;
+            float largest_area = -1.0f;
+            for (uint32_t i = 0; i < part_count; ++i)
+            {
+                if (parts[i].items.size() > 1 && surfaceArea(parts[i].bounds) > largest_area)
+                {
+                    largest_area = surfaceArea(parts[i].bounds);
+                    split_part = i;
+                }
+            }
+
+            if (split_part == BvhNode::cWidth)
+                break;
+
+            const auto part_items = parts[split_part].items;
+            const BuildSplit split = splitItems(part_items);
+
+            parts[split_part] = {part_items.first(split.left_size), split.left_bounds};
+            parts[part_count++] = {part_items.subspan(split.left_size), split.right_bounds};
+        }
+
+        const uint32_t node = allocateNode(parent, parent_slot);
+        for (uint32_t i = 0; i < part_count; ++i)
+        {
+            if (parts[i].items.size() == 1)
+                setChild(node, i, parts[i].items.front().item | BvhNode::cLeafFlag, parts[i].bounds);
+            else
+                setChild(node, i, buildNode(parts[i].items, parts[i].bounds, node, i), parts[i].bounds);
+        }
+
+        return node;
+    }
+
+    ////////////////////////////////////////////////////////////////////
+    //////  BoundingVolumeHierarchy  ///////////////////////////////////
+    ////////////////////////////////////////////////////////////////////
+
+    void BoundingVolumeHierarchy::buildStatic(const std::span<const BoundingBox> bounds)
+    {
+        Timer timer;
+        m_static_tree.build(bounds);
+
+        m_statistics.build_milliseconds = timer.elapsedMilliSeconds();
+        m_statistics.static_nodes = m_static_tree.getNodeCount();
+    }
+
+    BoundingVolumeHierarchy::Proxy BoundingVolumeHierarchy::addDynamic(const uint32_t object, const BoundingBox& bounds)
+    {
+        Proxy proxy;
+        if (!m_free_proxies.empty())
+        {
+            proxy = m_free_proxies.back();
+            m_free_proxies.pop_back();
+            m_proxy_objects[proxy] = object;
+            m_proxy_bounds[proxy] = bounds;
+        }
+        else
+        {
+            proxy = static_cast<Proxy>(m_proxy_objects.size());
+            m_proxy_objects.push_back(object);
+            m_proxy_bounds.push_back(bounds);
+        }
+
+        m_dynamic_tree.insert(proxy, fattenBounds(bounds));
+        return proxy;
+    }
+
+    void BoundingVolumeHierarchy::updateDynamic(const Proxy proxy, const BoundingBox& bounds)
+    {
+        const BoundingBox previous_bounds = m_proxy_bounds[proxy];
+        m_proxy_bounds[proxy] = bounds;
+
+        const BoundingBox fat_bounds = m_dynamic_tree.getBounds(proxy);
+        const BoundingBox new_fat_bounds = fattenBounds(bounds);
+
+        //  Moves inside fat bounds are free, objects that shrank well inside them are tightened in place,
+        //  which only ever shrinks ancestors
+        if (containsBounds(fat_bounds, bounds))
+        {
+            if (containsBounds(fat_bounds, new_fat_bounds) && surfaceArea(new_fat_bounds) * cShrinkRatio < surfaceArea(fat_bounds))
+                m_dynamic_tree.setBounds(proxy, new_fat_bounds);
+            return;
+        }
+
+        //  Growing leaf in place would drag its ancestors along with moving object, so it's always reinserted.
+        //  Fat bounds are extended along last displacement, steadily moving objects are then reinserted less often.
+        const glm::vec3 displacement = (getCentroid(bounds) - getCentroid(previous_bounds)) * cDisplacementScale;
+        const BoundingBox predicted_bounds{
+            new_fat_bounds.min + glm::min(displacement, glm::vec3{0.0f}),
+            new_fat_bounds.max + glm::max(displacement, glm::vec3{0.0f})
+        };
+
+        m_dynamic_tree.remove(proxy);
+        m_dynamic_tree.insert(proxy, predicted_bounds);
+        ++m_reinsertions;
+    }
+
+    void BoundingVolumeHierarchy::removeDynamic(const Proxy proxy)
+    {
+        m_dynamic_tree.remove(proxy);
+        m_free_proxies.push_back(proxy);
+    }
+
+    void BoundingVolumeHierarchy::refit()
+    {
+        NB_PROFILE_SCOPE("BVH refit");
+
+        Timer timer;
+        m_dynamic_tree.refit();
+
+        m_statistics.refit_milliseconds = timer.elapsedMilliSeconds();
+        m_statistics.reinsertions = m_reinsertions;
+        m_statistics.dynamic_nodes = m_dynamic_tree.getNodeCount();
+        m_reinsertions = 0;
+    }
+
+    void BoundingVolumeHierarchy::cullFrustum(const Frustum& frustum, std::vector<uint32_t>& objects) const
+    {
+        m_static_tree.cullFrustum(frustum, objects);
+        m_dynamic_tree.cullFrustum(frustum, objects, m_proxy_objects.data(), m_proxy_bounds.data());
+    }
+
+    void BoundingVolumeHierarchy::queryOverlap(const BoundingBox& bounds, std::vector<uint32_t>& objects) const
+    {
+        m_static_tree.queryOverlap(bounds, objects);
+        m_dynamic_tree.queryOverlap(bounds, objects, m_proxy_objects.data(), m_proxy_bounds.data());
+    }
+
+    std::optional<RayHit> BoundingVolumeHierarchy::rayCast(const Ray& ray, const float max_distance) const
+    {
+        const auto static_hit = m_static_tree.rayCast(ray, max_distance);
+        const auto dynamic_hit = m_dynamic_tree.rayCast(ray, static_hit ? static_hit->distance : max_distance, m_proxy_objects.data(), m_proxy_bounds.data());
+
+        return dynamic_hit ? dynamic_hit : static_hit;
+    }
+
+}
@@ -0,0 +1,115 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "rendering/culling/CullingBounds.h"
+
+#include "core/Assert.h"
+
+namespace nebula::rendering {
+
+    //  Padding radius, distance plus reach is negative for every plane
+    static constexpr float cPaddingRadius = -1e30f;
+
+    uint32_t CullingBounds::add(const BoundingBox& box)
+    {
+        const uint32_t index = push();
+        set(index, box);
+
+        return index;
+    }
+
+    uint32_t CullingBounds::add(const BoundingSphere& sphere)
+    {
+        const uint32_t index = push();
+        set(index, sphere);
+
+        return index;
+    }
+
+    void CullingBounds::set(const uint32_t index, const BoundingBox& box)
+    {
+        NB_CORE_ASSERT(index < m_count, "Culling bounds index out of range!");
+
+        const glm::vec3 center = (box.min + box.max) * 0.5f;
+        const glm::vec3 extent = (box.max - box.min) * 0.5f;
+
+        m_center_x[index] = center.x;
+        m_center_y[index] = center.y;
+        m_center_z[index] = center.z;
+        m_extent_x[index] = extent.x;
+        m_extent_y[index] = extent.y;
+        m_extent_z[index] = extent.z;
+        m_radius[index] = glm::length(extent);
+    }
+
+    void CullingBounds::set(const uint32_t index, const BoundingSphere& sphere)
+    {
+        NB_CORE_ASSERT(index < m_count, "Culling bounds index out of range!");
+
+        m_center_x[index] = sphere.center.x;
+        m_center_y[index] = sphere.center.y;
+        m_center_z[index] = sphere.center.z;
+        m_extent_x[index] = sphere.radius;
+        m_extent_y[index] = sphere.radius;
+        m_extent_z[index] = sphere.radius;
+        m_radius[index] = sphere.radius;
+    }
+
+    void CullingBounds::clear()
+    {
+        m_center_x.clear();
+        m_center_y.clear();
+        m_center_z.clear();
+        m_extent_x.clear();
+        m_extent_y.clear();
+        m_extent_z.clear();
+        m_radius.clear();
+
+        m_count = 0;
+    }
+
+    void CullingBounds::reserve(const uint32_t count)
+    {
+        const uint32_t padded = (count + cLaneCount - 1) / cLaneCount * cLaneCount;
+
+        m_center_x.reserve(padded);
+        m_center_y.reserve(padded);
+        m_center_z.reserve(padded);
+        m_extent_x.reserve(padded);
+        m_extent_y.reserve(padded);
+        m_extent_z.reserve(padded);
+        m_radius.reserve(padded);
+    }
+
+    BoundingBox CullingBounds::getBox(const uint32_t index) const
+    {
+        NB_CORE_ASSERT(index < m_count, "Culling bounds index out of range!");
+
+        const glm::vec3 center{m_center_x[index], m_center_y[index], m_center_z[index]};
+        const glm::vec3 extent{m_extent_x[index], m_extent_y[index], m_extent_z[index]};
+
+        return {center - extent, center + extent};
+    }
+
+    uint32_t CullingBounds::push()
+    {
+        //  New lane block is filled with padding, slots are then taken one by one
+        if (m_count == m_radius.size())
+        {
+            const std::size_t padded = m_radius.size() + cLaneCount;
+
+            m_center_x.resize(padded, 0.0f);
+            m_center_y.resize(padded, 0.0f);
+            m_center_z.resize(padded, 0.0f);
+            m_extent_x.resize(padded, 0.0f);
+            m_extent_y.resize(padded, 0.0f);
+            m_extent_z.resize(padded, 0.0f);
+            m_radius.resize(padded, cPaddingRadius);
+        }
+
+        return m_count++;
+    }
+
+}
@@ -0,0 +1,261 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "rendering/culling/FrustumCuller.h"
+
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+#include "core/Assert.h"
+#include "debug/Profiler.h"
+#include "debug/FrameCounters.h"
+#include "threads/JobSystem.h"
+#include "utility/SimdMath.h"
+
+namespace nebula::rendering {
+
+    static constexpr uint32_t cCullingChunkSize = 2048;     //  Objects per job, multiple of CullingBounds::cLaneCount
+
+    //  Plane coefficients split per component for broadcasting, abs normal projects box extents onto plane normal
+    struct FrustumPlanes
+    {
+        float normal_x[Frustum::cPlaneCount];
+        float normal_y[Frustum::cPlaneCount];
+        float normal_z[Frustum::cPlaneCount];
+        float distance[Frustum::cPlaneCount];
+        float abs_x[Frustum::cPlaneCount];
+        float abs_y[Frustum::cPlaneCount];
+        float abs_z[Frustum::cPlaneCount];
+    };
+
+    //  Processes [begin, end) in whole lane blocks, writes visible indices to output
+    using CullingKernel = uint32_t (*)(const CullingBounds& bounds, const FrustumPlanes& planes, uint32_t begin, uint32_t end, uint32_t* output);
+
+    static FrustumPlanes preparePlanes(const Frustum& frustum)
+    {
+        FrustumPlanes planes{};
+        for (uint32_t i = 0; i < Frustum::cPlaneCount; ++i)
+        {
+            const auto& plane = frustum.planes[i];
+
+            planes.normal_x[i] = plane.x;
+            planes.normal_y[i] = plane.y;
+            planes.normal_z[i] = plane.z;
+            planes.distance[i] = plane.w;
+            planes.abs_x[i] = std::abs(plane.x);
+            planes.abs_y[i] = std::abs(plane.y);
+            planes.abs_z[i] = std::abs(plane.z);
+        }
+
+        return planes;
+    }
+
+    //  Object is outside if it lies fully behind any plane, reach is the smaller of sphere radius and box projected on normal
+    [[maybe_unused]] static uint32_t cullScalar(const CullingBounds& bounds, const FrustumPlanes& planes, const uint32_t begin, const uint32_t end, uint32_t* output)
+    {
+        uint32_t count = 0;
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            const float center_x = bounds.getCentersX()[i];
+            const float center_y = bounds.getCentersY()[i];
+            const float center_z = bounds.getCentersZ()[i];
+
+            bool visible = true;
+            for (uint32_t plane = 0; plane < Frustum::cPlaneCount && visible; ++plane)
+            {
+                const float distance = planes.normal_x[plane] * center_x + planes.normal_y[plane] * center_y + planes.normal_z[plane] * center_z + planes.distance[plane];
+                const float reach = planes.abs_x[plane] * bounds.getExtentsX()[i] + planes.abs_y[plane] * bounds.getExtentsY()[i] + planes.abs_z[plane] * bounds.getExtentsZ()[i];
+
+                visible = distance + std::min(reach, bounds.getRadii()[i]) >= 0.0f;
+            }
+
+            output[count] = i;
+            count += visible;
+        }
+
+        return count;
+    }
+
+    #ifdef NB_SIMD_SSE
+    static uint32_t cullSse(const CullingBounds& bounds, const FrustumPlanes& planes, const uint32_t begin, const uint32_t end, uint32_t* output)
+    {
+        const __m128 zero = _mm_setzero_ps();
+
+        uint32_t count = 0;
+        for (uint32_t base = begin; base < end; base += 4)
+        {
+            const __m128 center_x = _mm_loadu_ps(bounds.getCentersX() + base);
+            const __m128 center_y = _mm_loadu_ps(bounds.getCentersY() + base);
+            const __m128 center_z = _mm_loadu_ps(bounds.getCentersZ() + base);
+            const __m128 extent_x = _mm_loadu_ps(bounds.getExtentsX() + base);
+            const __m128 extent_y = _mm_loadu_ps(bounds.getExtentsY() + base);
+            const __m128 extent_z = _mm_loadu_ps(bounds.getExtentsZ() + base);
+            const __m128 radius = _mm_loadu_ps(bounds.getRadii() + base);
+
+            __m128 visible = _mm_cmpeq_ps(zero, zero);
+            for (uint32_t plane = 0; plane < Frustum::cPlaneCount; ++plane)
+            {
+                __m128 distance = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes.normal_x[plane]), center_x), _mm_set1_ps(planes.distance[plane]));
+                distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(planes.normal_y[plane]), center_y));
+                distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(planes.normal_z[plane]), center_z));
+
+                __m128 reach = _mm_mul_ps(_mm_set1_ps(planes.abs_x[plane]), extent_x);
+                reach = _mm_add_ps(reach, _mm_mul_ps(_mm_set1_ps(planes.abs_y[plane]), extent_y));
+                reach = _mm_add_ps(reach, _mm_mul_ps(_mm_set1_ps(planes.abs_z[plane]), extent_z));
+                reach = _mm_min_ps(reach, radius);
+
+                visible = _mm_and_ps(visible, _mm_cmpge_ps(_mm_add_ps(distance, reach), zero));
+            }
+
+            for (auto mask = static_cast<uint32_t>(_mm_movemask_ps(visible)); mask; mask &= mask - 1)
+                output[count++] = base + std::countr_zero(mask);
+        }
+
+        return count;
+    }
+
+    NB_TARGET_AVX2 static uint32_t cullAvx2(const CullingBounds& bounds, const FrustumPlanes& planes, const uint32_t begin, const uint32_t end, uint32_t* output)
+    {
+        const __m256 zero = _mm256_setzero_ps();
+
+        uint32_t count = 0;
+        for (uint32_t base = begin; base < end; base += 8)
+        {
+            const __m256 center_x = _mm256_loadu_ps(bounds.getCentersX() + base);
+            const __m256 center_y = _mm256_loadu_ps(bounds.getCentersY() + base);
+            const __m256 center_z = _mm256_loadu_ps(bounds.getCentersZ() + base);
+            const __m256 extent_x = _mm256_loadu_ps(bounds.getExtentsX() + base);
+            const __m256 extent_y = _mm256_loadu_ps(bounds.getExtentsY() + base);
+            const __m256 extent_z = _mm256_loadu_ps(bounds.getExtentsZ() + base);
+            const __m256 radius = _mm256_loadu_ps(bounds.getRadii() + base);
+
+            __m256 visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+            for (uint32_t plane = 0; plane < Frustum::cPlaneCount; ++plane)
+            {
+                __m256 distance = _mm256_fmadd_ps(_mm256_set1_ps(planes.normal_x[plane]), center_x, _mm256_set1_ps(planes.distance[plane]));
+                distance = _mm256_fmadd_ps(_mm256_set1_ps(planes.normal_y[plane]), center_y, distance);
+                distance = _mm256_fmadd_ps(_mm256_set1_ps(planes.normal_z[plane]), center_z, distance);
+
+                __m256 reach = _mm256_mul_ps(_mm256_set1_ps(planes.abs_x[plane]), extent_x);
+                reach = _mm256_fmadd_ps(_mm256_set1_ps(planes.abs_y[plane]), extent_y, reach);
+                reach = _mm256_fmadd_ps(_mm256_set1_ps(planes.abs_z[plane]), extent_z, reach);
+                reach = _mm256_min_ps(reach, radius);
+
+                visible = _mm256_and_ps(visible, _mm256_cmp_ps(_mm256_add_ps(distance, reach), zero, _CMP_GE_OQ));
+            }
+
+            for (auto mask = static_cast<uint32_t>(_mm256_movemask_ps(visible)); mask; mask &= mask - 1)
+                output[count++] = base + std::countr_zero(mask);
+        }
+
+        return count;
+    }
+    #endif
+
+    static CullingKernel selectKernel()
+    {
+        #ifdef NB_SIMD_SSE
+        return simd::supportsAvx2() ? cullAvx2 : cullSse;
+        #else
+        return cullScalar;
+        #endif
+    }
+
+    uint32_t cullFrustum(const CullingBounds& bounds, const Frustum& frustum, std::vector<uint32_t>& visible_indices)
+    {
+        NB_PROFILE_SCOPE("Frustum culling");
+
+        static const CullingKernel s_kernel = selectKernel();
+
+        const FrustumPlanes planes = preparePlanes(frustum);
+        const uint32_t padded_size = bounds.getPaddedSize();
+        visible_indices.resize(padded_size);
+
+        uint32_t visible_count = 0;
+        const uint32_t chunk_count = (padded_size + cCullingChunkSize - 1) / cCullingChunkSize;
+
+        if (threads::JobSystem::checkEnabled() && chunk_count > 1)
+        {
+            //  Every chunk writes to its own range of output, ranges are compacted afterwards
+            std::vector<uint32_t> chunk_visible(chunk_count);
+            threads::JobSystem::get().parallelFor(chunk_count, [&](const uint32_t job_index, uint32_t)
+            {
+                const uint32_t begin = job_index * cCullingChunkSize;
+                const uint32_t end = std::min(begin + cCullingChunkSize, padded_size);
+
+                chunk_visible[job_index] = s_kernel(bounds, planes, begin, end, visible_indices.data() + begin);
+            });
+
+            for (uint32_t chunk = 0; chunk < chunk_count; ++chunk)
+            {
+                const uint32_t* source = visible_indices.data() + chunk * cCullingChunkSize;
+                if (visible_count != chunk * cCullingChunkSize)
+                    std::memmove(visible_indices.data() + visible_count, source, chunk_visible[chunk] * sizeof(uint32_t));
+
+                visible_count += chunk_visible[chunk];
+            }
+        }
+        else if (padded_size > 0)
+            visible_count = s_kernel(bounds, planes, 0, padded_size, visible_indices.data());
+
+        visible_indices.resize(visible_count);
+
+        NB_COUNT(cObjectsVisible, visible_count);
+        NB_COUNT(cObjectsCulled, bounds.size() - visible_count);
+
+        return visible_count;
+    }
+
+    ////////////////////////////////////////////////////////////////////
+    //////  FrustumCuller  /////////////////////////////////////////////
+    ////////////////////////////////////////////////////////////////////
+
+    uint32_t FrustumCuller::addObject(const View<RenderObject> object, const uint32_t stage, const BoundingBox& bounds)
+    {
+        m_objects.push_back(object);
+        m_stages.push_back(stage);
+
+        return m_bounds.add(bounds);
+    }
+
+    uint32_t FrustumCuller::addObject(const View<RenderObject> object, const uint32_t stage, const BoundingSphere& bounds)
+    {
+        m_objects.push_back(object);
+        m_stages.push_back(stage);
+
+        return m_bounds.add(bounds);
+    }
+
+    void FrustumCuller::clear()
+    {
+        m_bounds.clear();
+        m_objects.clear();
+        m_stages.clear();
+        m_visible_indices.clear();
+        m_statistics = {};
+    }
+
+    const CullingStatistics& FrustumCuller::cull(const Frustum& frustum, RenderPassObjects& renderpass_objects, OcclusionCuller* occlusion_culler)
+    {
+        m_statistics.tested = m_bounds.size();
+        m_statistics.visible = cullFrustum(m_bounds, frustum, m_visible_indices);
+        m_statistics.occluded = 0;
+
+        if (occlusion_culler)
+        {
+            const uint32_t frustum_visible = m_statistics.visible;
+            m_statistics.visible = occlusion_culler->cullOccluded(m_bounds, m_visible_indices);
+            m_statistics.occluded = frustum_visible - m_statistics.visible;
+        }
+
+        for (const uint32_t index : m_visible_indices)
+            renderpass_objects.addObject(m_stages[index], m_objects[index]);
+
+        return m_statistics;
+    }
+
+}
@@ -0,0 +1,59 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "rendering/GeometryBuffer.h"
+
+#include "core/Assert.h"
+#include "core/Logging.h"
+
+namespace nebula::rendering {
+
+    GeometryBuffer::GeometryBuffer(const uint64_t size) : m_allocator(size) {}
+
+    MeshAllocation GeometryBuffer::uploadMesh(const std::span<const std::byte> vertices, const uint32_t vertex_stride, const std::span<const uint32_t> indices)
+    {
+        NB_CORE_ASSERT(vertex_stride > 0 && !vertices.empty() && vertices.size() % vertex_stride == 0, "Mesh vertices don't match vertex stride!");
+        NB_CORE_ASSERT(!indices.empty(), "GeometryBuffer meshes have to be indexed!");
+
+        MeshAllocation mesh;
+        mesh.vertices = m_allocator.allocate(vertices.size(), vertex_stride);
+        mesh.indices = m_allocator.allocate(indices.size_bytes(), sizeof(uint32_t));
+
+        if (!mesh.valid())
+        {
+            m_allocator.free(mesh.vertices);
+            m_allocator.free(mesh.indices);
+
+            NB_CORE_WARN(
+                "GeometryBuffer can't fit mesh of {} bytes, {} of {} bytes used",
+                vertices.size() + indices.size_bytes(), m_allocator.getUsedSize(), m_allocator.getCapacity()
+            );
+            return {};
+        }
+
+        mesh.vertex_offset = static_cast<int32_t>(mesh.vertices.offset / vertex_stride);
+        mesh.vertex_count = static_cast<uint32_t>(vertices.size() / vertex_stride);
+        mesh.first_index = static_cast<uint32_t>(mesh.indices.offset / sizeof(uint32_t));
+        mesh.index_count = static_cast<uint32_t>(indices.size());
+
+        //  Tickets complete in order, so index upload ticket covers vertices too
+        writeData(mesh.vertices.offset, vertices.data(), vertices.size());
+        mesh.upload_ticket = writeData(mesh.indices.offset, indices.data(), indices.size_bytes());
+        ++m_mesh_count;
+
+        return mesh;
+    }
+
+    void GeometryBuffer::freeMesh(const MeshAllocation& mesh)
+    {
+        if (!mesh.valid())
+            return;
+
+        m_allocator.free(mesh.vertices);
+        m_allocator.free(mesh.indices);
+        --m_mesh_count;
+    }
+
+}
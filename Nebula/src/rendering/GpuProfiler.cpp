@@ -0,0 +1,148 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "rendering/GpuProfiler.h"
+
+#include <format>
+#include <algorithm>
+
+#include "core/Assert.h"
+
+namespace nebula::rendering {
+
+    static constexpr uint32_t s_pass_zone = UINT32_MAX;
+
+    GpuProfiler* GpuProfiler::s_instance = nullptr;
+
+    GpuProfiler::GpuProfiler(const uint32_t frames_in_flight) : m_frame_queries(frames_in_flight)
+    {
+        NB_CORE_ASSERT(!s_instance, "Can have only one GpuProfiler!");
+        s_instance = this;
+
+        for (auto& frame_queries : m_frame_queries)
+            frame_queries.zones.reserve(cMaxQueriesPerFrame / 2);
+    }
+
+    GpuProfiler::~GpuProfiler()
+    {
+        NB_CORE_ASSERT(s_instance);
+        s_instance = nullptr;
+    }
+
+    std::vector<GpuZoneStats> GpuProfiler::getZoneStats() const
+    {
+        std::lock_guard lock{m_stats_mutex};
+
+        std::vector<GpuZoneStats> zone_stats;
+        zone_stats.reserve(m_zone_history.size());
+
+        for (const auto& [zone_id, history] : m_zone_history)
+        {
+            const auto [pass, stage] = zone_id;
+
+            GpuZoneStats stats;
+            stats.pass = pass;
+            stats.milliseconds = history.last;
+            stats.average_milliseconds = history.sample_count > 0 ? history.sum / history.sample_count : 0.0;
+
+            if (stage == s_pass_zone)
+                stats.name = std::format("RenderPass {}", pass);
+            else
+            {
+                stats.stage = stage;
+                stats.name = std::format("RenderPass {} / Stage {}", pass, stage);
+            }
+
+            zone_stats.push_back(std::move(stats));
+        }
+
+        return zone_stats;
+    }
+
+    std::optional<uint32_t> GpuProfiler::beginZone(const uint32_t frame_in_flight, const bool stage)
+    {
+        auto& frame_queries = m_frame_queries[frame_in_flight];
+
+        //  Reserve both queries up front, so every written begin has matching end
+        if (frame_queries.used_queries + 2 > cMaxQueriesPerFrame)
+            return std::nullopt;
+
+        ZoneQueries zone;
+        zone.begin_query = frame_queries.used_queries++;
+        zone.end_query = frame_queries.used_queries++;
+
+        if (stage)
+        {
+            NB_CORE_ASSERT(frame_queries.open_pass, "GPU stage zone has to be inside render pass zone!");
+            NB_CORE_ASSERT(!frame_queries.open_stage, "GPU stage zones can't be nested!");
+
+            zone.pass = frame_queries.zones[*frame_queries.open_pass].pass;
+            zone.stage = frame_queries.stage_count++;
+            frame_queries.open_stage = static_cast<uint32_t>(frame_queries.zones.size());
+        }
+        else
+        {
+            NB_CORE_ASSERT(!frame_queries.open_pass, "GPU render pass zones can't be nested!");
+
+            zone.pass = frame_queries.pass_count++;
+            frame_queries.stage_count = 0;
+            frame_queries.open_pass = static_cast<uint32_t>(frame_queries.zones.size());
+        }
+
+        frame_queries.zones.push_back(zone);
+        return zone.begin_query;
+    }
+
+    std::optional<uint32_t> GpuProfiler::endZone(const uint32_t frame_in_flight, const bool stage)
+    {
+        auto& frame_queries = m_frame_queries[frame_in_flight];
+        auto& open_zone = stage ? frame_queries.open_stage : frame_queries.open_pass;
+
+        if (!open_zone)
+            return std::nullopt;
+
+        const uint32_t end_query = frame_queries.zones[*open_zone].end_query;
+        open_zone.reset();
+
+        return end_query;
+    }
+
+    void GpuProfiler::resolveFrame(
+        const uint32_t frame_in_flight,
+        const uint64_t* timestamps,
+        const double nanoseconds_per_tick,
+        const uint64_t valid_bits_mask
+    )
+    {
+        const auto& frame_queries = m_frame_queries[frame_in_flight];
+
+        std::lock_guard lock{m_stats_mutex};
+        for (const auto& zone : frame_queries.zones)
+        {
+            const uint64_t ticks = (timestamps[zone.end_query] - timestamps[zone.begin_query]) & valid_bits_mask;
+            const double milliseconds = static_cast<double>(ticks) * nanoseconds_per_tick * 1e-6;
+
+            auto& history = m_zone_history[{zone.pass, zone.stage.value_or(s_pass_zone)}];
+            history.sum += milliseconds - history.samples[history.next_sample];
+            history.samples[history.next_sample] = milliseconds;
+            history.next_sample = (history.next_sample + 1) % cAverageWindow;
+            history.sample_count = std::min(history.sample_count + 1, cAverageWindow);
+            history.last = milliseconds;
+        }
+    }
+
+    void GpuProfiler::resetFrame(const uint32_t frame_in_flight)
+    {
+        auto& frame_queries = m_frame_queries[frame_in_flight];
+
+        NB_CORE_ASSERT(!frame_queries.open_pass && !frame_queries.open_stage, "Unfinished GPU profiler zone!");
+
+        frame_queries.used_queries = 0;
+        frame_queries.pass_count = 0;
+        frame_queries.stage_count = 0;
+        frame_queries.zones.clear();
+    }
+
+}
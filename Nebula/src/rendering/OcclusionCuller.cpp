@@ -0,0 +1,446 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "rendering/culling/OcclusionCuller.h"
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "core/Timer.h"
+#include "core/Assert.h"
+#include "debug/Profiler.h"
+#include "debug/FrameCounters.h"
+#include "threads/JobSystem.h"
+#include "utility/SimdMath.h"
+
+namespace nebula::rendering {
+
+    static constexpr float cClearDepth = std::numeric_limits<float>::max();
+    static constexpr uint32_t cSetupChunkSize = 1024;      //  Occluder triangles per setup job
+    static constexpr uint32_t cTestChunkSize = 1024;       //  Objects per occlusion test job
+
+    static void runJobs(const uint32_t job_count, const auto& job)
+    {
+        if (threads::JobSystem::checkEnabled() && job_count > 1)
+            threads::JobSystem::get().parallelFor(job_count, [&](const uint32_t job_index, uint32_t) { job(job_index); });
+        else
+            for (uint32_t job_index = 0; job_index < job_count; ++job_index)
+                job(job_index);
+    }
+
+    OcclusionCuller::OcclusionCuller(const uint32_t width, const uint32_t height) :
+            m_width(width),
+            m_height(height),
+            m_tiles_x(width / cTileSize),
+            m_tiles_y(height / cTileSize)
+    {
+        NB_CORE_ASSERT(width > 0 && height > 0 && width % cTileSize == 0 && height % cTileSize == 0, "Occlusion buffer size has to be multiple of tile size!");
+
+        //  Every level halves previous one rounding up, down to single texel
+        uint32_t level_width = width;
+        uint32_t level_height = height;
+        while (true)
+        {
+            m_levels.push_back({level_width, level_height, std::vector(level_width * level_height, cClearDepth)});
+            if (level_width == 1 && level_height == 1)
+                break;
+
+            level_width = (level_width + 1) / 2;
+            level_height = (level_height + 1) / 2;
+        }
+    }
+
+    uint32_t OcclusionCuller::addOccluderMesh(std::vector<glm::vec3> vertices, std::vector<uint32_t> indices)
+    {
+        NB_CORE_ASSERT(indices.size() % 3 == 0, "Occluder mesh has to be triangle list!");
+        NB_CORE_ASSERT(std::ranges::all_of(indices, [&](const uint32_t index) { return index < vertices.size(); }), "Occluder mesh index out of range!");
+
+        m_meshes.push_back({std::move(vertices), std::move(indices)});
+        return static_cast<uint32_t>(m_meshes.size() - 1);
+    }
+
+    void OcclusionCuller::clearOccluderMeshes()
+    {
+        m_meshes.clear();
+        m_instances.clear();
+        m_triangle_count = 0;
+    }
+
+    void OcclusionCuller::beginFrame(const glm::mat4& view_projection)
+    {
+        m_view_projection = view_projection;
+        m_instances.clear();
+        m_triangle_count = 0;
+        m_statistics = {};
+
+        for (auto& level : m_levels)
+            std::ranges::fill(level.depth, cClearDepth);
+    }
+
+    void OcclusionCuller::addOccluder(const uint32_t mesh, const glm::mat4& transform)
+    {
+        NB_CORE_ASSERT(mesh < m_meshes.size(), "Invalid occluder mesh!");
+
+        const auto triangle_count = static_cast<uint32_t>(m_meshes[mesh].indices.size() / 3);
+        m_instances.push_back({mesh, m_triangle_count, m_view_projection * transform});
+
+        m_triangle_count += triangle_count;
+        m_statistics.occluder_triangles += triangle_count;
+    }
+
+    void OcclusionCuller::renderOccluders()
+    {
+        NB_PROFILE_SCOPE("Occluder rasterization");
+
+        Timer timer;
+
+        const uint32_t tile_count = m_tiles_x * m_tiles_y;
+        const uint32_t setup_jobs = (m_triangle_count + cSetupChunkSize - 1) / cSetupChunkSize;
+
+        if (m_setup_triangles.size() < setup_jobs)
+        {
+            m_setup_triangles.resize(setup_jobs);
+            m_tile_bins.resize(setup_jobs * tile_count);
+        }
+
+        //  Jobs left from frames with more occluders would be rasterized again
+        for (uint32_t job = setup_jobs; job < m_setup_triangles.size(); ++job)
+            m_setup_triangles[job].clear();
+
+        runJobs(setup_jobs, [this](const uint32_t job_index) { setupTriangles(job_index); });
+
+        for (uint32_t job = 0; job < setup_jobs; ++job)
+            m_statistics.rasterized_triangles += static_cast<uint32_t>(m_setup_triangles[job].size());
+
+        //  Tiles own disjoint pixels, so they are rasterized without synchronization
+        if (m_statistics.rasterized_triangles > 0)
+        {
+            runJobs(tile_count, [this](const uint32_t tile) { rasterizeTile(tile); });
+            buildHiZ();
+        }
+
+        m_statistics.raster_milliseconds = timer.elapsedMilliSeconds();
+    }
+
+    bool OcclusionCuller::isOccluded(const BoundingBox& bounds) const
+    {
+        //  Corners are center offset by signed transformed extents, one matrix multiply per axis instead of per corner
+        const glm::vec3 center = (bounds.min + bounds.max) * 0.5f;
+        const glm::vec3 extent = (bounds.max - bounds.min) * 0.5f;
+
+        const glm::vec4 clip_center = m_view_projection * glm::vec4(center, 1.0f);
+        const glm::vec4 clip_x = m_view_projection[0] * extent.x;
+        const glm::vec4 clip_y = m_view_projection[1] * extent.y;
+        const glm::vec4 clip_z = m_view_projection[2] * extent.z;
+
+        float min_x = std::numeric_limits<float>::max();
+        float min_y = std::numeric_limits<float>::max();
+        float max_x = std::numeric_limits<float>::lowest();
+        float max_y = std::numeric_limits<float>::lowest();
+        float min_depth = std::numeric_limits<float>::max();
+
+        for (uint32_t corner = 0; corner < 8; ++corner)
+        {
+            const glm::vec4 clip = clip_center +
+                                   (corner & 1 ? clip_x : clip_x * -1.0f) +
+                                   (corner & 2 ? clip_y : clip_y * -1.0f) +
+                                   (corner & 4 ? clip_z : clip_z * -1.0f);
+
+            //  Bounds crossing near plane cover unbounded screen area
+            if (clip.w <= 0.0f || clip.z < -clip.w)
+                return false;
+
+            const float inverse_w = 1.0f / clip.w;
+            min_x = std::min(min_x, clip.x * inverse_w);
+            max_x = std::max(max_x, clip.x * inverse_w);
+            min_y = std::min(min_y, clip.y * inverse_w);
+            max_y = std::max(max_y, clip.y * inverse_w);
+            min_depth = std::min(min_depth, clip.z * inverse_w);
+        }
+
+        const auto width = static_cast<float>(m_width);
+        const auto height = static_cast<float>(m_height);
+
+        min_x = (min_x * 0.5f + 0.5f) * width;
+        max_x = (max_x * 0.5f + 0.5f) * width;
+        min_y = (min_y * 0.5f + 0.5f) * height;
+        max_y = (max_y * 0.5f + 0.5f) * height;
+
+        //  Off screen bounds are left to frustum culling
+        if (max_x < 0.0f || max_y < 0.0f || min_x >= width || min_y >= height)
+            return false;
+
+        //  Every pixel touched by screen rectangle, even when its center lies outside
+        const auto pixel_min_x = static_cast<uint32_t>(std::max(min_x, 0.0f));
+        const auto pixel_min_y = static_cast<uint32_t>(std::max(min_y, 0.0f));
+        const auto pixel_max_x = static_cast<uint32_t>(std::min(max_x, width - 1.0f));
+        const auto pixel_max_y = static_cast<uint32_t>(std::min(max_y, height - 1.0f));
+
+        //  Coarsest useful level is the one where rectangle spans at most 2x2 texels
+        uint32_t level = 0;
+        while ((pixel_max_x >> level) - (pixel_min_x >> level) > 1 || (pixel_max_y >> level) - (pixel_min_y >> level) > 1)
+            ++level;
+
+        const auto& hiz = m_levels[level];
+        float max_depth = std::numeric_limits<float>::lowest();
+        for (uint32_t y = pixel_min_y >> level; y <= pixel_max_y >> level; ++y)
+            for (uint32_t x = pixel_min_x >> level; x <= pixel_max_x >> level; ++x)
+                max_depth = std::max(max_depth, hiz.depth[y * hiz.width + x]);
+
+        return min_depth > max_depth;
+    }
+
+    uint32_t OcclusionCuller::cullOccluded(const CullingBounds& bounds, std::vector<uint32_t>& indices)
+    {
+        NB_PROFILE_SCOPE("Occlusion culling");
+
+        Timer timer;
+
+        const auto tested_count = static_cast<uint32_t>(indices.size());
+        m_visibility.resize(tested_count);
+
+        const uint32_t test_jobs = (tested_count + cTestChunkSize - 1) / cTestChunkSize;
+        runJobs(test_jobs, [&](const uint32_t job_index)
+        {
+            const uint32_t begin = job_index * cTestChunkSize;
+            const uint32_t end = std::min(begin + cTestChunkSize, tested_count);
+
+            for (uint32_t i = begin; i < end; ++i)
+                m_visibility[i] = !isOccluded(bounds.getBox(indices[i]));
+        });
+
+        uint32_t visible_count = 0;
+        for (uint32_t i = 0; i < tested_count; ++i)
+            if (m_visibility[i])
+                indices[visible_count++] = indices[i];
+
+        indices.resize(visible_count);
+
+        m_statistics.tested += tested_count;
+        m_statistics.occluded += tested_count - visible_count;
+        m_statistics.test_milliseconds += timer.elapsedMilliSeconds();
+
+        NB_COUNT(cObjectsOccluded, tested_count - visible_count);
+
+        return visible_count;
+    }
+
+    void OcclusionCuller::setupTriangles(const uint32_t job_index)
+    {
+        const uint32_t tile_count = m_tiles_x * m_tiles_y;
+
+        m_setup_triangles[job_index].clear();
+        for (uint32_t tile = 0; tile < tile_count; ++tile)
+            m_tile_bins[job_index * tile_count + tile].clear();
+
+        const uint32_t begin = job_index * cSetupChunkSize;
+        const uint32_t end = std::min(begin + cSetupChunkSize, m_triangle_count);
+
+        auto instance = std::ranges::upper_bound(m_instances, begin, {}, &OccluderInstance::first_triangle) - 1;
+        for (uint32_t triangle = begin; triangle < end; ++triangle)
+        {
+            while (triangle >= instance->first_triangle + m_meshes[instance->mesh].indices.size() / 3)
+                ++instance;
+
+            const auto& mesh = m_meshes[instance->mesh];
+            const uint32_t* indices = mesh.indices.data() + (triangle - instance->first_triangle) * 3;
+
+            glm::vec4 input[3];
+            for (uint32_t i = 0; i < 3; ++i)
+                input[i] = instance->transform * glm::vec4(mesh.vertices[indices[i]], 1.0f);
+
+            //  Clipping against near plane z + w >= 0 turns triangle into polygon of up to 4 vertices
+            glm::vec4 polygon[4];
+            uint32_t vertex_count = 0;
+            for (uint32_t i = 0; i < 3; ++i)
+            {
+                const glm::vec4& current = input[i];
+                const glm::vec4& next = input[(i + 1) % 3];
+                const float current_distance = current.z + current.w;
+                const float next_distance = next.z + next.w;
+
+                if (current_distance >= 0.0f)
+                    polygon[vertex_count++] = current;
+                if ((current_distance >= 0.0f) != (next_distance >= 0.0f))
+                    polygon[vertex_count++] = current + (next - current) * (current_distance / (current_distance - next_distance));
+            }
+
+            for (uint32_t i = 2; i < vertex_count; ++i)
+                setupTriangle(job_index, polygon[0], polygon[i - 1], polygon[i]);
+        }
+    }
+
+    void OcclusionCuller::setupTriangle(const uint32_t job_index, const glm::vec4& v0, const glm::vec4& v1, const glm::vec4& v2)
+    {
+        if (v0.w <= 0.0f || v1.w <= 0.0f || v2.w <= 0.0f)
+            return;
+
+        const auto width = static_cast<float>(m_width);
+        const auto height = static_cast<float>(m_height);
+
+        float x[3], y[3], z[3];
+        const glm::vec4* vertices[3] = {&v0, &v1, &v2};
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            const float inverse_w = 1.0f / vertices[i]->w;
+            x[i] = (vertices[i]->x * inverse_w * 0.5f + 0.5f) * width;
+            y[i] = (vertices[i]->y * inverse_w * 0.5f + 0.5f) * height;
+            z[i] = vertices[i]->z * inverse_w;
+        }
+
+        //  Occluders are double sided, triangles are turned counter clockwise
+        float area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+        if (!(std::abs(area) > 0.0f))
+            return;
+
+        if (area < 0.0f)
+        {
+            std::swap(x[1], x[2]);
+            std::swap(y[1], y[2]);
+            std::swap(z[1], z[2]);
+            area = -area;
+        }
+
+        const float min_x = std::min({x[0], x[1], x[2]});
+        const float min_y = std::min({y[0], y[1], y[2]});
+        const float max_x = std::max({x[0], x[1], x[2]});
+        const float max_y = std::max({y[0], y[1], y[2]});
+
+        if (max_x < 0.0f || max_y < 0.0f || min_x >= width || min_y >= height)
+            return;
+
+        SetupTriangle triangle;
+        triangle.min_x = static_cast<int32_t>(std::max(min_x, 0.0f));
+        triangle.min_y = static_cast<int32_t>(std::max(min_y, 0.0f));
+        triangle.max_x = static_cast<int32_t>(std::min(max_x, width - 1.0f));
+        triangle.max_y = static_cast<int32_t>(std::min(max_y, height - 1.0f));
+
+        //  Edge i goes from vertex i to next one, it is positive on the side of remaining vertex
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            const uint32_t next = (i + 1) % 3;
+            triangle.edge_a[i] = y[i] - y[next];
+            triangle.edge_b[i] = x[next] - x[i];
+            triangle.edge_c[i] = -(triangle.edge_a[i] * x[i] + triangle.edge_b[i] * y[i]);
+        }
+
+        //  Barycentrics of vertices 1 and 2 are edge functions 2 and 0 divided by area
+        const float inverse_area = 1.0f / area;
+        const float depth_1 = (z[1] - z[0]) * inverse_area;
+        const float depth_2 = (z[2] - z[0]) * inverse_area;
+        triangle.depth_a = depth_1 * triangle.edge_a[2] + depth_2 * triangle.edge_a[0];
+        triangle.depth_b = depth_1 * triangle.edge_b[2] + depth_2 * triangle.edge_b[0];
+        triangle.depth_c = z[0] + depth_1 * triangle.edge_c[2] + depth_2 * triangle.edge_c[0];
+
+        auto& triangles = m_setup_triangles[job_index];
+        const auto index = static_cast<uint32_t>(triangles.size());
+        triangles.push_back(triangle);
+
+        const uint32_t tile_count = m_tiles_x * m_tiles_y;
+        const auto tile_size = static_cast<int32_t>(cTileSize);
+        for (int32_t tile_y = triangle.min_y / tile_size; tile_y <= triangle.max_y / tile_size; ++tile_y)
+            for (int32_t tile_x = triangle.min_x / tile_size; tile_x <= triangle.max_x / tile_size; ++tile_x)
+                m_tile_bins[job_index * tile_count + tile_y * m_tiles_x + tile_x].push_back(index);
+    }
+
+    void OcclusionCuller::rasterizeTile(const uint32_t tile)
+    {
+        const uint32_t tile_count = m_tiles_x * m_tiles_y;
+        const auto tile_min_x = static_cast<int32_t>(tile % m_tiles_x * cTileSize);
+        const auto tile_min_y = static_cast<int32_t>(tile / m_tiles_x * cTileSize);
+        const int32_t tile_max_x = tile_min_x + static_cast<int32_t>(cTileSize) - 1;
+        const int32_t tile_max_y = tile_min_y + static_cast<int32_t>(cTileSize) - 1;
+
+        float* depth = m_levels[0].depth.data();
+
+        for (uint32_t job = 0; job < m_setup_triangles.size(); ++job)
+        {
+            const auto& triangles = m_setup_triangles[job];
+            if (triangles.empty())
+                continue;
+
+            for (const uint32_t index : m_tile_bins[job * tile_count + tile])
+            {
+                const SetupTriangle& triangle = triangles[index];
+
+                //  Rows start at 4 pixel boundary, tile width is multiple of 4 so whole groups stay inside tile
+                const int32_t min_x = std::max(triangle.min_x, tile_min_x) & ~3;
+                const int32_t max_x = std::min(triangle.max_x, tile_max_x);
+                const int32_t min_y = std::max(triangle.min_y, tile_min_y);
+                const int32_t max_y = std::min(triangle.max_y, tile_max_y);
+
+                for (int32_t y = min_y; y <= max_y; ++y)
+                {
+                    const float pixel_y = static_cast<float>(y) + 0.5f;
+                    float* row = depth + y * m_width;
+
+                    float row_edge[3];
+                    for (uint32_t i = 0; i < 3; ++i)
+                        row_edge[i] = triangle.edge_b[i] * pixel_y + triangle.edge_c[i];
+                    const float row_depth = triangle.depth_b * pixel_y + triangle.depth_c;
+
+                    #ifdef NB_SIMD_SSE
+                    const __m128 pixel_offsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+                    const __m128 zero = _mm_setzero_ps();
+
+                    for (int32_t x = min_x; x <= max_x; x += 4)
+                    {
+                        const __m128 pixel_x = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), pixel_offsets);
+
+                        __m128 inside = _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(triangle.edge_a[0]), pixel_x), _mm_set1_ps(row_edge[0])), zero);
+                        inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(triangle.edge_a[1]), pixel_x), _mm_set1_ps(row_edge[1])), zero));
+                        inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(triangle.edge_a[2]), pixel_x), _mm_set1_ps(row_edge[2])), zero));
+                        if (_mm_movemask_ps(inside) == 0)
+                            continue;
+
+                        const __m128 pixel_depth = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(triangle.depth_a), pixel_x), _mm_set1_ps(row_depth));
+                        const __m128 previous_depth = _mm_loadu_ps(row + x);
+                        const __m128 nearest_depth = _mm_min_ps(previous_depth, pixel_depth);
+
+                        _mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, nearest_depth), _mm_andnot_ps(inside, previous_depth)));
+                    }
+                    #else
+                    for (int32_t x = min_x; x <= max_x; ++x)
+                    {
+                        const float pixel_x = static_cast<float>(x) + 0.5f;
+
+                        const bool inside = triangle.edge_a[0] * pixel_x + row_edge[0] >= 0.0f &&
+                                            triangle.edge_a[1] * pixel_x + row_edge[1] >= 0.0f &&
+                                            triangle.edge_a[2] * pixel_x + row_edge[2] >= 0.0f;
+                        if (inside)
+                            row[x] = std::min(row[x], triangle.depth_a * pixel_x + row_depth);
+                    }
+                    #endif
+                }
+            }
+        }
+    }
+
+    void OcclusionCuller::buildHiZ()
+    {
+        //  Texel keeps farthest depth of 2x2 texels below it, odd edges repeat last row or column
+        for (uint32_t level = 1; level < m_levels.size(); ++level)
+        {
+            const HiZLevel& source = m_levels[level - 1];
+            HiZLevel& target = m_levels[level];
+
+            for (uint32_t y = 0; y < target.height; ++y)
+            {
+                const float* row_0 = source.depth.data() + 2 * y * source.width;
+                const float* row_1 = source.depth.data() + std::min(2 * y + 1, source.height - 1) * source.width;
+
+                for (uint32_t x = 0; x < target.width; ++x)
+                {
+                    const uint32_t x_0 = 2 * x;
+                    const uint32_t x_1 = std::min(2 * x + 1, source.width - 1);
+
+                    target.depth[y * target.width + x] = std::max(std::max(row_0[x_0], row_0[x_1]), std::max(row_1[x_0], row_1[x_1]));
+                }
+            }
+        }
+    }
+
+}
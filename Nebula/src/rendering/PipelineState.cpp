@@ -9,6 +9,35 @@
 
 namespace nebula::rendering {
 
+    //////////////////////////////////////////////////////////////////
+    /////////  VertexLayout  /////////////////////////////////////////
+    //////////////////////////////////////////////////////////////////
+
+    VertexLayout VertexLayout::createInterleaved(const std::initializer_list<VertexFormat> formats, const VertexInputRate input_rate)
+    {
+        VertexLayout layout;
+
+        uint32_t offset = 0;
+        for (const VertexFormat format : formats)
+        {
+            layout.attributes.push_back({static_cast<uint32_t>(layout.attributes.size()), 0, format, offset});
+            offset += getVertexFormatSize(format);
+        }
+
+        layout.bindings.push_back({0, offset, input_rate});
+
+        return layout;
+    }
+
+    uint32_t VertexLayout::getStride(const uint32_t binding) const
+    {
+        for (const auto& vertex_binding : bindings)
+            if (vertex_binding.binding == binding)
+                return vertex_binding.stride;
+
+        return 0;
+    }
+
     //////////////////////////////////////////////////////////////////
     /////////  Hash functors  ////////////////////////////////////////
     //////////////////////////////////////////////////////////////////
@@ -19,6 +48,51 @@ namespace nebula::rendering {
         seed = boost::hash_detail::hash_mix(seed + 0x9e3779b9 + HashFunctor()(v));
     }
 
+    std::size_t VertexLayoutHash::operator() (const VertexLayout& layout) const
+    {
+        std::size_t seed = 0;
+        for (const auto& [binding, stride, input_rate] : layout.bindings)
+        {
+            boost::hash_combine(seed, binding);
+            boost::hash_combine(seed, stride);
+            boost::hash_combine(seed, input_rate);
+        }
+
+        for (const auto& [location, binding, format, offset] : layout.attributes)
+        {
+            boost::hash_combine(seed, location);
+            boost::hash_combine(seed, binding);
+            boost::hash_combine(seed, format);
+            boost::hash_combine(seed, offset);
+        }
+
+        return seed;
+    }
+
+    std::size_t DescriptorSetLayoutHash::operator() (const DescriptorSetLayout& layout) const
+    {
+        std::size_t seed = 0;
+        for (const auto& [binding, count, type, stages] : layout.bindings)
+        {
+            boost::hash_combine(seed, binding);
+            boost::hash_combine(seed, count);
+            boost::hash_combine(seed, type);
+            boost::hash_combine(seed, stages);
+        }
+
+        return seed;
+    }
+
+    std::size_t PipelineLayoutHash::operator() (const PipelineLayout& layout) const
+    {
+        std::size_t seed = 0;
+        boost::hash_combine(seed, layout.bindless);
+        for (const auto& descriptor_set : layout.descriptor_sets)
+            hash_combine<DescriptorSetLayoutHash>(seed, descriptor_set);
+
+        return seed;
+    }
+
     std::size_t InputAssemblyHash::operator() (const InputAssemblyState& state) const
     {
         std::size_t seed = 0;
@@ -69,6 +143,12 @@ namespace nebula::rendering {
     {
         std::size_t seed = 0;
         boost::hash_combine(seed, state.enabled);
+        boost::hash_combine(seed, state.src_color_factor);
+        boost::hash_combine(seed, state.dst_color_factor);
+        boost::hash_combine(seed, state.color_operation);
+        boost::hash_combine(seed, state.src_alpha_factor);
+        boost::hash_combine(seed, state.dst_alpha_factor);
+        boost::hash_combine(seed, state.alpha_operation);
 
         return seed;
     }
@@ -77,6 +157,8 @@ namespace nebula::rendering {
     {
         std::size_t seed = 0;
         boost::hash_combine(seed, state.shader->getName());
+        hash_combine<VertexLayoutHash>(seed, state.vertex_layout);
+        hash_combine<PipelineLayoutHash>(seed, state.pipeline_layout);
         hash_combine<InputAssemblyHash>(seed, state.input_assembly);
         hash_combine<RasterizationHash>(seed, state.rasterization);
         hash_combine<MultisamplingHash>(seed, state.multisampling);
@@ -120,6 +202,8 @@ namespace nebula::rendering {
     bool operator == (const GraphicsPipelineState& lhs, const GraphicsPipelineState& rhs)
     {
         return  lhs.shader->getName() == rhs.shader->getName() &&
+                lhs.vertex_layout == rhs.vertex_layout &&
+                lhs.pipeline_layout == rhs.pipeline_layout &&
                 lhs.depth_stencil == rhs.depth_stencil &&
                 lhs.color_blending == rhs.color_blending &&
                 lhs.rasterization == rhs.rasterization &&
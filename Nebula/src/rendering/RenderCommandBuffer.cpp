@@ -24,6 +24,10 @@ namespace nebula::rendering {
 
     void RenderCommandBuffer::reset()
     {
+        //  Allocator only releases memory, commands may own resources (e.g. GraphicsPipelineState)
+        for (const auto command : m_commands)
+            std::destroy_at(command);
+
         m_allocator.clear();
         m_commands.clear();
     }
@@ -40,10 +44,7 @@ namespace nebula::rendering {
 
     Scope<RenderCommandBuffer> RenderCommandBuffer::create()
     {
-        auto& config = Config::getEngineConfig();
-        const auto command_buffer_size = config["memory"]["event_queue_size"].as<size_t>();
-
-        return createScopeFromPointer(new RenderCommandBuffer(command_buffer_size));
+        return createScopeFromPointer(new RenderCommandBuffer(Config::getEngineSettings().memory.render_command_buffer_size));
     }
 
 }
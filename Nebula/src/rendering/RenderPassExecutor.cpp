@@ -6,6 +6,7 @@
 #include "rendering/renderpass/RenderPassExecutor.h"
 
 #include "core/Assert.h"
+#include "debug/Profiler.h"
 
 namespace nebula::rendering {
 
@@ -27,10 +28,16 @@ namespace nebula::rendering {
 
     }
 
-    Scope<RecordedCommandBuffer> RenderPassExecutor::execute(const RenderPassObjects& renderpass_objects, const std::optional<uint32_t> frame_in_flight) const
+    RecordedCommandBuffer& RenderPassExecutor::execute(const RenderPassObjects& renderpass_objects, const std::optional<uint32_t> frame_in_flight)
     {
+        NB_PROFILE_FUNCTION();
+
         NB_CORE_ASSERT(m_renderer, "Renderer has to be set to begin execution!");
 
+        //  Previous frame commands were already executed
+        if (m_recorded_commands)
+            recycleCommandBuffer(std::move(m_recorded_commands));
+
         const auto renderpass = m_renderer->viewRenderPass();
 
         m_renderer->beginRenderPass();
@@ -51,9 +58,15 @@ namespace nebula::rendering {
         return recordCommands(m_renderer->getCommandBuffer(), frame_in_flight);
     }
 
-    Scope<RecordedCommandBuffer> RenderPassExecutor::recordCommands(Scope<RenderCommandBuffer>&& commands, std::optional<uint32_t> frame_in_flight) const
+    RecordedCommandBuffer& RenderPassExecutor::recordCommands(Scope<RenderCommandBuffer>&& commands, std::optional<uint32_t> frame_in_flight)
+    {
+        m_recorded_commands = std::move(commands);
+        return *m_recorded_commands;
+    }
+
+    void RenderPassExecutor::recycleCommandBuffer(Scope<RenderCommandBuffer>&& commands) const
     {
-        return commands;
+        m_renderer->recycleCommandBuffer(std::move(commands));
     }
 
     void RenderPassExecutor::setRenderer(Scope<Renderer>&& renderer)
@@ -25,6 +25,12 @@ namespace nebula::rendering {
         m_stage_objects[stage].push_back(object);
     }
 
+    void RenderPassObjects::clearObjects()
+    {
+        for (auto& stage_objects : m_stage_objects)
+            stage_objects.clear();
+    }
+
     const RenderPassObjects::StageObjects& RenderPassObjects::viewStageObjects(const uint32_t stage) const
     {
         NB_CORE_ASSERT(stage < m_stage_objects.size(), "Stage out of range!");
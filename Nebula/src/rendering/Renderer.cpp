@@ -20,7 +20,7 @@ namespace nebula::rendering {
         NB_CORE_ASSERT(m_renderpass_state != cStarted, "Finish previous renderpass before starting new one!");
 
         m_renderpass_state = cStarted;
-        m_command_buffer = RenderCommandBuffer::create();
+        m_command_buffer = m_free_command_buffer ? std::move(m_free_command_buffer) : RenderCommandBuffer::create();
 
         submitCommand<BeginRenderPassCommand>(*m_renderpass.get(), m_render_area);
 
@@ -44,7 +44,7 @@ namespace nebula::rendering {
     {
         NB_CORE_ASSERT(m_renderpass_state == cStarted, "Start renderpass before moving to next RenderStage!");
 
-        auto graphics_pipeline_state = m_renderpass->nextStage();
+        const auto& graphics_pipeline_state = m_renderpass->nextStage();
         const uint32_t stage = m_renderpass->getCurrentStage();
         void* graphics_pipeline_handle = RendererApi::get().getPipelineHandle(*m_renderpass.get(), stage);
 
@@ -59,6 +59,14 @@ namespace nebula::rendering {
         return nullptr;
     }
 
+    void Renderer::recycleCommandBuffer(Scope<RenderCommandBuffer>&& command_buffer)
+    {
+        NB_CORE_ASSERT(command_buffer);
+
+        command_buffer->reset();
+        m_free_command_buffer = std::move(command_buffer);
+    }
+
     void Renderer::setRenderPass(Scope<RenderPass>&& renderpass)
     {
         m_renderpass = std::move(renderpass);
@@ -133,4 +141,17 @@ namespace nebula::rendering {
         submitCommand<DrawDummyIndicesCommand>(render_object.getNumIndices());
     }
 
+    void Renderer::draw(const MeshRenderObject& render_object)
+    {
+        NB_CORE_ASSERT(m_renderpass_state == cStarted, "Start RenderPass to draw RenderObjects!");
+        NB_CORE_ASSERT(render_object.viewMesh().valid(), "MeshRenderObject requires valid mesh!");
+
+        //  Mesh isn't resident yet, drawing it would read stale buffer contents
+        const auto& geometry_buffer = render_object.viewGeometryBuffer();
+        if (!geometry_buffer.checkUploaded(render_object.viewMesh()))
+            return;
+
+        submitCommand<DrawMeshCommand>(geometry_buffer.getBufferHandle(), render_object.viewMesh(), render_object.getInstanceCount());
+    }
+
 }
@@ -0,0 +1,223 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "rendering/VertexFormats.h"
+
+#include <bit>
+#include <cmath>
+#include <algorithm>
+
+namespace nebula::rendering {
+
+    uint32_t getVertexFormatSize(const VertexFormat format)
+    {
+        switch (format)
+        {
+            case VertexFormat::cFloat:      return 4;
+            case VertexFormat::cFloat2:     return 8;
+            case VertexFormat::cFloat3:     return 12;
+            case VertexFormat::cFloat4:     return 16;
+            case VertexFormat::cHalf2:      return 4;
+            case VertexFormat::cHalf4:      return 8;
+            case VertexFormat::cSnorm16x2:  return 4;
+            case VertexFormat::cSnorm16x4:  return 8;
+            case VertexFormat::cUnorm16x2:  return 4;
+            case VertexFormat::cSnorm8x4:   return 4;
+            case VertexFormat::cUnorm8x4:   return 4;
+            case VertexFormat::cUint32:     return 4;
+        }
+
+        return 0;
+    }
+
+    uint32_t getVertexFormatComponents(const VertexFormat format)
+    {
+        switch (format)
+        {
+            case VertexFormat::cFloat:
+            case VertexFormat::cUint32:
+                return 1;
+            case VertexFormat::cFloat2:
+            case VertexFormat::cHalf2:
+            case VertexFormat::cSnorm16x2:
+            case VertexFormat::cUnorm16x2:
+                return 2;
+            case VertexFormat::cFloat3:
+                return 3;
+            case VertexFormat::cFloat4:
+            case VertexFormat::cHalf4:
+            case VertexFormat::cSnorm16x4:
+            case VertexFormat::cSnorm8x4:
+            case VertexFormat::cUnorm8x4:
+                return 4;
+        }
+
+        return 0;
+    }
+
+    bool isIntegerVertexFormat(const VertexFormat format)
+    {
+        return format == VertexFormat::cUint32;
+    }
+
+    ////////////////////////////////////////////////////////////////////
+    //////  Vertex packing  ////////////////////////////////////////////
+    ////////////////////////////////////////////////////////////////////
+
+    uint16_t packHalf(const float value)
+    {
+        const uint32_t bits = std::bit_cast<uint32_t>(value);
+        const auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+        const int32_t exponent = static_cast<int32_t>((bits >> 23) & 0xff);
+        uint32_t mantissa = bits & 0x7fffff;
+
+        //  Infinity and NaN, NaN keeps quiet bit so it doesn't turn into infinity
+        if (exponent == 0xff)
+            return sign | static_cast<uint16_t>(0x7c00 | (mantissa ? 0x200 | (mantissa >> 13) : 0));
+
+        const int32_t half_exponent = exponent - 127 + 15;
+        if (half_exponent >= 31)
+            return sign | uint16_t{0x7c00};
+
+        //  Subnormal half, implicit bit becomes part of mantissa
+        if (half_exponent <= 0)
+        {
+            if (half_exponent < -10)
+                return sign;
+
+            mantissa |= 0x800000;
+            const uint32_t shift = 14 - half_exponent;
+            uint32_t half_mantissa = mantissa >> shift;
+
+            const uint32_t remainder = mantissa & ((1u << shift) - 1);
+            const uint32_t halfway = 1u << (shift - 1);
+            if (remainder > halfway || (remainder == halfway && (half_mantissa & 1)))
+                ++half_mantissa;
+
+            return sign | static_cast<uint16_t>(half_mantissa);
+        }
+
+        //  Rounding carry may overflow into exponent, which is still correct encoding
+        uint32_t half = (static_cast<uint32_t>(half_exponent) << 10) | (mantissa >> 13);
+        const uint32_t remainder = mantissa & 0x1fff;
+        if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1)))
+            ++half;
+
+        return sign | static_cast<uint16_t>(half);
+    }
+
+    float unpackHalf(const uint16_t value)
+    {
+        const uint32_t sign = static_cast<uint32_t>(value & 0x8000) << 16;
+        const uint32_t exponent = (value >> 10) & 0x1f;
+        const uint32_t mantissa = value & 0x3ff;
+
+        if (exponent == 0)
+        {
+            const float magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+            return sign ? -magnitude : magnitude;
+        }
+
+        if (exponent == 0x1f)
+            return std::bit_cast<float>(sign | 0x7f800000 | (mantissa << 13));
+
+        return std::bit_cast<float>(sign | ((exponent - 15 + 127) << 23) | (mantissa << 13));
+    }
+
+    int16_t packSnorm16(const float value)
+    {
+        return static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+    }
+
+    float unpackSnorm16(const int16_t value)
+    {
+        //  Both -32768 and -32767 map to -1
+        return std::max(static_cast<float>(value) / 32767.0f, -1.0f);
+    }
+
+    uint16_t packUnorm16(const float value)
+    {
+        return static_cast<uint16_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 65535.0f));
+    }
+
+    float unpackUnorm16(const uint16_t value)
+    {
+        return static_cast<float>(value) / 65535.0f;
+    }
+
+    static float signNotZero(const float value)
+    {
+        return value >= 0.0f ? 1.0f : -1.0f;
+    }
+
+    glm::vec2 encodeOctahedral(const glm::vec3& normal)
+    {
+        const float length = std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z);
+        if (length <= 0.0f)
+            return {0.0f, 0.0f};
+
+        glm::vec2 encoded{normal.x / length, normal.y / length};
+
+        //  Lower hemisphere is folded over diagonals
+        if (normal.z < 0.0f)
+        {
+            const float x = encoded.x;
+            encoded.x = (1.0f - std::abs(encoded.y)) * signNotZero(x);
+            encoded.y = (1.0f - std::abs(x)) * signNotZero(encoded.y);
+        }
+
+        return encoded;
+    }
+
+    glm::vec3 decodeOctahedral(const glm::vec2& encoded)
+    {
+        glm::vec3 normal{encoded.x, encoded.y, 1.0f - std::abs(encoded.x) - std::abs(encoded.y)};
+
+        const float fold = std::max(-normal.z, 0.0f);
+        normal.x += normal.x >= 0.0f ? -fold : fold;
+        normal.y += normal.y >= 0.0f ? -fold : fold;
+
+        const float length = std::sqrt(normal.x * normal.x + normal.y * normal.y + normal.z * normal.z);
+        return {normal.x / length, normal.y / length, normal.z / length};
+    }
+
+    ////////////////////////////////////////////////////////////////////
+    //////  VertexQuantization  ////////////////////////////////////////
+    ////////////////////////////////////////////////////////////////////
+
+    VertexQuantization VertexQuantization::fromBounds(const glm::vec3& min, const glm::vec3& max)
+    {
+        //  Flat bounds would divide by zero
+        static constexpr float cMinScale = 1e-6f;
+
+        VertexQuantization quantization;
+        quantization.offset = (min + max) * 0.5f;
+        quantization.scale = {
+            std::max((max.x - min.x) * 0.5f, cMinScale),
+            std::max((max.y - min.y) * 0.5f, cMinScale),
+            std::max((max.z - min.z) * 0.5f, cMinScale)
+        };
+
+        return quantization;
+    }
+
+    void VertexQuantization::quantizePosition(const glm::vec3& position, int16_t* packed) const
+    {
+        packed[0] = packSnorm16((position.x - offset.x) / scale.x);
+        packed[1] = packSnorm16((position.y - offset.y) / scale.y);
+        packed[2] = packSnorm16((position.z - offset.z) / scale.z);
+        packed[3] = 0;
+    }
+
+    glm::vec3 VertexQuantization::dequantizePosition(const int16_t* packed) const
+    {
+        return {
+            offset.x + unpackSnorm16(packed[0]) * scale.x,
+            offset.y + unpackSnorm16(packed[1]) * scale.y,
+            offset.z + unpackSnorm16(packed[2]) * scale.z
+        };
+    }
+
+}
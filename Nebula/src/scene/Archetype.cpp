@@ -0,0 +1,124 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "scene/Archetype.h"
+
+#include <format>
+
+#include "core/Assert.h"
+
+namespace nebula::scene {
+
+    Archetype::Archetype(const ComponentMask& mask, ChunkAllocator& chunk_allocator) : m_mask(mask), m_chunk_allocator(chunk_allocator)
+    {
+        std::size_t row_size = sizeof(Entity);
+        for (ComponentID component = 0; component < cMaxComponents; ++component)
+        {
+            if (!mask.test(component))
+                continue;
+
+            const auto& info = ComponentRegistry::getInfo(component);
+            NB_CORE_ASSERT(info.alignment <= cChunkAlignment, std::format("Component {} is over aligned for archetype chunk!", info.name));
+
+            m_components.push_back(component);
+            row_size += info.size;
+        }
+
+        //  Padding between columns can only lower capacity estimated from row size
+        m_chunk_capacity = static_cast<uint32_t>(cChunkSize / row_size);
+        while (m_chunk_capacity > 0 && computeLayout(m_chunk_capacity) > cChunkSize)
+            --m_chunk_capacity;
+
+        NB_CORE_ASSERT(m_chunk_capacity > 0, "Archetype components don't fit in single chunk!");
+    }
+
+    Archetype::~Archetype()
+    {
+        for (uint32_t chunk_index = 0; chunk_index < m_chunks.size(); ++chunk_index)
+        {
+            for (uint32_t row = 0; row < m_chunks[chunk_index].count; ++row)
+                destroyComponents({this, chunk_index, row});
+
+            m_chunk_allocator.deallocateChunk(m_chunks[chunk_index].memory);
+        }
+    }
+
+    EntityLocation Archetype::pushEntity(const Entity entity)
+    {
+        if (m_chunks.empty() || m_chunks.back().count == m_chunk_capacity)
+            m_chunks.push_back({m_chunk_allocator.allocateChunk(), 0});
+
+        auto& chunk = m_chunks.back();
+        const uint32_t row = chunk.count++;
+        getEntities(chunk)[row] = entity;
+        ++m_entity_count;
+
+        return {this, static_cast<uint32_t>(m_chunks.size() - 1), row};
+    }
+
+    Entity Archetype::removeEntity(const uint32_t chunk, const uint32_t row)
+    {
+        NB_CORE_ASSERT(chunk < m_chunks.size() && row < m_chunks[chunk].count, "Invalid archetype row!");
+
+        auto& last_chunk = m_chunks.back();
+        const uint32_t last_row = last_chunk.count - 1;
+
+        Entity moved_entity = cNullEntity;
+        if (chunk != m_chunks.size() - 1 || row != last_row)
+        {
+            auto& target_chunk = m_chunks[chunk];
+            for (const ComponentID component : m_components)
+            {
+                const auto& info = ComponentRegistry::getInfo(component);
+                auto* target = static_cast<std::byte*>(getColumn(target_chunk, component)) + row * info.size;
+                auto* source = static_cast<std::byte*>(getColumn(last_chunk, component)) + last_row * info.size;
+
+                relocateComponent(info, target, source);
+            }
+
+            moved_entity = getEntities(last_chunk)[last_row];
+            getEntities(target_chunk)[row] = moved_entity;
+        }
+
+        --m_entity_count;
+        if (--last_chunk.count == 0)
+        {
+            m_chunk_allocator.deallocateChunk(last_chunk.memory);
+            m_chunks.pop_back();
+        }
+
+        return moved_entity;
+    }
+
+    void Archetype::destroyComponents(const EntityLocation& location)
+    {
+        for (const ComponentID component : m_components)
+            destroyComponent(ComponentRegistry::getInfo(component), getComponent(location, component));
+    }
+
+    void* Archetype::getComponent(const EntityLocation& location, const ComponentID component) const
+    {
+        NB_CORE_ASSERT(m_mask.test(component), "Archetype doesn't store component!");
+
+        const auto& chunk = m_chunks[location.chunk];
+        return static_cast<std::byte*>(getColumn(chunk, component)) + location.row * ComponentRegistry::getInfo(component).size;
+    }
+
+    std::size_t Archetype::computeLayout(const uint32_t capacity)
+    {
+        std::size_t offset = sizeof(Entity) * capacity;
+        for (const ComponentID component : m_components)
+        {
+            const auto& info = ComponentRegistry::getInfo(component);
+
+            offset = (offset + info.alignment - 1) / info.alignment * info.alignment;
+            m_column_offsets[component] = static_cast<uint32_t>(offset);
+            offset += static_cast<std::size_t>(info.size) * capacity;
+        }
+
+        return offset;
+    }
+
+}
@@ -0,0 +1,56 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "scene/ChunkAllocator.h"
+
+#include <algorithm>
+
+#include "core/Assert.h"
+#include "memory/MemoryManager.h"
+
+namespace nebula::scene {
+
+    ChunkAllocator::ChunkAllocator(const uint32_t chunks_per_page) : m_chunks_per_page(chunks_per_page)
+    {
+        NB_CORE_ASSERT(chunks_per_page > 0, "Chunk allocator page has to hold at least one chunk!");
+    }
+
+    ChunkAllocator::~ChunkAllocator()
+    {
+        for (auto& page : m_pages)
+        {
+            NB_CORE_ASSERT(page->allocator.getFreeBlockCount() == page->allocator.getBlockCount(), "Chunk allocator destroyed with chunks in use!");
+
+            void* memory = page->memory;
+            page.reset();
+            memory::MemoryManager::freeMemory(memory);
+        }
+    }
+
+    std::byte* ChunkAllocator::allocateChunk()
+    {
+        auto it = std::ranges::find_if(m_pages, [](const auto& page){ return !page->allocator.full(); });
+        if (it == m_pages.end())
+        {
+            //  Over allocate by alignment, MemoryManager gives no alignment guarantees past malloc
+            const std::size_t page_size = cChunkSize * m_chunks_per_page + cChunkAlignment;
+            void* memory = memory::MemoryManager::requestMemory(page_size);
+
+            m_pages.emplace_back(createScope<Page>(memory, memory::PoolAllocator{memory, page_size, cChunkSize, cChunkAlignment}));
+            it = std::prev(m_pages.end());
+        }
+
+        return static_cast<std::byte*>((*it)->allocator.allocate(cChunkSize, cChunkAlignment));
+    }
+
+    void ChunkAllocator::deallocateChunk(std::byte* chunk)
+    {
+        const auto it = std::ranges::find_if(m_pages, [chunk](const auto& page){ return page->allocator.owns(chunk); });
+        NB_CORE_ASSERT(it != m_pages.end(), "Chunk was not allocated by this chunk allocator!");
+
+        (*it)->allocator.deallocate(chunk);
+    }
+
+}
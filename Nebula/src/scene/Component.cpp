@@ -0,0 +1,49 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "scene/Component.h"
+
+#include <mutex>
+#include <array>
+#include <atomic>
+#include <format>
+
+#include "core/Assert.h"
+
+namespace nebula::scene {
+
+    static std::mutex s_registry_mutex{};
+    static std::array<ComponentInfo, cMaxComponents> s_components{};
+    static std::atomic_uint32_t s_component_count = 0;
+
+    const ComponentInfo& ComponentRegistry::getInfo(const ComponentID component)
+    {
+        NB_CORE_ASSERT(component < s_component_count, "Invalid component ID!");
+        return s_components[component];
+    }
+
+    uint32_t ComponentRegistry::getComponentCount()
+    {
+        return s_component_count;
+    }
+
+    ComponentID ComponentRegistry::registerComponent(ComponentInfo&& info)
+    {
+        std::lock_guard<std::mutex> lock{s_registry_mutex};
+
+        const uint32_t count = s_component_count;
+        for (ComponentID id = 0; id < count; ++id)
+            if (s_components[id].name == info.name)
+                return id;
+
+        NB_CORE_ASSERT(count < cMaxComponents, std::format("Exceeded limit of {} component types registering {}!", cMaxComponents, info.name));
+
+        s_components[count] = std::move(info);
+        s_component_count = count + 1;
+
+        return count;
+    }
+
+}
@@ -0,0 +1,125 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "scene/EntityCommandBuffer.h"
+
+#include <span>
+#include <algorithm>
+
+#include "core/Assert.h"
+#include "scene/World.h"
+#include "threads/JobSystem.h"
+
+namespace nebula::scene {
+
+    static constexpr std::size_t cPayloadBlockSize = 4096;
+
+    EntityCommandBuffer::~EntityCommandBuffer()
+    {
+        clear();
+    }
+
+    void EntityCommandBuffer::destroyEntity(const Entity entity)
+    {
+        m_commands.push_back({CommandType::cDestroyEntity, entity, 0, 0});
+    }
+
+    void EntityCommandBuffer::removeComponent(const Entity entity, const ComponentID component)
+    {
+        m_commands.push_back({CommandType::cRemoveComponent, entity, component, 0});
+    }
+
+    void EntityCommandBuffer::playback(World& world)
+    {
+        for (const auto& command : m_commands)
+        {
+            const std::span<const ComponentData> components{m_components.data() + command.first_component, command.component_count};
+
+            switch (command.type)
+            {
+                case CommandType::cCreateEntity:
+                    world.createEntity(components);
+                    break;
+
+                case CommandType::cDestroyEntity:
+                    if (world.isAlive(command.entity))
+                        world.destroyEntity(command.entity);
+                    break;
+
+                case CommandType::cAddComponent:
+                    if (world.isAlive(command.entity))
+                        world.addComponent(command.entity, components.front());
+                    else
+                        destroyComponents(command.first_component, command.component_count);
+                    break;
+
+                case CommandType::cRemoveComponent:
+                    if (world.isAlive(command.entity))
+                        world.removeComponent(command.entity, command.first_component);
+                    break;
+            }
+        }
+
+        //  Every recorded value was relocated or destroyed
+        m_components.clear();
+        clear();
+    }
+
+    void EntityCommandBuffer::clear()
+    {
+        destroyComponents(0, static_cast<uint32_t>(m_components.size()));
+
+        m_commands.clear();
+        m_components.clear();
+
+        //  Blocks are kept for next recording
+        for (auto& block : m_blocks)
+            block.offset = 0;
+        m_current_block = 0;
+    }
+
+    void* EntityCommandBuffer::allocatePayload(const std::size_t size, const std::size_t alignment)
+    {
+        NB_CORE_ASSERT(alignment <= alignof(std::max_align_t), "Over aligned components can't be recorded in EntityCommandBuffer!");
+
+        for (; m_current_block < m_blocks.size(); ++m_current_block)
+        {
+            auto& block = m_blocks[m_current_block];
+
+            const std::size_t offset = (block.offset + alignment - 1) / alignment * alignment;
+            if (offset + size <= block.size)
+            {
+                block.offset = offset + size;
+                return block.memory.get() + offset;
+            }
+        }
+
+        const std::size_t block_size = std::max(cPayloadBlockSize, size);
+        auto& block = m_blocks.emplace_back(Block{createScope<std::byte[]>(block_size), block_size, size});
+
+        return block.memory.get();
+    }
+
+    void EntityCommandBuffer::destroyComponents(const uint32_t first_component, const uint32_t component_count)
+    {
+        for (uint32_t i = first_component; i < first_component + component_count; ++i)
+            destroyComponent(ComponentRegistry::getInfo(m_components[i].component), m_components[i].data);
+    }
+
+    ////////////////////////////////////////////////////////////////////
+    //////  ThreadCommandBuffers  //////////////////////////////////////
+    ////////////////////////////////////////////////////////////////////
+
+    ThreadCommandBuffers::ThreadCommandBuffers() :
+            m_buffers(threads::JobSystem::checkEnabled() ? threads::JobSystem::get().getThreadCount() : 1)
+    {}
+
+    void ThreadCommandBuffers::playback(World& world)
+    {
+        for (auto& buffer : m_buffers)
+            buffer.playback(world);
+    }
+
+}
@@ -0,0 +1,336 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "scene/TransformHierarchy.h"
+
+#include <algorithm>
+
+#include "core/Assert.h"
+#include "debug/Profiler.h"
+#include "debug/FrameCounters.h"
+#include "threads/JobSystem.h"
+#include "utility/SimdMath.h"
+
+namespace nebula::scene {
+
+    static constexpr uint32_t cTransformBatchSize = 512;    //  Slots of single level updated by one job
+
+    static constexpr uint32_t cInvalidHandle = TransformHandle::cInvalidIndex;
+    static constexpr uint32_t cInvalidSlot = std::numeric_limits<uint32_t>::max();
+
+    static glm::mat4 composeTransform(const glm::vec3& translation, const glm::quat& rotation, const glm::vec3& scale)
+    {
+        glm::mat4 transform = glm::mat4_cast(rotation);
+        transform[0] *= scale.x;
+        transform[1] *= scale.y;
+        transform[2] *= scale.z;
+        transform[3] = glm::vec4(translation, 1.0f);
+
+        return transform;
+    }
+
+    TransformHandle TransformHierarchy::createTransform(
+        const TransformHandle parent,
+        const glm::vec3& translation,
+        const glm::quat& rotation,
+        const glm::vec3& scale
+    )
+    {
+        const uint32_t parent_slot = parent.valid() ? getSlot(parent) : cNoParent;
+        const auto slot = static_cast<uint32_t>(m_parents.size());
+
+        uint32_t index;
+        if (!m_free_handles.empty())
+        {
+            index = m_free_handles.back();
+            m_free_handles.pop_back();
+        }
+        else
+        {
+            index = static_cast<uint32_t>(m_handle_slots.size());
+            m_handle_slots.push_back(cInvalidSlot);
+            m_handle_generations.push_back(0);
+        }
+        m_handle_slots[index] = slot;
+
+        //  Appended out of depth order, sorted on next update
+        m_translations.push_back(translation);
+        m_rotations.push_back(rotation);
+        m_scales.push_back(scale);
+        m_parents.push_back(parent_slot);
+        m_slot_handles.push_back(index);
+        m_local_dirty.push_back(1);
+        m_updated.push_back(0);
+        m_world_matrices.emplace_back(1.0f);
+
+        ++m_dirty_count;
+        m_structure_changed = true;
+
+        return {index, m_handle_generations[index]};
+    }
+
+    void TransformHierarchy::destroyTransform(const TransformHandle transform)
+    {
+        releaseHandle(getSlot(transform));
+        m_structure_changed = true;
+    }
+
+    void TransformHierarchy::setParent(const TransformHandle transform, const TransformHandle parent)
+    {
+        const uint32_t slot = getSlot(transform);
+        const uint32_t parent_slot = parent.valid() ? getSlot(parent) : cNoParent;
+
+        for (uint32_t ancestor = parent_slot; ancestor != cNoParent; ancestor = m_parents[ancestor])
+            NB_CORE_ASSERT(ancestor != slot, "Transform can't be parented to its own descendant!");
+
+        m_parents[slot] = parent_slot;
+        markDirty(slot);
+        m_structure_changed = true;
+    }
+
+    void TransformHierarchy::setTranslation(const TransformHandle transform, const glm::vec3& translation)
+    {
+        const uint32_t slot = getSlot(transform);
+        m_translations[slot] = translation;
+        markDirty(slot);
+    }
+
+    void TransformHierarchy::setRotation(const TransformHandle transform, const glm::quat& rotation)
+    {
+        const uint32_t slot = getSlot(transform);
+        m_rotations[slot] = rotation;
+        markDirty(slot);
+    }
+
+    void TransformHierarchy::setScale(const TransformHandle transform, const glm::vec3& scale)
+    {
+        const uint32_t slot = getSlot(transform);
+        m_scales[slot] = scale;
+        markDirty(slot);
+    }
+
+    void TransformHierarchy::setLocalTransform(const TransformHandle transform, const glm::vec3& translation, const glm::quat& rotation, const glm::vec3& scale)
+    {
+        const uint32_t slot = getSlot(transform);
+        m_translations[slot] = translation;
+        m_rotations[slot] = rotation;
+        m_scales[slot] = scale;
+        markDirty(slot);
+    }
+
+    TransformHandle TransformHierarchy::getParent(const TransformHandle transform) const
+    {
+        const uint32_t parent_slot = m_parents[getSlot(transform)];
+        if (parent_slot == cNoParent || m_slot_handles[parent_slot] == cInvalidHandle)
+            return cNullTransform;
+
+        const uint32_t index = m_slot_handles[parent_slot];
+        return {index, m_handle_generations[index]};
+    }
+
+    void TransformHierarchy::update()
+    {
+        NB_PROFILE_SCOPE("Transform hierarchy update");
+
+        const bool reordered = m_structure_changed;
+        if (reordered)
+            rebuildOrder();
+
+        if (m_dirty_count > 0)
+        {
+            //  Levels are barriers, parents of every slot in level were finished by previous one
+            const bool parallel = threads::JobSystem::checkEnabled();
+            for (uint32_t level = 0; level < getLevelCount(); ++level)
+            {
+                const uint32_t begin = m_level_offsets[level];
+                const uint32_t end = m_level_offsets[level + 1];
+
+                if (parallel && end - begin > cTransformBatchSize)
+                {
+                    const uint32_t batch_count = (end - begin + cTransformBatchSize - 1) / cTransformBatchSize;
+                    threads::JobSystem::get().parallelFor(batch_count, [this, begin, end](const uint32_t job_index, uint32_t)
+                    {
+                        const uint32_t batch_begin = begin + job_index * cTransformBatchSize;
+                        updateSlots(batch_begin, std::min(batch_begin + cTransformBatchSize, end));
+                    });
+                }
+                else
+                    updateSlots(begin, end);
+            }
+        }
+        else if (m_has_updates)
+            std::ranges::fill(m_updated, 0);
+
+        //  Slots moved, so every matrix counts as updated for consumers tracking changed ranges
+        if (reordered)
+            std::ranges::fill(m_updated, 1);
+
+        m_has_updates = reordered || m_dirty_count > 0;
+        m_dirty_count = 0;
+    }
+
+    uint32_t TransformHierarchy::getSlot(const TransformHandle transform) const
+    {
+        NB_CORE_ASSERT(isValid(transform), "Invalid transform handle!");
+        return m_handle_slots[transform.index];
+    }
+
+    bool TransformHierarchy::isValid(const TransformHandle transform) const
+    {
+        return transform.index < m_handle_slots.size() &&
+               m_handle_generations[transform.index] == transform.generation &&
+               m_handle_slots[transform.index] != cInvalidSlot;
+    }
+
+    void TransformHierarchy::markDirty(const uint32_t slot)
+    {
+        if (!m_local_dirty[slot])
+        {
+            m_local_dirty[slot] = 1;
+            ++m_dirty_count;
+        }
+    }
+
+    void TransformHierarchy::releaseHandle(const uint32_t slot)
+    {
+        const uint32_t index = m_slot_handles[slot];
+
+        m_handle_slots[index] = cInvalidSlot;
+        ++m_handle_generations[index];
+        m_free_handles.push_back(index);
+
+        m_slot_handles[slot] = cInvalidHandle;
+    }
+
+    void TransformHierarchy::rebuildOrder()
+    {
+        NB_PROFILE_SCOPE("Transform hierarchy rebuild");
+
+        static constexpr uint32_t cUnknownDepth = std::numeric_limits<uint32_t>::max();
+        static constexpr uint32_t cRemovedDepth = cUnknownDepth - 1;
+
+        const auto count = static_cast<uint32_t>(m_parents.size());
+
+        //  Depth of every slot, slots are not sorted yet so ancestors are resolved first through explicit chain
+        std::vector<uint32_t> depths(count, cUnknownDepth);
+        std::vector<uint32_t> chain;
+        for (uint32_t slot = 0; slot < count; ++slot)
+        {
+            for (uint32_t node = slot; depths[node] == cUnknownDepth; node = m_parents[node])
+            {
+                chain.push_back(node);
+                if (m_slot_handles[node] == cInvalidHandle || m_parents[node] == cNoParent)
+                    break;
+            }
+
+            while (!chain.empty())
+            {
+                const uint32_t node = chain.back();
+                const uint32_t parent = m_parents[node];
+                chain.pop_back();
+
+                if (m_slot_handles[node] == cInvalidHandle)
+                    depths[node] = cRemovedDepth;
+                else if (parent == cNoParent)
+                    depths[node] = 0;
+                else
+                    depths[node] = depths[parent] == cRemovedDepth ? cRemovedDepth : depths[parent] + 1;
+            }
+        }
+
+        //  Counting sort by depth, stable so siblings keep relative order
+        m_level_offsets.clear();
+        for (uint32_t slot = 0; slot < count; ++slot)
+        {
+            if (depths[slot] == cRemovedDepth)
+            {
+                //  Descendant of destroyed transform
+                if (m_slot_handles[slot] != cInvalidHandle)
+                    releaseHandle(slot);
+                continue;
+            }
+
+            if (depths[slot] + 2 > m_level_offsets.size())
+                m_level_offsets.resize(depths[slot] + 2, 0);
+            ++m_level_offsets[depths[slot] + 1];
+        }
+
+        for (uint32_t level = 1; level < m_level_offsets.size(); ++level)
+            m_level_offsets[level] += m_level_offsets[level - 1];
+
+        std::vector<uint32_t> remap(count, cInvalidSlot);
+        std::vector<uint32_t> level_cursors(m_level_offsets);
+        for (uint32_t slot = 0; slot < count; ++slot)
+            if (depths[slot] != cRemovedDepth)
+                remap[slot] = level_cursors[depths[slot]]++;
+
+        const uint32_t new_count = m_level_offsets.empty() ? 0 : m_level_offsets.back();
+
+        std::vector<glm::vec3> translations(new_count);
+        std::vector<glm::quat> rotations(new_count);
+        std::vector<glm::vec3> scales(new_count);
+        std::vector<uint32_t> parents(new_count);
+        std::vector<uint32_t> slot_handles(new_count);
+        std::vector<uint8_t> local_dirty(new_count);
+        std::vector<glm::mat4> world_matrices(new_count);
+
+        m_dirty_count = 0;
+        for (uint32_t slot = 0; slot < count; ++slot)
+        {
+            const uint32_t target = remap[slot];
+            if (target == cInvalidSlot)
+                continue;
+
+            translations[target] = m_translations[slot];
+            rotations[target] = m_rotations[slot];
+            scales[target] = m_scales[slot];
+            parents[target] = m_parents[slot] == cNoParent ? cNoParent : remap[m_parents[slot]];
+            slot_handles[target] = m_slot_handles[slot];
+            local_dirty[target] = m_local_dirty[slot];
+            world_matrices[target] = m_world_matrices[slot];
+
+            m_handle_slots[m_slot_handles[slot]] = target;
+            m_dirty_count += m_local_dirty[slot];
+        }
+
+        m_translations = std::move(translations);
+        m_rotations = std::move(rotations);
+        m_scales = std::move(scales);
+        m_parents = std::move(parents);
+        m_slot_handles = std::move(slot_handles);
+        m_local_dirty = std::move(local_dirty);
+        m_world_matrices = std::move(world_matrices);
+
+        m_updated.assign(new_count, 0);
+        m_structure_changed = false;
+    }
+
+    void TransformHierarchy::updateSlots(const uint32_t begin, const uint32_t end)
+    {
+        uint32_t updated_count = 0;
+        for (uint32_t slot = begin; slot < end; ++slot)
+        {
+            const uint32_t parent = m_parents[slot];
+            const bool dirty = m_local_dirty[slot] || (parent != cNoParent && m_updated[parent]);
+
+            m_updated[slot] = dirty;
+            if (!dirty)
+                continue;
+
+            m_local_dirty[slot] = 0;
+            const glm::mat4 local = composeTransform(m_translations[slot], m_rotations[slot], m_scales[slot]);
+
+            if (parent == cNoParent)
+                m_world_matrices[slot] = local;
+            else
+                simd::multiplyMatrices(m_world_matrices[parent], local, m_world_matrices[slot]);
+
+            ++updated_count;
+        }
+
+        NB_COUNT(cTransformsUpdated, updated_count);
+    }
+
+}
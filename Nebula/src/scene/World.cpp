@@ -0,0 +1,194 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "scene/World.h"
+
+namespace nebula::scene {
+
+    static constexpr auto cStructuralChangeMessage = "Structural changes during query iteration have to be recorded in EntityCommandBuffer!";
+
+    World::World()
+    {
+        //  Entities without components
+        getArchetype(ComponentMask{});
+    }
+
+    World::~World()
+    {
+        //  Archetypes return their chunks, before chunk allocator is destroyed
+        m_archetype_map.clear();
+        m_archetypes.clear();
+    }
+
+    Entity World::createEntity(const std::span<const ComponentData> components)
+    {
+        ComponentMask mask;
+        for (const auto& component : components)
+            mask.set(component.component);
+
+        NB_CORE_ASSERT(mask.count() == components.size(), "Entity can't have duplicated components!");
+
+        EntityLocation location;
+        const Entity entity = spawnEntity(getArchetype(mask), location);
+        for (const auto& component : components)
+            relocateComponent(ComponentRegistry::getInfo(component.component), location.archetype->getComponent(location, component.component), component.data);
+
+        return entity;
+    }
+
+    void World::addComponent(const Entity entity, const ComponentData& component)
+    {
+        const auto& info = ComponentRegistry::getInfo(component.component);
+
+        void* address = getComponent(entity, component.component);
+        if (address)
+            destroyComponent(info, address);
+        else
+            address = insertComponent(entity, component.component);
+
+        relocateComponent(info, address, component.data);
+    }
+
+    void World::removeComponent(const Entity entity, const ComponentID component)
+    {
+        NB_CORE_ASSERT(m_lock_count == 0, cStructuralChangeMessage);
+        NB_CORE_ASSERT(isAlive(entity), "Entity was destroyed!");
+
+        Archetype& archetype = *m_entities[entity.index].location.archetype;
+        if (archetype.hasComponent(component))
+            moveEntity(entity, getNeighbour(archetype, component, false));
+    }
+
+    void* World::getComponent(const Entity entity, const ComponentID component) const
+    {
+        NB_CORE_ASSERT(isAlive(entity), "Entity was destroyed!");
+
+        const auto& location = m_entities[entity.index].location;
+        if (!location.archetype->hasComponent(component))
+            return nullptr;
+
+        return location.archetype->getComponent(location, component);
+    }
+
+    void World::destroyEntity(const Entity entity)
+    {
+        NB_CORE_ASSERT(m_lock_count == 0, cStructuralChangeMessage);
+        NB_CORE_ASSERT(isAlive(entity), "Entity was already destroyed!");
+
+        auto& record = m_entities[entity.index];
+        const EntityLocation location = record.location;
+
+        location.archetype->destroyComponents(location);
+        removeRow(location);
+
+        //  Invalidates every handle to this slot
+        record.location = {};
+        ++record.generation;
+
+        m_free_entities.push_back(entity.index);
+        --m_entity_count;
+    }
+
+    bool World::isAlive(const Entity entity) const
+    {
+        return entity.index < m_entities.size() && m_entities[entity.index].generation == entity.generation;
+    }
+
+    Archetype& World::getArchetype(const ComponentMask& mask)
+    {
+        const auto it = m_archetype_map.find(mask);
+        if (it != m_archetype_map.end())
+            return *it->second;
+
+        NB_CORE_ASSERT(m_lock_count == 0, cStructuralChangeMessage);
+
+        Archetype* archetype = m_archetypes.emplace_back(createScope<Archetype>(mask, m_chunk_allocator)).get();
+        m_archetype_map.emplace(mask, archetype);
+
+        return *archetype;
+    }
+
+    Archetype& World::getNeighbour(Archetype& archetype, const ComponentID component, const bool add)
+    {
+        auto& edge = add ? archetype.m_add_edges[component] : archetype.m_remove_edges[component];
+        if (!edge)
+        {
+            ComponentMask mask = archetype.getMask();
+            mask.set(component, add);
+
+            edge = &getArchetype(mask);
+            (add ? edge->m_remove_edges[component] : edge->m_add_edges[component]) = &archetype;
+        }
+
+        return *edge;
+    }
+
+    Entity World::spawnEntity(Archetype& archetype, EntityLocation& location)
+    {
+        NB_CORE_ASSERT(m_lock_count == 0, cStructuralChangeMessage);
+
+        uint32_t index;
+        if (!m_free_entities.empty())
+        {
+            index = m_free_entities.back();
+            m_free_entities.pop_back();
+        }
+        else
+        {
+            index = static_cast<uint32_t>(m_entities.size());
+            m_entities.emplace_back();
+        }
+
+        auto& record = m_entities[index];
+        const Entity entity{index, record.generation};
+
+        record.location = archetype.pushEntity(entity);
+        location = record.location;
+        ++m_entity_count;
+
+        return entity;
+    }
+
+    void World::moveEntity(const Entity entity, Archetype& target)
+    {
+        const EntityLocation source = m_entities[entity.index].location;
+        const EntityLocation destination = target.pushEntity(entity);
+
+        //  Shared components are relocated, components missing in target are dropped
+        Archetype& archetype = *source.archetype;
+        for (const ComponentID component : archetype.getComponents())
+        {
+            const auto& info = ComponentRegistry::getInfo(component);
+            void* address = archetype.getComponent(source, component);
+
+            if (target.hasComponent(component))
+                relocateComponent(info, target.getComponent(destination, component), address);
+            else
+                destroyComponent(info, address);
+        }
+
+        removeRow(source);
+        m_entities[entity.index].location = destination;
+    }
+
+    void World::removeRow(const EntityLocation& location)
+    {
+        const Entity moved_entity = location.archetype->removeEntity(location.chunk, location.row);
+        if (moved_entity.valid())
+            m_entities[moved_entity.index].location = location;
+    }
+
+    void* World::insertComponent(const Entity entity, const ComponentID component)
+    {
+        NB_CORE_ASSERT(m_lock_count == 0, cStructuralChangeMessage);
+        NB_CORE_ASSERT(isAlive(entity), "Entity was destroyed!");
+
+        Archetype& target = getNeighbour(*m_entities[entity.index].location.archetype, component, true);
+        moveEntity(entity, target);
+
+        return target.getComponent(m_entities[entity.index].location, component);
+    }
+
+}
@@ -0,0 +1,125 @@
+//
+// Created by michal-swiatek on 19.10.2026.
+// Github: https://github.com/michal-swiatek
+//
+
+#include "threads/JobSystem.h"
+
+#include <format>
+
+#include "core/Logging.h"
+#include "debug/Profiler.h"
+#include "platform/EngineConfiguration.h"
+
+namespace nebula::threads {
+
+    JobSystem* JobSystem::s_instance = nullptr;
+
+    //  Set on workers and on calling thread while it runs jobs, nested batch would deadlock on m_dispatch_mutex
+    static thread_local bool s_running_jobs = false;
+
+    JobSystem::JobSystem(const uint32_t worker_count)
+    {
+        NB_CORE_ASSERT(!s_instance, "Can have only one JobSystem!");
+        s_instance = this;
+
+        if constexpr (NEBULA_INITIALIZATION_VERBOSITY >= NEBULA_INITIALIZATION_VERBOSITY_MEDIUM)
+            NB_CORE_INFO("Initializing JobSystem with {} workers", worker_count);
+
+        m_workers.reserve(worker_count);
+        for (uint32_t i = 0; i < worker_count; ++i)
+        {
+            m_workers.emplace_back(&JobSystem::workerLoop, this, i);
+            logging::ThreadFormatterFlag::addThreadName(m_workers.back().get_id(), std::format("JobWorker {}", i));
+        }
+    }
+
+    JobSystem::~JobSystem()
+    {
+        {
+            std::lock_guard lock{m_mutex};
+            m_running = false;
+        }
+        m_batch_ready.notify_all();
+
+        for (auto& worker : m_workers)
+            worker.join();
+
+        NB_CORE_ASSERT(s_instance);
+        s_instance = nullptr;
+    }
+
+    void JobSystem::parallelFor(const uint32_t job_count, const Job& job)
+    {
+        NB_CORE_ASSERT(!s_running_jobs, "Jobs can't dispatch nested JobSystem batches!");
+        if (job_count == 0)
+            return;
+
+        std::lock_guard dispatch_lock{m_dispatch_mutex};
+
+        Batch batch;
+        batch.job = &job;
+        batch.job_count = job_count;
+
+        //  Single job is not worth waking workers
+        if (job_count > 1 && !m_workers.empty())
+        {
+            {
+                std::lock_guard lock{m_mutex};
+                m_batch = &batch;
+                ++m_batch_generation;
+            }
+            m_batch_ready.notify_all();
+        }
+
+        s_running_jobs = true;
+        runJobs(batch, getThreadCount() - 1);
+        s_running_jobs = false;
+
+        //  Batch lives on this stack frame, it can't be left while any worker still references it
+        std::unique_lock lock{m_mutex};
+        m_batch_finished.wait(lock, [&batch] { return batch.finished_jobs.load() == batch.job_count && batch.active_workers == 0; });
+        m_batch = nullptr;
+    }
+
+    void JobSystem::workerLoop(const uint32_t thread_index)
+    {
+        s_running_jobs = true;
+        NB_PROFILE_THREAD(std::format("JobWorker {}", thread_index));
+        uint64_t last_generation = 0;
+
+        while (true)
+        {
+            Batch* batch;
+            {
+                std::unique_lock lock{m_mutex};
+                m_batch_ready.wait(lock, [&] { return !m_running || (m_batch && m_batch_generation != last_generation); });
+
+                if (!m_running)
+                    return;
+
+                last_generation = m_batch_generation;
+                batch = m_batch;
+                ++batch->active_workers;
+            }
+
+            runJobs(*batch, thread_index);
+
+            {
+                std::lock_guard lock{m_mutex};
+                --batch->active_workers;
+            }
+            m_batch_finished.notify_all();
+        }
+    }
+
+    void JobSystem::runJobs(Batch& batch, const uint32_t thread_index)
+    {
+        for (uint32_t job_index = batch.next_job++; job_index < batch.job_count; job_index = batch.next_job++)
+        {
+            (*batch.job)(job_index, thread_index);
+            batch.finished_jobs.fetch_add(1);
+        }
+    }
+
+}
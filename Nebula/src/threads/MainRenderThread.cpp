@@ -9,6 +9,8 @@
 #include "core/Config.h"
 #include "core/Application.h"
 #include "core/UpdateContext.h"
+#include "debug/Profiler.h"
+#include "debug/FrameStats.h"
 #include "debug/ImGuiBackend.h"
 
 #include "rendering/renderer/RendererAPI.h"
@@ -28,8 +30,7 @@ namespace nebula {
             NB_CORE_ASSERT(!s_instance);
             s_instance = this;
 
-            auto& engine_config = Config::getEngineConfig();
-            m_frames_in_flight_number = engine_config["rendering"]["frames_in_flight"].as<uint32_t>();
+            m_frames_in_flight_number = Config::getEngineSettings().rendering.frames_in_flight;
         }
 
         RenderContext::~RenderContext()
@@ -60,15 +61,30 @@ namespace nebula {
 
         void MainRenderThread::mainLoopBody()
         {
-            const uint32_t render_fps = m_render_context->getRenderFps();
+            NB_PROFILE_FUNCTION();
+
+            //  Time spent minimized is not a frame
+            if (waitWhileMinimized())
+                m_frame_timer.reset();
+
+            const double frame_time = m_frame_timer.elapsedSeconds(true);
+
+            const uint32_t render_fps = m_application.getFpsLimit(m_render_context->getRenderFps());
             const double render_timestep = render_fps > 0 ? 1.0 / render_fps : 0.0;
             const double next_frame_time = UpdateContext::get().getTime() + render_timestep;
 
             const uint32_t frame_in_flight = m_render_context->getCurrentRenderFrame();
 
+            Timer cpu_timer;
+            Timer section_timer;
+            double fence_wait_time = 0.0;
+            double present_time = 0.0;
+
             if (!m_application.minimized())
             {
                 m_render_context->waitForFrameResources(frame_in_flight);
+                fence_wait_time = section_timer.elapsedSeconds();
+
                 if (m_vsync != m_render_context->checkVSync())
                     reloadSwapchain();
 
@@ -81,19 +97,36 @@ namespace nebula {
                     m_renderpass_executor->resetResources(frame_in_flight);
                     m_renderpass_executor->setFramebuffer(framebuffer);
 
-                    auto final_commands = m_renderpass_executor->execute(m_renderpass_objects, frame_in_flight);
-                    auto commands_executor = m_render_context->getCommandExecutor();
+                    auto& final_commands = m_renderpass_executor->execute(m_renderpass_objects, frame_in_flight);
+                    auto& commands_executor = m_render_context->getCommandExecutor();
 
                     //  Submit commands
-                    commands_executor->executeCommands(std::move(final_commands));
-                    commands_executor->submitCommands();
+                    commands_executor.executeCommands(final_commands);
+                    commands_executor.submitCommands();
 
+                    section_timer.reset();
                     m_render_context->presentImage();
+                    present_time = section_timer.elapsedSeconds();
                 }
             }
 
+            const double render_cpu_time = cpu_timer.elapsedSeconds(true) - fence_wait_time - present_time;
+
             if (render_fps > 0)
+            {
+                NB_PROFILE_SCOPE("Sleep");
                 Timer::sleepUntilPrecise(next_frame_time);
+            }
+
+            auto& frame_stats = FrameStats::get();
+            frame_stats.record(FrameMetric::cFrameTime, frame_time);
+            frame_stats.record(FrameMetric::cRenderCpu, render_cpu_time);
+            frame_stats.record(FrameMetric::cFenceWait, fence_wait_time);
+            frame_stats.record(FrameMetric::cPresent, present_time);
+            frame_stats.record(FrameMetric::cRenderSleep, cpu_timer.elapsedSeconds());
+            frame_stats.endFrame();
+
+            NB_PROFILE_FRAME();
         }
 
         void MainRenderThread::init()
@@ -116,6 +149,8 @@ namespace nebula {
             m_renderpass_objects.setStages(1);
             m_renderpass_objects.addObject(0, m_vertices_object.get());
             m_renderpass_objects.addObject(0, m_imgui_object.get());
+
+            m_frame_timer.reset();
         }
 
         void MainRenderThread::shutdown()
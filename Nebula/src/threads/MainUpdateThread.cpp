@@ -5,6 +5,11 @@
 
 #include "threads/MainUpdateThread.h"
 
+#include "core/Config.h"
+#include "debug/Profiler.h"
+#include "debug/FrameStats.h"
+#include "debug/FrameCounters.h"
+#include "debug/ImGuiLayer.h"
 #include "rendering/RenderContext.h"
 
 namespace nebula {
@@ -34,13 +39,20 @@ namespace nebula {
 
         void MainUpdateThread::mainLoopBody()
         {
-            const uint32_t render_fps = rendering::RenderContext::get().getRenderFps();
+            NB_PROFILE_FUNCTION();
+
+            //  Time spent minimized is not simulated
+            if (waitWhileMinimized())
+                m_update_timer.reset();
+
+            const uint32_t render_fps = m_application.getFpsLimit(rendering::RenderContext::get().getRenderFps());
             const double render_timestep = render_fps > 0 ? 1.0 / render_fps : 0.0;
             const double next_frame_time = m_update_context->getTime() + render_timestep;
 
             const double update_timestep = m_update_context->getUpdateTimestep();
             const double frame_time = m_update_timer.elapsedSeconds(true);
 
+            Timer cpu_timer;
             m_application.m_event_manager.dispatchEvents();
 
             if (!m_application.minimized())
@@ -48,23 +60,66 @@ namespace nebula {
                 m_update_accumulator += frame_time;
 
                 for (const auto& layer : m_application.m_layer_stack)
+                {
                     layer->onUpdate(Timestep(frame_time));
+                    NB_COUNT(cLayersUpdated, 1);
+                }
+
+                const uint32_t max_fixed_updates = m_update_context->getMaxFixedUpdates();
+                uint32_t fixed_updates = 0;
 
-                while (m_update_accumulator > update_timestep)
+                while (m_update_accumulator > update_timestep && fixed_updates < max_fixed_updates)
                 {
                     for (const auto& layer : m_application.m_layer_stack)
+                    {
                         layer->onFixedUpdate(Timestep(update_timestep));
+                        NB_COUNT(cLayersUpdated, 1);
+                    }
 
                     m_update_accumulator -= update_timestep;
+                    ++fixed_updates;
+                }
+
+                //  Drop time debt after hitch, keep only partial step for interpolation
+                if (m_update_accumulator > update_timestep)
+                {
+                    const double remainder = std::fmod(m_update_accumulator, update_timestep);
+                    const double dropped_time = m_update_accumulator - remainder;
+
+                    m_update_context->m_dropped_update_time.store(m_update_context->m_dropped_update_time.load() + dropped_time);
+                    m_update_accumulator = remainder;
+                }
+
+                m_update_context->m_interpolation_alpha.store(m_update_accumulator / update_timestep);
+
+                //  UI code runs next to state it inspects, render thread only draws published snapshot
+                if (ImGuiLayer::checkEnabled())
+                {
+                    NB_PROFILE_SCOPE("ImGui");
+                    ImGuiLayer::begin();
+
+                    for (const auto& layer : m_application.m_layer_stack)
+                        layer->onImGuiRender();
+
+                    ImGuiLayer::end();
                 }
             }
 
-            Timer::sleepUntilPrecise(next_frame_time);
+            FrameStats::get().record(FrameMetric::cUpdateCpu, cpu_timer.elapsedSeconds(true));
+
+            if (render_fps > 0)
+            {
+                NB_PROFILE_SCOPE("Sleep");
+                Timer::sleepUntilPrecise(next_frame_time);
+            }
+
+            FrameStats::get().record(FrameMetric::cUpdateSleep, cpu_timer.elapsedSeconds());
         }
 
         void MainUpdateThread::init()
         {
             m_update_context = UpdateContext::create();
+            m_update_context->setMaxFixedUpdates(Config::getEngineSettings().threads.max_fixed_updates);
         }
 
         void MainUpdateThread::shutdown()
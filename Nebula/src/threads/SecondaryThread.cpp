@@ -5,7 +5,12 @@
 
 #include "threads/SecondaryThread.h"
 
+#include "core/Timer.h"
+#include "core/Config.h"
 #include "core/Logging.h"
+#include "core/Application.h"
+#include "debug/Profiler.h"
+#include "debug/AllocationGuard.h"
 #include "platform/EngineConfiguration.h"
 
 namespace nebula::threads {
@@ -52,30 +57,93 @@ namespace nebula::threads {
     void SecondaryThread::mainLoop()
     {
         logging::ThreadFormatterFlag::addThreadName(std::this_thread::get_id(), m_name);
+        NB_PROFILE_THREAD(m_name);
 
         if constexpr (NEBULA_INITIALIZATION_VERBOSITY >= NEBULA_INITIALIZATION_VERBOSITY_MEDIUM)
             NB_CORE_INFO("Initializing {}", getName());
 
+        uint64_t settings_version = Config::getEngineSettings().version;
+        Timer::setAdaptiveBusyOffset(Config::getEngineSettings().threads.adaptive_sleep);
         init();
 
         m_init_ready.test_and_set();
         m_init_ready.notify_all();
 
+        //  Steady state frames should not allocate, warm-up frames fill caches and scratch storage
+        const auto warmup_frames = Config::getEngineSettings().debug.allocation_guard_warmup_frames;
+        uint32_t frame = 0;
+
         m_running.wait(false);
         while (m_running.test())
+        {
+            //  Thread local settings follow hot reloads
+            if (const auto& settings = Config::getEngineSettings(); settings.version != settings_version)
+            {
+                Timer::setAdaptiveBusyOffset(settings.threads.adaptive_sleep);
+                settings_version = settings.version;
+            }
+
             mainLoopBody();
 
+            if (++frame == warmup_frames)
+                AllocationGuard::guardThread(m_name.c_str());
+        }
+
+        AllocationGuard::releaseThread();
+
         m_cleanup.wait(false);
 
         if constexpr (NEBULA_INITIALIZATION_VERBOSITY >= NEBULA_INITIALIZATION_VERBOSITY_MEDIUM)
             NB_CORE_INFO("Shutting down {}", getName());
 
+        if constexpr (NEBULA_INITIALIZATION_VERBOSITY >= NEBULA_INITIALIZATION_VERBOSITY_MEDIUM)
+            logSleepStats();
+
         shutdown();
 
         m_shutdown_ready.test_and_set();
         m_shutdown_ready.notify_all();
     }
 
+    bool SecondaryThread::waitWhileMinimized() const
+    {
+        if (!Application::get().minimized())
+            return false;
+
+        const double wake_latency = Application::get().waitWhileMinimized();
+        NB_CORE_TRACE("{} woke up {:.3f} ms after window state change", getName(), wake_latency * 1000.0);
+
+        return true;
+    }
+
+    void SecondaryThread::logSleepStats() const
+    {
+        const SleepStats stats = Timer::getSleepStats();
+        if (stats.sleeps == 0)
+            return;
+
+        NB_CORE_INFO(
+            "{} frame pacing: {} sleeps, {} overruns, {} deadline misses, spin utilization {:.2f}%, spin margin {:.3f} ms",
+            getName(), stats.sleeps, stats.overruns, stats.deadline_misses, stats.spinUtilization() * 100.0, stats.busy_offset * 1000.0
+        );
+
+        if (stats.deadline_misses == 0)
+            return;
+
+        double lower_bound = 0.0;
+        for (std::size_t bucket = 0; bucket < SleepStats::cMissBuckets; ++bucket)
+        {
+            if (bucket < SleepStats::cMissBucketBounds.size())
+            {
+                const double upper_bound = SleepStats::cMissBucketBounds[bucket];
+                NB_CORE_INFO("    late {:>6.3f} - {:>6.3f} ms: {}", lower_bound * 1000.0, upper_bound * 1000.0, stats.miss_histogram[bucket]);
+                lower_bound = upper_bound;
+            }
+            else
+                NB_CORE_INFO("    late {:>6.3f} ms and more: {}", lower_bound * 1000.0, stats.miss_histogram[bucket]);
+        }
+    }
+
     const std::string& SecondaryThread::getName() const
     {
         return m_name;